@@ -0,0 +1,452 @@
+/**
+===============================================================================================================================
+    @file    bench.cpp
+    @brief   Microbenchmarks of solver, parsers, comparison of roots and colored output.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Build with 'make bench' and run bench.exe (C_ASSERT checks as in debug build),
+               or with 'make bench-release' and run bench_release.exe (without checks) to see their cost.\n
+             - Every benchmark passes over the same mix of equations (two roots, one root, no roots,
+               linear and infinitely many roots) BENCH_RUNS times.\n
+             - For every benchmark mean time of one operation, equations per second,
+               variance of time between runs and the fastest run are printed.
+
+===============================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <chrono>
+#include "quadratic.h"
+#include "quadratic_io.h"
+#include "quadratic_tests.h"
+#include "utils.h"
+#include "colors.h"
+#include "custom_assert.h"
+#include "solve_cache.h"
+
+/**
+===============================================================================================================================
+    @brief   - Number of equations in one run of benchmark.
+
+===============================================================================================================================
+*/
+static const size_t BENCH_EQUATIONS = 1 << 14;
+
+/**
+===============================================================================================================================
+    @brief   - Number of runs, that are not measured.
+
+===============================================================================================================================
+*/
+static const size_t BENCH_WARMUP_RUNS = 3;
+
+/**
+===============================================================================================================================
+    @brief   - Number of measured runs of every benchmark.
+
+===============================================================================================================================
+*/
+static const size_t BENCH_RUNS = 25;
+
+/**
+===============================================================================================================================
+    @brief   - The maximum length of line of tests file.
+
+===============================================================================================================================
+*/
+static const size_t BENCH_LINE_LENGTH = 128;
+
+/**
+===============================================================================================================================
+    @brief   - Number of different equations in cache benchmark, all of them fit in cache.
+
+===============================================================================================================================
+*/
+static const size_t BENCH_REPEATED_EQUATIONS = 256;
+
+#ifdef _WIN32
+static const char *NULL_STREAM_NAME = "NUL";
+#else
+static const char *NULL_STREAM_NAME = "/dev/null";
+#endif
+
+/**
+===============================================================================================================================
+    @brief   Inputs of benchmarks.
+
+===============================================================================================================================
+*/
+struct bench_data_t {
+    quadratic_equation_t *expected;
+    quadratic_equation_t *actual;
+    char *text;
+    size_t text_size;
+    FILE *lines;
+    FILE *null_stream;
+    size_t count;
+};
+
+typedef size_t (*bench_function_t)(bench_data_t *data);
+
+static bool make_bench_data(bench_data_t *data, size_t count);
+static void free_bench_data(bench_data_t *data);
+static void make_equation(quadratic_equation_t *equation, size_t index, uint64_t *state);
+static double random_double(uint64_t *state, double min, double max);
+static void run_benchmark(const char *name, bench_function_t function, bench_data_t *data);
+static size_t bench_solve_quadratic(bench_data_t *data);
+static size_t bench_solve_quadratic_cached(bench_data_t *data);
+static size_t bench_read_expected_line(bench_data_t *data);
+static size_t bench_read_expected_text(bench_data_t *data);
+static size_t bench_compare_roots(bench_data_t *data);
+static size_t bench_color_printf(bench_data_t *data);
+
+/**
+===============================================================================================================================
+    @brief   - Result of benchmarks, so compiler can not remove them.
+
+===============================================================================================================================
+*/
+static volatile size_t bench_sink = 0;
+
+int main(void) {
+    set_assert_handler(print_colored_assert_error);
+
+    bench_data_t data = {};
+    if(!make_bench_data(&data, BENCH_EQUATIONS)) {
+        fprintf(stderr, "Unable to prepare benchmark data\n");
+        free_bench_data(&data);
+        return EXIT_FAILURE;
+    }
+
+    printf("%zu equations per run, %zu runs, contract level %d\n", data.count, BENCH_RUNS, CONTRACT_LEVEL);
+    printf("%-20s %12s %16s %14s %12s\n", "benchmark", "ns/op", "equations/s", "variance", "min ns/op");
+
+    run_benchmark("solve_quadratic",    bench_solve_quadratic,    &data);
+    run_benchmark("solve_cached",       bench_solve_quadratic_cached, &data);
+    run_benchmark("read_expected_line", bench_read_expected_line, &data);
+    run_benchmark("read_expected_text", bench_read_expected_text, &data);
+    run_benchmark("compare_roots",      bench_compare_roots,      &data);
+    run_benchmark("color_printf",       bench_color_printf,       &data);
+
+    free_bench_data(&data);
+    return EXIT_SUCCESS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Generates equations, their text and file with their text.
+
+    @details - Kinds of equations are cycled: two roots, one root, no roots, linear, infinitely many roots.
+
+    @param   [out] data               Pointer to structure of benchmark inputs.
+    @param   [in]  count              Number of equations.
+
+    @return  True if data was made and false if memory or file could not be allocated.
+
+===============================================================================================================================
+*/
+bool make_bench_data(bench_data_t *data, size_t count) {
+    C_ASSERT(data != NULL, false);
+
+    data->count       = count;
+    data->expected    = (quadratic_equation_t *)calloc(count, sizeof(quadratic_equation_t));
+    data->actual      = (quadratic_equation_t *)calloc(count, sizeof(quadratic_equation_t));
+    data->text        = (char *)calloc(count, BENCH_LINE_LENGTH);
+    data->lines       = tmpfile();
+    data->null_stream = fopen(NULL_STREAM_NAME, "w");
+    if(data->expected == NULL || data->actual == NULL || data->text == NULL ||
+       data->lines == NULL || data->null_stream == NULL)
+        return false;
+
+    uint64_t state = 0x9E3779B97F4A7C15;
+    for(size_t index = 0; index < count; index++) {
+        make_equation(&data->expected[index], index, &state);
+
+        int length = snprintf(data->text + data->text_size, BENCH_LINE_LENGTH, "%.17lg %.17lg %.17lg %.17lg %.17lg %d\n",
+                              data->expected[index].a,  data->expected[index].b,  data->expected[index].c,
+                              data->expected[index].x1, data->expected[index].x2, (int)data->expected[index].number);
+        if(length < 0 || (size_t)length >= BENCH_LINE_LENGTH)
+            return false;
+        data->text_size += (size_t)length;
+    }
+
+    return fwrite(data->text, 1, data->text_size, data->lines) == data->text_size;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Frees memory and closes files of benchmark inputs.
+
+===============================================================================================================================
+*/
+void free_bench_data(bench_data_t *data) {
+    C_ASSERT(data != NULL, );
+
+    free(data->expected);
+    free(data->actual);
+    free(data->text);
+    if(data->lines != NULL)
+        fclose(data->lines);
+    if(data->null_stream != NULL)
+        fclose(data->null_stream);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Makes equation of kind, that depends on index, and solves it.
+
+    @param   [out] equation           Pointer to equation.
+    @param   [in]  index              Index of equation.
+    @param   [out] state              State of random generator.
+
+===============================================================================================================================
+*/
+void make_equation(quadratic_equation_t *equation, size_t index, uint64_t *state) {
+    C_ASSERT(equation != NULL, );
+    C_ASSERT(state    != NULL, );
+
+    double a  = random_double(state, 0.5, 100);
+    double x1 = random_double(state, -1000, 1000);
+    double x2 = random_double(state, -1000, 1000);
+
+    switch(index % 5) {
+        case 0: {
+            //two roots
+            equation->a = a;
+            equation->b = -a * (x1 + x2);
+            equation->c = a * x1 * x2;
+            break;
+        }
+        case 1: {
+            //one root: a(x - x1)^2 with exactly representable coefficients
+            x1 = round(x1);
+            equation->a = 1;
+            equation->b = -2 * x1;
+            equation->c = x1 * x1;
+            break;
+        }
+        case 2: {
+            //no roots
+            equation->a = a;
+            equation->b = x1 / 1000;
+            equation->c = a + fabs(x2);
+            break;
+        }
+        case 3: {
+            //linear
+            equation->a = 0;
+            equation->b = a;
+            equation->c = x1;
+            break;
+        }
+        case 4: {
+            //infinitely many roots
+            equation->a = 0;
+            equation->b = 0;
+            equation->c = 0;
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+
+    solve_quadratic(equation);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns random number in [min, max) (xorshift64*).
+
+===============================================================================================================================
+*/
+double random_double(uint64_t *state, double min, double max) {
+    C_ASSERT(state != NULL, 0);
+
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    uint64_t random = *state * 0x2545F4914F6CDD1D;
+
+    return min + (max - min) * (double)(random >> 11) / (double)(UINT64_C(1) << 53);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Runs benchmark and prints its statistics.
+
+    @details - Variance is variance of time of one operation between measured runs (ns^2).
+
+    @param   [in]  name               Name of benchmark.
+    @param   [in]  function           Function, that passes over all equations once.
+    @param   [in]  data               Pointer to benchmark inputs.
+
+===============================================================================================================================
+*/
+void run_benchmark(const char *name, bench_function_t function, bench_data_t *data) {
+    C_ASSERT(name     != NULL, );
+    C_ASSERT(function != NULL, );
+    C_ASSERT(data     != NULL, );
+
+    for(size_t run = 0; run < BENCH_WARMUP_RUNS; run++)
+        bench_sink = bench_sink + function(data);
+
+    double times[BENCH_RUNS] = {};
+    for(size_t run = 0; run < BENCH_RUNS; run++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        bench_sink = bench_sink + function(data);
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+        times[run] = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / (double)data->count;
+    }
+
+    double mean = 0;
+    double min  = times[0];
+    for(size_t run = 0; run < BENCH_RUNS; run++) {
+        mean += times[run];
+        min = times[run] < min ? times[run] : min;
+    }
+    mean /= (double)BENCH_RUNS;
+
+    double variance = 0;
+    for(size_t run = 0; run < BENCH_RUNS; run++)
+        variance += (times[run] - mean) * (times[run] - mean);
+    variance /= (double)(BENCH_RUNS - 1);
+
+    printf("%-20s %12.2f %16.0f %14.4f %12.2f\n", name, mean, 1e9 / mean, variance, min);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves all equations with solve_quadratic(...).
+
+    @return  Number of equations with two roots.
+
+===============================================================================================================================
+*/
+size_t bench_solve_quadratic(bench_data_t *data) {
+    C_ASSERT(data != NULL, 0);
+
+    size_t two_roots = 0;
+    for(size_t index = 0; index < data->count; index++) {
+        quadratic_equation_t *equation = &data->actual[index];
+        equation->a = data->expected[index].a;
+        equation->b = data->expected[index].b;
+        equation->c = data->expected[index].c;
+
+        solve_quadratic(equation);
+        two_roots += equation->number == TWO_ROOTS;
+    }
+    return two_roots;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves equations, that repeat every BENCH_REPEATED_EQUATIONS, with solve_quadratic(...) and cache.
+
+    @return  Number of equations with two roots.
+
+===============================================================================================================================
+*/
+size_t bench_solve_quadratic_cached(bench_data_t *data) {
+    C_ASSERT(data != NULL, 0);
+
+    set_solve_cache_capacity(BENCH_REPEATED_EQUATIONS);
+
+    size_t two_roots = 0;
+    for(size_t index = 0; index < data->count; index++) {
+        quadratic_equation_t equation = data->expected[index % BENCH_REPEATED_EQUATIONS];
+
+        solve_quadratic(&equation);
+        two_roots += equation.number == TWO_ROOTS;
+    }
+
+    set_solve_cache_capacity(0);
+    return two_roots;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Reads all lines of tests file with read_expected_line(...).
+
+    @return  Number of lines that were read.
+
+===============================================================================================================================
+*/
+size_t bench_read_expected_line(bench_data_t *data) {
+    C_ASSERT(data != NULL, 0);
+
+    rewind(data->lines);
+
+    size_t lines = 0;
+    quadratic_equation_t equation = {};
+    while(read_expected_line(data->lines, &equation) == READING_SUCCESS)
+        lines++;
+    return lines;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Reads all records of tests text with read_expected_text(...).
+
+    @return  Number of records that were read.
+
+===============================================================================================================================
+*/
+size_t bench_read_expected_text(bench_data_t *data) {
+    C_ASSERT(data != NULL, 0);
+
+    text_reader_t reader = {};
+    init_text_reader(&reader, data->text, data->text_size);
+
+    size_t records = 0;
+    quadratic_equation_t equation = {};
+    while(read_expected_text(&reader, &equation) == READING_SUCCESS)
+        records++;
+    return records;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Compares expected roots with roots found by bench_solve_quadratic(...).
+
+    @return  Number of equal roots.
+
+===============================================================================================================================
+*/
+size_t bench_compare_roots(bench_data_t *data) {
+    C_ASSERT(data != NULL, 0);
+
+    size_t equal = 0;
+    for(size_t index = 0; index < data->count; index++)
+        equal += compare_roots(&data->expected[index], &data->actual[index]);
+    return equal;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Prints colored equations to null stream (one color_printf(...) per equation).
+
+    @return  Number of printed equations.
+
+===============================================================================================================================
+*/
+size_t bench_color_printf(bench_data_t *data) {
+    C_ASSERT(data != NULL, 0);
+
+    set_colors_enabled(true);
+    set_color_stream(data->null_stream);
+
+    for(size_t index = 0; index < data->count; index++)
+        color_printf(YELLOW_TEXT, false, DEFAULT_BACKGROUND, "%lgx^2 + %lgx + %lg",
+                     data->expected[index].a, data->expected[index].b, data->expected[index].c);
+    color_flush();
+
+    set_color_stream(stdout);
+    return data->count;
+}
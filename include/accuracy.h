@@ -0,0 +1,192 @@
+/**
+===============================================================================================================================
+    @file    accuracy.h
+    @brief   Header of library, allowing to measure errors of solve_quadratic() against high precision reference.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Every equation is solved with solve_quadratic_batch() (same results as solve_quadratic()
+               with current options) and with reference_quadratic_roots() in long double.\n
+             - Equations are split in blocks of GENERATE_BLOCK_SIZE, that are verified with all threads of pool,
+               every thread counts its own statistics, they are added after all blocks are done.\n
+             - Errors of roots are measured in ulp of double, equal to reference root.\n
+             - Equations, whose number of roots differs from reference, are counted by cause of misclassification.
+
+===============================================================================================================================
+*/
+
+#ifndef ACCURACY_H
+#define ACCURACY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "quadratic.h"
+#include "generator.h"
+#include "solve_stats.h"
+
+/**
+===============================================================================================================================
+    @brief   - Number of buckets of ulp errors histogram.
+
+    @details - Bucket 0 is errors up to 0.5 ulp (correctly rounded roots), bucket k is errors in (2^(k - 2), 2^(k - 1)],
+               the last bucket is all bigger errors (including infinite roots instead of finite ones).
+
+===============================================================================================================================
+*/
+static const size_t ACCURACY_ULP_BUCKETS = 64;
+
+enum accuracy_state_t {
+    ACCURACY_SUCCESS,
+    ACCURACY_INVALID_CONFIG,
+    ACCURACY_NO_FILE,
+    ACCURACY_INVALID_FILE,
+    ACCURACY_MEMORY_ERROR
+};
+
+/**
+===============================================================================================================================
+    @brief   - Causes of wrong number of roots.
+
+    @details - ACCURACY_A_AS_ZERO: a is not zero, but is_zero(a), so equation was solved as linear.\n
+             - ACCURACY_B_AS_ZERO: equation is linear, b is not zero, but is_zero(b).\n
+             - ACCURACY_C_AS_ZERO: a and b are zeros, c is not zero, but is_zero(c) (infinitely many roots instead of none).\n
+             - ACCURACY_DISCRIMINANT_AS_ZERO: discriminant b * b - 4 * a * c computed in double is not zero,
+               but is_zero() of it (one root instead of zero or two).\n
+             - ACCURACY_ROUNDING: other causes (rounded discriminant has wrong sign, overflow, etc.).\n
+             - The first four causes are caused by fixed EPSILON of is_zero().
+
+===============================================================================================================================
+*/
+enum accuracy_cause_t {
+    ACCURACY_A_AS_ZERO,
+    ACCURACY_B_AS_ZERO,
+    ACCURACY_C_AS_ZERO,
+    ACCURACY_DISCRIMINANT_AS_ZERO,
+    ACCURACY_ROUNDING,
+    ACCURACY_CAUSES_NUMBER
+};
+
+/**
+===============================================================================================================================
+    @brief   Histogram of ulp errors of roots.
+
+===============================================================================================================================
+*/
+struct ulp_histogram_t {
+    uint64_t buckets[ACCURACY_ULP_BUCKETS];
+    uint64_t roots;
+    double sum;
+    double max;
+};
+
+/**
+===============================================================================================================================
+    @brief   Results of verification.
+
+    @details - numbers[reference][solver] is number of equations with given numbers of roots
+               (indexes are number - INF_ROOTS, as in solve_stats_t).\n
+             - ulps[number - INF_ROOTS] is histogram of roots of equations, where solver found right number of roots.\n
+             - invalid is number of equations with not finite coefficients, they are not verified.
+
+===============================================================================================================================
+*/
+struct accuracy_stats_t {
+    uint64_t equations;
+    uint64_t invalid;
+    uint64_t numbers[STATS_ROOTS_NUMBERS][STATS_ROOTS_NUMBERS];
+    uint64_t misclassified;
+    uint64_t causes[ACCURACY_CAUSES_NUMBER];
+    ulp_histogram_t ulps[STATS_ROOTS_NUMBERS];
+};
+
+/**
+===============================================================================================================================
+    @brief   - Solves quadratic equation ax^2 + bx + c == 0 in long double without EPSILON.
+
+    @details - Coefficients are compared with zero exactly.\n
+             - Products of discriminant are computed without errors (Dekker's algorithm in long double,
+               that has no overflow and underflow for products of doubles), so its sign is exact
+               unless it is less than about 2^-100 of b^2.\n
+             - Roots are found without cancellation: q = -(b + sign(b) sqrt(D)) / 2, x = q / a and c / q.\n
+             - x1 and x2 are not changed if equation has zero or infinitely many roots.\n
+             - Coefficients must be finite.
+
+    @param   [in]  a                  Coefficient of x^2.
+    @param   [in]  b                  Coefficient of x.
+    @param   [in]  c                  Free coefficient.
+    @param   [out] x1                 Pointer to first root.
+    @param   [out] x2                 Pointer to second root.
+    @param   [out] number             Pointer to number of roots.
+
+===============================================================================================================================
+*/
+void reference_quadratic_roots(double a, double b, double c, long double *x1, long double *x2, roots_number_t *number);
+
+/**
+===============================================================================================================================
+    @brief   - Verifies count random equations of generate_coefficients() (see generator.h).
+
+    @details - Function returns ACCURACY_INVALID_CONFIG if config is invalid and ACCURACY_MEMORY_ERROR
+               if memory for threads could not be allocated.
+
+    @param   [in]  count              Number of equations.
+    @param   [in]  config             Pointer to settings of generator.
+    @param   [out] stats              Pointer to results (they are reset first).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+accuracy_state_t verify_accuracy_random(size_t count, const generator_config_t *config, accuracy_stats_t *stats);
+
+/**
+===============================================================================================================================
+    @brief   - Verifies equations given by columns of coefficients.
+
+    @param   [in]  a, b, c            Columns of coefficients.
+    @param   [in]  count              Number of equations.
+    @param   [out] stats              Pointer to results (they are reset first).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+accuracy_state_t verify_accuracy_columns(const double *a, const double *b, const double *c, size_t count,
+                                         accuracy_stats_t *stats);
+
+/**
+===============================================================================================================================
+    @brief   - Verifies equations of .qbin file or text file (see read_text_columns() in qbin.h).
+
+    @details - Function returns ACCURACY_NO_FILE if file could not be opened and ACCURACY_INVALID_FILE
+               if it is damaged .qbin file or text file with invalid line (its number is put to error_line).
+
+    @param   [in]  filename           Name of file.
+    @param   [in]  limit              Maximum number of equations (0 to verify all of them).
+    @param   [out] stats              Pointer to results (they are reset first).
+    @param   [out] error_line         Pointer to number of invalid line.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+accuracy_state_t verify_accuracy_file(const char *filename, size_t limit, accuracy_stats_t *stats, size_t *error_line);
+
+/**
+===============================================================================================================================
+    @brief   - Returns the biggest error of histogram bucket in ulp (infinity for the last bucket).
+
+===============================================================================================================================
+*/
+double ulp_bucket_limit(size_t bucket);
+
+/**
+===============================================================================================================================
+    @brief   - Returns name of cause of misclassification.
+
+===============================================================================================================================
+*/
+const char *accuracy_cause_name(accuracy_cause_t cause);
+
+#endif
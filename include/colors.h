@@ -11,6 +11,17 @@
 #ifndef COLORS_H
 #define COLORS_H
 
+#include <stdio.h>
+#include <stddef.h>
+
+/**
+===============================================================================================================================
+    @brief   - Size of per-thread buffer of color_printf(...).
+
+===============================================================================================================================
+*/
+static const size_t COLOR_BUFFER_SIZE = 1 << 14;
+
 enum color_t {
     RED_TEXT,
     GREEN_TEXT,
@@ -55,6 +66,10 @@ enum background_t {
                 + '%[]' -- scans many symbols.\n
                 + '%l...' -- long integer or double.\n
 
+             - Text is put to buffer of calling thread together with precomputed escape codes,
+               buffer is written to stdout (see set_color_stream()) when it is full, when color_flush() is called and when thread exits.\n
+             - Escape codes are not printed if colors are disabled (by default if stdout is not a terminal).\n
+
     @param   [in]  color              Enumerator that represants color of text.
     @param   [in]  string             String represanting format of console output.
 
@@ -62,4 +77,52 @@ enum background_t {
 */
 void color_printf(color_t color, bool is_bold, background_t background, const char *string, ...);
 
+/**
+===============================================================================================================================
+    @brief   - Writes buffer of calling thread to stdout.
+
+    @details - Must be called before reading from stdin and before printing to stdout without color_printf(...).
+
+===============================================================================================================================
+*/
+void color_flush(void);
+
+/**
+===============================================================================================================================
+    @brief   - Turns escape codes on or off.
+
+    @details - By default colors are enabled only if stdout is a terminal.
+
+    @param   [in]  enabled            Whether to print escape codes.
+
+===============================================================================================================================
+*/
+void set_colors_enabled(bool enabled);
+
+/**
+===============================================================================================================================
+    @brief   - Sets stream, that buffers are written to (stdout by default).
+
+    @details - Buffer of calling thread is flushed to previous stream first.
+
+    @param   [in]  stream             Opened stream.
+
+===============================================================================================================================
+*/
+void set_color_stream(FILE *stream);
+
+/**
+===============================================================================================================================
+    @brief   - Prints line number, file name and expression on which C_ASSERT macro gained error.
+
+    @details - Assert handler of program (see set_assert_handler()).
+
+    @param   [in]  string             Expression that is FALSE.
+    @param   [in]  line_number        Number of line in source code on which C_ASSERT gained error.
+    @param   [in]  filename           String with name of file in which C_ASSERT gained error.
+
+===============================================================================================================================
+*/
+void print_colored_assert_error(const char *string, int line_number, const char *filename);
+
 #endif
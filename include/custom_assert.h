@@ -14,25 +14,114 @@
 
 /**
 ===============================================================================================================================
-    @brief   - If NDEBUG is defined, asserts will be ommited.
+    @brief   - Levels of contract checking, level is chosen at build time with -DCONTRACT_LEVEL=N.
 
-    @details - C_ASSERT in case of error will print out file name,
-            line number and wrond expression and then termenate program.
+    @details - CONTRACTS_OFF: C_ASSERT is omitted, expression is not evaluated (release build).\n
+             - CONTRACTS_CHEAP: expression is checked and return_value is returned on error,
+               but error is not reported, so file names and expressions are not kept in program.\n
+             - CONTRACTS_FULL: expression is checked and error is reported to assert handler (debug build).\n
+             - CONTRACTS_SAMPLED: same as CONTRACTS_FULL, but only every CONTRACT_SAMPLE_RATE-th C_ASSERT
+               of thread is checked, so checks cost less and still catch errors that repeat.\n
+             - Default level is CONTRACTS_OFF if NDEBUG is defined and CONTRACTS_FULL if not.
 
 ===============================================================================================================================
 */
-#ifndef NDEBUG
-// TODO be able to handle return value
-#define C_ASSERT(expression, return_value) if(expression) {(void)0;} else {print_assert_error(#expression, __LINE__, __FILE__);return return_value;}
+#define CONTRACTS_OFF     0
+#define CONTRACTS_CHEAP   1
+#define CONTRACTS_FULL    2
+#define CONTRACTS_SAMPLED 3
+
+#ifndef CONTRACT_LEVEL
+#ifdef NDEBUG
+#define CONTRACT_LEVEL CONTRACTS_OFF
 #else
+#define CONTRACT_LEVEL CONTRACTS_FULL
+#endif
+#endif
+
+#ifndef CONTRACT_SAMPLE_RATE
+#define CONTRACT_SAMPLE_RATE 64
+#endif
+
+#if CONTRACT_LEVEL == CONTRACTS_SAMPLED
+/**
+===============================================================================================================================
+    @brief   - Counts C_ASSERT of calling thread in CONTRACTS_SAMPLED level.
+
+    @return  True if C_ASSERT is skipped (false for every CONTRACT_SAMPLE_RATE-th call).
+
+===============================================================================================================================
+*/
+bool skip_sampled_contract(void);
+
+/**
+===============================================================================================================================
+    @brief   - Decides whether C_ASSERT is skipped in CONTRACTS_SAMPLED level.
+
+    @details - C_ASSERT is never skipped while constexpr function is evaluated by compiler.
+
+    @return  True if C_ASSERT is skipped.
+
+===============================================================================================================================
+*/
+constexpr bool skip_contract_check(void) {
+    if(__builtin_is_constant_evaluated())
+        return false;
+    return skip_sampled_contract();
+}
+#endif
+
+/**
+===============================================================================================================================
+    @brief   - Checks expression and returns return_value from function if it is false.
+
+    @details - C_ASSERT in case of error will pass file name,
+            line number and wrond expression to assert handler and return return_value (see levels above).\n
+             - Branch of error is marked as unlikely, so it does not take place in hot code.
+
+===============================================================================================================================
+*/
+#if CONTRACT_LEVEL == CONTRACTS_OFF
 #define C_ASSERT(expression, return_value) ((void)0);
+#elif CONTRACT_LEVEL == CONTRACTS_CHEAP
+#define C_ASSERT(expression, return_value) if(__builtin_expect(!!(expression), 1)) {(void)0;} else {return return_value;}
+#elif CONTRACT_LEVEL == CONTRACTS_FULL
+#define C_ASSERT(expression, return_value) if(__builtin_expect(!!(expression), 1)) {(void)0;} else {print_assert_error(#expression, __LINE__, __FILE__);return return_value;}
+#elif CONTRACT_LEVEL == CONTRACTS_SAMPLED
+#define C_ASSERT(expression, return_value) if(skip_contract_check() || __builtin_expect(!!(expression), 1)) {(void)0;} else {print_assert_error(#expression, __LINE__, __FILE__);return return_value;}
+#else
+#error "CONTRACT_LEVEL must be CONTRACTS_OFF, CONTRACTS_CHEAP, CONTRACTS_FULL or CONTRACTS_SAMPLED"
 #endif
 
 /**
 ===============================================================================================================================
-    @brief   - Prints line number, file name and expression on which C_ASSERT macro gained error.
+    @brief   - Function, that is called when C_ASSERT gained error.
+
+===============================================================================================================================
+*/
+typedef void (*assert_handler_t)(const char *string, int line_number, const char *filename);
+
+/**
+===============================================================================================================================
+    @brief   - Sets function, that reports errors of C_ASSERT.
+
+    @details - There is no handler by default, so library does not print anything
+               (program sets handler, that prints error in console).\n
+             - NULL removes handler.\n
+             - Handler must be set before other threads are started.
+
+    @param   [in]  handler            Pointer to handler or NULL.
+
+===============================================================================================================================
+*/
+void set_assert_handler(assert_handler_t handler);
+
+/**
+===============================================================================================================================
+    @brief   - Passes line number, file name and expression on which C_ASSERT macro gained error to assert handler.
 
-    @details - Deos not terminate program after use.
+    @details - Deos not terminate program after use.\n
+             - Does nothing if handler is not set (see set_assert_handler()).
 
     @param   [in]  string             Expression that is FALSE.
     @param   [in]  line_number        Number of line in source code on which C_ASSERT gained error.
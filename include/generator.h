@@ -0,0 +1,180 @@
+/**
+===============================================================================================================================
+    @file    generator.h
+    @brief   Header of library, allowing to generate big random workloads of quadratic equations.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Every equation belongs to one of generator_class_t classes,
+               class is chosen randomly with weights of generator_config_t.\n
+             - Coefficients are built from roots with short mantissas, so two roots, one root and no roots classes
+               are exact (for example discriminant of GENERATE_ONE_ROOT is exactly zero).\n
+             - Equations are generated by blocks of GENERATE_BLOCK_SIZE with all threads of pool,
+               every block has its own xoshiro256** generator seeded from seed and number of block,
+               so output depends only on seed and does not depend on number of threads.\n
+             - Expected roots are found with solve_quadratic_precise_roots(), so they follow rules of solver
+               (for example equation with is_zero(a) is solved as linear, whatever its class is).
+
+===============================================================================================================================
+*/
+
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+===============================================================================================================================
+    @brief   - Number of equations generated by one task.
+
+===============================================================================================================================
+*/
+static const size_t GENERATE_BLOCK_SIZE = 1 << 14;
+
+/**
+===============================================================================================================================
+    @brief   - Maximum value of max_exponent, so products of coefficients do not overflow.
+
+===============================================================================================================================
+*/
+static const int MAX_GENERATE_EXPONENT = 300;
+
+enum generator_class_t {
+    GENERATE_TWO_ROOTS,
+    GENERATE_ONE_ROOT,
+    GENERATE_NO_ROOTS,
+    GENERATE_LINEAR,
+    GENERATE_INF_ROOTS,
+    GENERATE_NEAR_ZERO_DISCRIMINANT,
+    GENERATE_ILL_CONDITIONED,
+    GENERATE_CLASSES_NUMBER
+};
+
+enum generator_format_t {
+    GENERATE_TEXT,
+    GENERATE_QBIN
+};
+
+enum generator_state_t {
+    GENERATOR_SUCCESS,
+    GENERATOR_INVALID_CONFIG,
+    GENERATOR_WRITING_ERROR,
+    GENERATOR_MEMORY_ERROR
+};
+
+/**
+===============================================================================================================================
+    @brief   Settings of generator.
+
+    @details - weights[class] is relative frequency of class (at least one weight must be positive).\n
+             - Magnitudes of roots and of a are 2^e with e in [-max_exponent, max_exponent].\n
+             - If with_results is true, text lines are "a b c x1 x2 roots_number" (format of tests files),
+               otherwise they are "a b c".
+
+===============================================================================================================================
+*/
+struct generator_config_t {
+    uint64_t seed;
+    uint32_t weights[GENERATE_CLASSES_NUMBER];
+    int max_exponent;
+    bool with_results;
+    generator_format_t format;
+};
+
+/**
+===============================================================================================================================
+    @brief   Number of generated equations of every class.
+
+===============================================================================================================================
+*/
+struct generator_stats_t {
+    uint64_t classes[GENERATE_CLASSES_NUMBER];
+};
+
+/**
+===============================================================================================================================
+    @brief   - Fills config with default settings.
+
+    @details - Default is seed 1, text with results, max_exponent 16 and mix of 40% two roots, 10% one root,
+               20% no roots, 10% linear, 5% infinitely many roots, 10% near zero discriminant and 5% ill-conditioned.
+
+    @param   [out] config             Pointer to settings.
+
+===============================================================================================================================
+*/
+void init_generator_config(generator_config_t *config);
+
+/**
+===============================================================================================================================
+    @brief   - Changes one setting given as "key=value".
+
+    @details - Keys are "seed", "scale" (max_exponent), "results" (0 or 1) and names of classes
+               ("two", "one", "none", "linear", "inf", "near", "ill") with weights.
+
+    @param   [out] config             Pointer to settings.
+    @param   [in]  setting            String "key=value".
+
+    @return  False if key is unknown or value is invalid.
+
+===============================================================================================================================
+*/
+bool parse_generator_setting(generator_config_t *config, const char *setting);
+
+/**
+===============================================================================================================================
+    @brief   - Returns name of class, that is used in settings.
+
+===============================================================================================================================
+*/
+const char *generator_class_name(generator_class_t generator_class);
+
+/**
+===============================================================================================================================
+    @brief   - Generates count equations and writes them to output.
+
+    @details - For GENERATE_QBIN output must be opened in binary mode and must allow seeking.\n
+             - Function returns:\n
+                + GENERATOR_SUCCESS if all equations were written.\n
+                + GENERATOR_INVALID_CONFIG if all weights are zero or max_exponent is out of [0, MAX_GENERATE_EXPONENT].\n
+                + GENERATOR_WRITING_ERROR if output could not be written.\n
+                + GENERATOR_MEMORY_ERROR if memory for blocks could not be allocated.
+
+    @param   [in]  output             Opened file.
+    @param   [in]  count              Number of equations.
+    @param   [in]  config             Pointer to settings.
+    @param   [out] stats              Pointer to counters of classes (they are reset first).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+generator_state_t generate_equations(FILE *output, size_t count, const generator_config_t *config, generator_stats_t *stats);
+
+/**
+===============================================================================================================================
+    @brief   - Generates coefficients of equations [first, first + count) without solving them.
+
+    @details - Coefficients are the same as in generate_equations() with the same config,
+               so other modes can check solvers on workload without writing it to file.
+
+             - first must be multiple of GENERATE_BLOCK_SIZE and count must not be bigger than GENERATE_BLOCK_SIZE.
+
+             - Function returns false if config is invalid (see generate_equations()).
+
+    @param   [in]  config             Pointer to settings.
+    @param   [in]  first              Number of the first equation.
+    @param   [in]  count              Number of equations.
+    @param   [out] a, b, c            Columns of coefficients (at least count elements).
+    @param   [out] stats              Pointer to counters of classes (they are reset first).
+
+    @return  True if coefficients were generated.
+
+===============================================================================================================================
+*/
+bool generate_coefficients(const generator_config_t *config, size_t first, size_t count,
+                           double *a, double *b, double *c, generator_stats_t *stats);
+
+#endif
@@ -0,0 +1,33 @@
+/**
+===============================================================================================================================
+    @file    golden_tests.h
+    @brief   Tests from "tests.txt" as constant table.
+
+    @details - File is generated with '--embed-tests', do not edit it.
+             - Numbers are written in hexadecimal form, so they are the same as numbers read from tests file.
+
+===============================================================================================================================
+*/
+
+#ifndef GOLDEN_TESTS_H
+#define GOLDEN_TESTS_H
+
+#include <stddef.h>
+#include "quadratic.h"
+
+static constexpr quadratic_equation_t GOLDEN_TESTS[] = {
+    {0x1p+0, 0x1p+1, 0x1p+0, -0x1p+0, -0x1p+0, ONE_ROOT},
+    {0x1p-1, 0x1p-1, 0x1p-1, 0x0p+0, 0x0p+0, NO_ROOTS},
+    {0x1.8p+1, 0x1.4p+2, 0x1p+1, -0x1p+0, -0x1.555555555ca9dp-1, TWO_ROOTS},
+    {0x1p+0, -0x1.3f5c28f5c28f6p+4, -0x1.a5d916872b021p+6, 0x1.84ccccccccccdp+4, -0x1.15c28f5c28f5cp+2, TWO_ROOTS},
+    {0x1p+0, -0x1.3f5c28f5c28f6p+4, -0x1.a5d916872b021p+6, -0x1.15c28f5c28f5cp+2, 0x1.84ccccccccccdp+4, TWO_ROOTS},
+    {0x0p+0, 0x1.cp+2, 0x0p+0, 0x0p+0, 0x0p+0, ONE_ROOT},
+    {0x1p+0, 0x1.0f5c28f5c28f6p+1, -0x1.6d0e560418937p+3, 0x1.3d70a3d70a3d7p+1, -0x1.2666666666666p+2, TWO_ROOTS},
+    {0x1.47ae147ae147bp-7, -0x1.628cbd1244a62p-4, 0x1.79e9d0e991ff7p-3, 0x1.36c8b43958106p+2, 0x1.e666666666666p+1, TWO_ROOTS},
+    {0x1p+0, 0x0p+0, -0x1.5798ee2308c3ap-27, 0x1.a36e2eb1c432dp-14, -0x1.a36e2eb1c432dp-14, TWO_ROOTS},
+    {0x1p+0, 0x1.8p+1, 0x1p+0, -0x1.8722191a02d5ep-2, -0x1.4f1bbcdcbfa54p+1, TWO_ROOTS},
+};
+
+static const size_t GOLDEN_TESTS_NUMBER = sizeof(GOLDEN_TESTS) / sizeof(GOLDEN_TESTS[0]);
+
+#endif
@@ -22,7 +22,9 @@ enum exit_code_t {
     @brief   - Defines the mode in which program will run.
 
     @details - Allows to use --help, --solve and --test flags.\n
-             - Starting program without a flag is considered as solving mode.
+             - Starting program without a flag is considered as solving mode.\n
+             - Options (for example '--threads N') can be placed anywhere, they are handled
+               and removed before arguments are passed to mode.
 
     @param   [in]  argc               Number of strings in argv.
     @param   [in]  argv               Array of strings with flags.
@@ -32,6 +32,18 @@ exit_code_t handle_help(const int argc, const char *argv[]);
 */
 exit_code_t handle_solve(const int argc, const char *argv[]);
 
+/**
+===============================================================================================================================
+    @brief   - Stream solving mode.
+
+    @details - Usage: '--solve-stream (input) (output)', "-" or missing file name means stdin (stdout).\n
+             - Reads "a b c" lines and writes "a b c x1 x2 roots_number" lines (see solve_stream()).\n
+             - Does not print prompts and colors, errors are printed to stderr.
+
+===============================================================================================================================
+*/
+exit_code_t handle_solve_stream(const int argc, const char *argv[]);
+
 /**
 ===============================================================================================================================
     @brief   - Test mode.
@@ -43,4 +55,151 @@ exit_code_t handle_solve(const int argc, const char *argv[]);
 */
 exit_code_t handle_test(const int argc, const char *argv[]);
 
+/**
+===============================================================================================================================
+    @brief   - Batch test mode.
+
+    @details - Solves equations from file (default "tests.txt") and random equations with every vectorized kernel.\n
+             - Prints number of results that differ from solve_quadratic().
+
+===============================================================================================================================
+*/
+exit_code_t handle_test_batch(const int argc, const char *argv[]);
+
+/**
+===============================================================================================================================
+    @brief   - Converts text file with coefficients or tests to .qbin file.
+
+    @details - Usage: '--to-qbin (text file) (qbin file)'.
+
+===============================================================================================================================
+*/
+exit_code_t handle_to_qbin(const int argc, const char *argv[]);
+
+/**
+===============================================================================================================================
+    @brief   - Converts .qbin file to text file.
+
+    @details - Usage: '--from-qbin (qbin file) (text file)', "-" or missing file name means stdout.
+
+===============================================================================================================================
+*/
+exit_code_t handle_from_qbin(const int argc, const char *argv[]);
+
+/**
+===============================================================================================================================
+    @brief   - Writes tests file as header with constexpr table of tests.
+
+    @details - Usage: '--embed-tests (tests file) (header)', default tests file is "tests.txt",
+               "-" or missing header name means stdout.\n
+             - Header is include/golden_tests.h, it is compiled into program for '--self-test'.
+
+===============================================================================================================================
+*/
+exit_code_t handle_embed_tests(const int argc, const char *argv[]);
+
+/**
+===============================================================================================================================
+    @brief   - Runs tests, that are compiled into program, without reading any files.
+
+===============================================================================================================================
+*/
+exit_code_t handle_self_test(const int argc, const char *argv[]);
+
+/**
+===============================================================================================================================
+    @brief   - Server mode.
+
+    @details - Usage: '--serve (port or socket path)', protocol is described in solve_server.h.\n
+             - Server works until Ctrl+C, then counters and latency percentiles are printed.
+
+===============================================================================================================================
+*/
+exit_code_t handle_serve(const int argc, const char *argv[]);
+
+/**
+===============================================================================================================================
+    @brief   - Load mode, that sends random equations to '--serve' and checks replies.
+
+    @details - Usage: '--load (port or socket path) (connections) (requests)',
+               default is 4 connections and 100000 requests.\n
+             - Throughput, latency percentiles and number of wrong replies are printed.
+
+===============================================================================================================================
+*/
+exit_code_t handle_load(const int argc, const char *argv[]);
+
+/**
+===============================================================================================================================
+    @brief   - Shared memory server mode.
+
+    @details - Usage: '--shm (name)', protocol is described in shm_ring.h.\n
+             - Server works until Ctrl+C, then counters are printed.
+
+===============================================================================================================================
+*/
+exit_code_t handle_shm(const int argc, const char *argv[]);
+
+/**
+===============================================================================================================================
+    @brief   - Mode, that measures round trips of solve_quadratic_shm() to '--shm' server and checks replies.
+
+    @details - Usage: '--shm-ping (name) (requests)', default is 100000 requests.
+
+===============================================================================================================================
+*/
+exit_code_t handle_shm_ping(const int argc, const char *argv[]);
+
+/**
+===============================================================================================================================
+    @brief   - Mode, that writes N random equations to file (see generator.h).
+
+    @details - Usage: '--generate N [out] [key=value ...]', default output is stdout.\n
+             - Output, whose name ends with ".qbin", is written as .qbin file, other outputs as text.\n
+             - Settings are seed, scale, results and weights of classes (see parse_generator_setting()).
+
+===============================================================================================================================
+*/
+exit_code_t handle_generate(const int argc, const char *argv[]);
+
+/**
+===============================================================================================================================
+    @brief   - Mode, that compares roots of solve_quadratic() with long double reference (see accuracy.h).
+
+    @details - Usage: '--verify-accuracy N [file] [key=value ...]'.\n
+             - Without file N random equations are verified, settings are the same as in '--generate'.\n
+             - With .qbin or text file the first N equations are verified (all if N is 0).\n
+             - Prints table of roots numbers, causes of misclassifications and histograms of ulp errors to stdout.
+
+===============================================================================================================================
+*/
+exit_code_t handle_verify_accuracy(const int argc, const char *argv[]);
+
+/**
+===============================================================================================================================
+    @brief   - Mode, that finds only numbers of roots of equations (see classify_quadratic_batch()).
+
+    @details - Usage: '--count-only (file) [codes]'.\n
+             - File is .qbin or text file (see read_text_columns() in qbin.h).\n
+             - Without codes file prints how many equations have every number of roots to stdout,
+               otherwise writes roots_number_t of every equation to codes file, one per line.\n
+             - Time of classification is printed to stderr.
+
+===============================================================================================================================
+*/
+exit_code_t handle_count_only(const int argc, const char *argv[]);
+
+/**
+===============================================================================================================================
+    @brief   - Mode, that solves every equation of grid of coefficients (see sweep.h).
+
+    @details - Usage: '--sweep a=A0:A1:DA b=B0:B1:DB c=C0:C1:DC [out]', default output is stdout.\n
+             - Omitted axes are a=1, b=0 and c=0, axis can be single value ("a=1").\n
+             - Output, whose name ends with ".qbin", is written as .qbin file, other outputs as text with roots.\n
+             - Numbers of equations with every number of roots are printed to stderr.
+
+===============================================================================================================================
+*/
+exit_code_t handle_sweep(const int argc, const char *argv[]);
+
 #endif
@@ -0,0 +1,102 @@
+/**
+===============================================================================================================================
+    @file    latency_histogram.h
+    @brief   Header of library, allowing to collect latencies and find their percentiles without keeping every sample.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Latencies are in nanoseconds.\n
+             - Every power of two is split to LATENCY_SUB_BUCKETS buckets,
+               so percentiles are found with relative error less than 1 / LATENCY_SUB_BUCKETS.
+
+===============================================================================================================================
+*/
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+===============================================================================================================================
+    @brief   - Number of buckets per power of two.
+
+===============================================================================================================================
+*/
+static const size_t LATENCY_SUB_BUCKETS = 8;
+
+/**
+===============================================================================================================================
+    @brief   - Number of buckets, that cover all uint64_t values.
+
+===============================================================================================================================
+*/
+static const size_t LATENCY_BUCKETS = 64 * LATENCY_SUB_BUCKETS;
+
+/**
+===============================================================================================================================
+    @brief   Histogram of latencies.
+
+    @details - Zero initialized histogram is empty.
+
+===============================================================================================================================
+*/
+struct latency_histogram_t {
+    uint64_t counts[LATENCY_BUCKETS];
+    uint64_t samples;
+    uint64_t sum;
+    uint64_t max;
+};
+
+/**
+===============================================================================================================================
+    @brief   - Adds latency to histogram.
+
+    @param   [out] histogram          Pointer to histogram.
+    @param   [in]  nanoseconds        Latency.
+
+===============================================================================================================================
+*/
+void add_latency(latency_histogram_t *histogram, uint64_t nanoseconds);
+
+/**
+===============================================================================================================================
+    @brief   - Adds all samples of one histogram to another.
+
+    @param   [out] histogram          Pointer to histogram that receives samples.
+    @param   [in]  other              Pointer to added histogram.
+
+===============================================================================================================================
+*/
+void merge_latency_histograms(latency_histogram_t *histogram, const latency_histogram_t *other);
+
+/**
+===============================================================================================================================
+    @brief   - Finds latency, that is not less than given part of samples.
+
+    @details - Upper bound of bucket is returned (but not more than the maximum latency).\n
+             - 0 is returned for empty histogram.
+
+    @param   [in]  histogram          Pointer to histogram.
+    @param   [in]  percentile         Percentile in [0, 100].
+
+    @return  Latency in nanoseconds.
+
+===============================================================================================================================
+*/
+uint64_t latency_percentile(const latency_histogram_t *histogram, double percentile);
+
+/**
+===============================================================================================================================
+    @brief   - Prints number of samples, mean, p50, p90, p99, p99.9 and maximum latency in microseconds.
+
+    @param   [in]  name               Name of histogram, that is printed first.
+    @param   [in]  histogram          Pointer to histogram.
+
+===============================================================================================================================
+*/
+void print_latency_histogram(const char *name, const latency_histogram_t *histogram);
+
+#endif
@@ -0,0 +1,30 @@
+/**
+===============================================================================================================================
+    @file    libquadratic.h
+    @brief   Header of libquadratic, that allows to embed solver of quadratic equations in other programs.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Library is built with 'make lib' as static (libquadratic.a) and shared (libquadratic.so) library.\n
+             - Library does not use stdio and does not print anything, errors are returned as codes.\n
+             - Errors of C_ASSERT are passed to handler set with set_assert_handler() (nothing is done by default).\n
+             - Solving options (precise mode, cache, number of threads) are global and must be set
+               before equations are solved from several threads.
+
+===============================================================================================================================
+*/
+
+#ifndef LIBQUADRATIC_H
+#define LIBQUADRATIC_H
+
+#include "custom_assert.h"
+#include "quadratic.h"
+#include "quadratic_batch.h"
+#include "quadratic_dedup.h"
+#include "quadratic_precise.h"
+#include "solve_cache.h"
+#include "thread_pool.h"
+#include "utils.h"
+
+#endif
@@ -0,0 +1,87 @@
+/**
+===============================================================================================================================
+    @file    load_client.h
+    @brief   Header of library, allowing to load server of solve_server.h with requests and measure its latency.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Every connection keeps LOAD_WINDOW requests in flight (sends next request when reply comes).\n
+             - Coefficients are random multiples of 1/8 (every eighth equation is linear),
+               so they are written and read without rounding.\n
+             - Every reply is compared with result of solve_quadratic_batch() in client,
+               so client must be run with the same solving options (for example '--precise') as server.
+
+===============================================================================================================================
+*/
+
+#ifndef LOAD_CLIENT_H
+#define LOAD_CLIENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "latency_histogram.h"
+
+/**
+===============================================================================================================================
+    @brief   - Number of requests, that every connection sends without waiting for replies.
+
+===============================================================================================================================
+*/
+static const size_t LOAD_WINDOW = 64;
+
+/**
+===============================================================================================================================
+    @brief   - Maximum number of connections.
+
+===============================================================================================================================
+*/
+static const size_t MAX_LOAD_CONNECTIONS = 1024;
+
+enum load_state_t {
+    LOAD_SUCCESS,
+    LOAD_CONNECTION_ERROR,
+    LOAD_PROTOCOL_ERROR,
+    LOAD_MEMORY_ERROR,
+    LOAD_UNSUPPORTED
+};
+
+/**
+===============================================================================================================================
+    @brief   Results of load.
+
+    @details - Latency of request is time from sending of request to receiving of its reply.
+
+===============================================================================================================================
+*/
+struct load_stats_t {
+    uint64_t requests;
+    uint64_t mismatches;
+    double seconds;
+    latency_histogram_t latency;
+};
+
+/**
+===============================================================================================================================
+    @brief   - Sends requests to server through several connections and checks replies.
+
+    @details - Function returns:\n
+                + LOAD_SUCCESS if all replies were received (some of them can be wrong, see stats->mismatches).\n
+                + LOAD_CONNECTION_ERROR if connection could not be opened, or it was closed by server,
+                  or server did not reply for LOAD_TIMEOUT_MILLISECONDS.\n
+                + LOAD_PROTOCOL_ERROR if reply is too long.\n
+                + LOAD_MEMORY_ERROR if memory could not be allocated.\n
+                + LOAD_UNSUPPORTED if system is not Linux.
+
+    @param   [in]  address            Port number or path of unix socket.
+    @param   [in]  connections        Number of connections in [1, MAX_LOAD_CONNECTIONS].
+    @param   [in]  requests           Total number of requests, they are split between connections.
+    @param   [out] stats              Pointer to results (they are reset first).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+load_state_t run_load(const char *address, size_t connections, size_t requests, load_stats_t *stats);
+
+#endif
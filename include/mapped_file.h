@@ -0,0 +1,64 @@
+/**
+===============================================================================================================================
+    @file    mapped_file.h
+    @brief   Header of library, allowing to map files to memory for reading.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <stddef.h>
+
+/**
+===============================================================================================================================
+    @brief   Read-only view of file contents.
+
+===============================================================================================================================
+*/
+struct mapped_file_t {
+    const char *data;
+    size_t size;
+    bool is_mapped;
+};
+
+enum mapping_state_t {
+    MAPPING_SUCCESS,
+    MAPPING_NO_FILE,
+    MAPPING_ERROR
+};
+
+/**
+===============================================================================================================================
+    @brief   - Maps file to memory.
+
+    @details - Uses mmap() on POSIX systems, on other systems file is read to allocated buffer.\n
+             - Function returns:\n
+                + MAPPING_SUCCESS if file was mapped.\n
+                + MAPPING_NO_FILE if file could not be opened.\n
+                + MAPPING_ERROR if file could not be mapped or read.
+
+    @param   [in]  filename           Name of file.
+    @param   [out] file               Pointer to structure that receives view of file.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+mapping_state_t map_file(const char *filename, mapped_file_t *file);
+
+/**
+===============================================================================================================================
+    @brief   - Unmaps file mapped with map_file().
+
+    @param   [out] file               Pointer to mapped file.
+
+===============================================================================================================================
+*/
+void unmap_file(mapped_file_t *file);
+
+#endif
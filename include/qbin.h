@@ -0,0 +1,280 @@
+/**
+===============================================================================================================================
+    @file    qbin.h
+    @brief   Header of library, allowing to read and write binary columnar files of equations (.qbin).
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details Layout of .qbin file:\n
+             - Header (qbin_header_t, 64 bytes).\n
+             - Columns a, b and c (count doubles each).\n
+             - If QBIN_HAS_RESULTS flag is set, columns x1 and x2 (count doubles each)
+               and column of roots numbers (count int8_t, padded with zeros to multiple of 8 bytes).\n
+             All numbers are stored in byte order of machine that wrote the file, columns are aligned to 8 bytes,
+             so mapped file can be passed to batch solvers without copying.
+
+===============================================================================================================================
+*/
+
+#ifndef QBIN_H
+#define QBIN_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "mapped_file.h"
+
+/**
+===============================================================================================================================
+    @brief   - Current version of .qbin format.
+
+===============================================================================================================================
+*/
+static const uint32_t QBIN_VERSION = 1;
+
+/**
+===============================================================================================================================
+    @brief   - Value of endianness field, it is read as 0x04030201 on machines with other byte order.
+
+===============================================================================================================================
+*/
+static const uint32_t QBIN_ENDIANNESS = 0x01020304;
+
+enum qbin_flags_t {
+    QBIN_HAS_RESULTS  = 1,
+    QBIN_HAS_CHECKSUM = 2
+};
+
+enum qbin_state_t {
+    QBIN_SUCCESS,
+    QBIN_NO_FILE,
+    QBIN_INVALID_FILE,
+    QBIN_WRONG_ENDIANNESS,
+    QBIN_CHECKSUM_ERROR,
+    QBIN_WRITING_ERROR,
+    QBIN_MEMORY_ERROR
+};
+
+/**
+===============================================================================================================================
+    @brief   Header of .qbin file.
+
+    @details checksum is FNV-1a hash of 64-bit words of all columns (0 if QBIN_HAS_CHECKSUM is not set).
+
+===============================================================================================================================
+*/
+struct qbin_header_t {
+    char magic[4];
+    uint32_t version;
+    uint32_t endianness;
+    uint32_t flags;
+    uint64_t count;
+    uint64_t checksum;
+    uint8_t reserved[32];
+};
+
+/**
+===============================================================================================================================
+    @brief   Columns of mapped .qbin file (x1, x2 and number are NULL if file has no results).
+
+===============================================================================================================================
+*/
+struct qbin_view_t {
+    mapped_file_t file;
+    size_t count;
+    const double *a, *b, *c;
+    const double *x1, *x2;
+    const int8_t *number;
+};
+
+/**
+===============================================================================================================================
+    @brief   Growing columns of equations read from text file.
+
+    @details - x1, x2 and number are filled only if has_results is true.
+
+===============================================================================================================================
+*/
+struct qbin_columns_t {
+    double *a, *b, *c;
+    double *x1, *x2;
+    int8_t *number;
+    size_t size;
+    size_t capacity;
+    bool has_results;
+};
+
+/**
+===============================================================================================================================
+    @brief   - Checks if file starts with .qbin magic.
+
+    @param   [in]  filename           Name of file.
+
+    @return  True if file is .qbin file and false if not (or if it can not be opened).
+
+===============================================================================================================================
+*/
+bool is_qbin_file(const char *filename);
+
+/**
+===============================================================================================================================
+    @brief   - Maps .qbin file and finds its columns.
+
+    @details - Function returns:\n
+                + QBIN_SUCCESS if file was opened.\n
+                + QBIN_NO_FILE if there is no such file.\n
+                + QBIN_INVALID_FILE if header or size of file is invalid.\n
+                + QBIN_WRONG_ENDIANNESS if file was written on machine with other byte order.\n
+                + QBIN_CHECKSUM_ERROR if verify_checksum is true and checksum is wrong.
+
+    @param   [in]  filename           Name of file.
+    @param   [out] view               Pointer to structure that receives columns.
+    @param   [in]  verify_checksum    Whether to check checksum (if file has it).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+qbin_state_t open_qbin(const char *filename, qbin_view_t *view, bool verify_checksum);
+
+/**
+===============================================================================================================================
+    @brief   - Unmaps file opened with open_qbin().
+
+===============================================================================================================================
+*/
+void close_qbin(qbin_view_t *view);
+
+/**
+===============================================================================================================================
+    @brief   - Writes columns to .qbin file.
+
+    @details - x1, x2 and number must be all NULL (file without results) or all not NULL.
+
+    @param   [in]  output             Opened (in binary mode) file.
+    @param   [in]  a, b, c            Columns of coefficients.
+    @param   [in]  x1, x2, number     Columns of results (can be NULL).
+    @param   [in]  count              Number of equations.
+    @param   [in]  with_checksum      Whether to write checksum.
+
+    @return  QBIN_SUCCESS or QBIN_WRITING_ERROR.
+
+===============================================================================================================================
+*/
+qbin_state_t write_qbin(FILE *output, const double *a, const double *b, const double *c,
+                        const double *x1, const double *x2, const int8_t *number,
+                        size_t count, bool with_checksum);
+
+/**
+===============================================================================================================================
+    @brief   - Starts .qbin file, that is filled by write_qbin_rows() in any order.
+
+    @details - Header without checksum is written and file is extended to its full size,
+               so columns of count equations can be written later without keeping them in memory.\n
+             - Output must be opened in binary mode and must allow seeking (it can not be pipe).
+
+    @param   [in]  output             Opened file.
+    @param   [in]  count              Number of equations.
+    @param   [in]  has_results        Whether file has columns x1, x2 and roots numbers.
+
+    @return  QBIN_SUCCESS or QBIN_WRITING_ERROR.
+
+===============================================================================================================================
+*/
+qbin_state_t write_qbin_header(FILE *output, size_t count, bool has_results);
+
+/**
+===============================================================================================================================
+    @brief   - Writes rows [first, first + rows) of file started by write_qbin_header().
+
+    @details - x1, x2 and number must be NULL if file has no results and not NULL if it has.
+
+    @param   [in]  output             File started by write_qbin_header().
+    @param   [in]  count              Number of equations in file.
+    @param   [in]  first              Index of the first written row.
+    @param   [in]  rows               Number of written rows.
+    @param   [in]  a, b, c            Coefficients of rows.
+    @param   [in]  x1, x2, number     Results of rows (can be NULL).
+
+    @return  QBIN_SUCCESS or QBIN_WRITING_ERROR.
+
+===============================================================================================================================
+*/
+qbin_state_t write_qbin_rows(FILE *output, size_t count, size_t first, size_t rows,
+                             const double *a, const double *b, const double *c,
+                             const double *x1, const double *x2, const int8_t *number);
+
+/**
+===============================================================================================================================
+    @brief   - Reads text file to columns.
+
+    @details - Text file can contain "a b c" lines or test records "a b c x1 x2 roots_number",
+               format is detected by the first non-empty line.\n
+             - Function returns QBIN_INVALID_FILE if one of lines is invalid (its number is put to error_line),
+               columns must be freed with free_qbin_columns() only if QBIN_SUCCESS is returned.
+
+    @param   [in]  filename           Name of text file.
+    @param   [out] columns            Pointer to columns.
+    @param   [out] error_line         Number of invalid line.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+qbin_state_t read_text_columns(const char *filename, qbin_columns_t *columns, size_t *error_line);
+
+/**
+===============================================================================================================================
+    @brief   - Frees columns read by read_text_columns().
+
+===============================================================================================================================
+*/
+void free_qbin_columns(qbin_columns_t *columns);
+
+/**
+===============================================================================================================================
+    @brief   - Converts text file to .qbin file.
+
+    @details - Text file can contain "a b c" lines or test records "a b c x1 x2 roots_number",
+               format is detected by the first non-empty line.\n
+             - Checksum is always written.\n
+             - Function returns QBIN_INVALID_FILE if one of lines is invalid (its number is put to error_line).
+
+    @param   [in]  input_name         Name of text file.
+    @param   [in]  output_name        Name of .qbin file.
+    @param   [out] count              Number of converted equations.
+    @param   [out] error_line         Number of invalid line.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+qbin_state_t convert_text_to_qbin(const char *input_name, const char *output_name, size_t *count, size_t *error_line);
+
+/**
+===============================================================================================================================
+    @brief   - Converts .qbin file to text file.
+
+    @details - Writes "a b c" lines or "a b c x1 x2 roots_number" lines (if file has results)
+               with 17 significant digits.
+
+    @param   [in]  input_name         Name of .qbin file.
+    @param   [in]  output             Opened text file.
+    @param   [out] count              Number of converted equations.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+qbin_state_t convert_qbin_to_text(const char *input_name, FILE *output, size_t *count);
+
+/**
+===============================================================================================================================
+    @brief   - Returns description of qbin_state_t value.
+
+===============================================================================================================================
+*/
+const char *qbin_state_message(qbin_state_t state);
+
+#endif
@@ -1,7 +1,7 @@
 /**
 ===============================================================================================================================
     @file    quadratic.h
-    @brief   Header of library to enter, solve and print quadratic equations.
+    @brief   Header of library to solve quadratic equations.
     @date    23.08.2024
     @author  Artem Neskorodov
     @link    https://vk.com/neskorodovartem
@@ -42,31 +42,6 @@ enum solving_state_t {
     INVALID_COEFFICIENTS
 };
 
-enum getting_coeffs_state_t {
-    GETTING_SUCCESS,
-    GETTING_EXIT,
-    GETTING_ERROR
-};
-
-/**
-===============================================================================================================================
-    @brief   - Writes coefficients, that user typed, in in equation struct.
-
-    @details - Function asks user to type in coefficients of quadratic equation.\n
-             - It will ask user until he/she type in valid double number or word "exit".\n
-             - Function returns:\n
-                + GETTING_SUCCESS (in case of successful writing users inputs to equation fields).\n
-                + GETTING_EXIT (in case of typed in word "exit" by user).\n
-                + There are no other return values.
-
-    @param   [out] equation           Pointer to quadratic equation struct.
-
-    @return  Error (or success) code.
-
-===============================================================================================================================
-*/
-getting_coeffs_state_t get_coefficients(quadratic_equation_t *equation);
-
 /**
 ===============================================================================================================================
     @brief   - Solves quadratic equation in form ax^2 + bx + c == 0.
@@ -84,7 +59,9 @@ getting_coeffs_state_t get_coefficients(quadratic_equation_t *equation);
                 + NO_ROOTS if equation has no real roots.\n
                 + ONE_ROOT if equation has one real root.\n
                 + TWO_ROOTS if equation has two real roots.\n
-                + INF_ROOTS if equation has infinitely many roots.
+                + INF_ROOTS if equation has infinitely many roots.\n
+             - In precise mode equation is solved with solve_quadratic_precise_roots() (see quadratic_precise.h).\n
+             - If cache is on, roots of repeated equations are taken from it (see solve_cache.h).
 
     @param   [out] equation           Point to equation structure, containing coefficients of quadratic equation.
 
@@ -96,12 +73,42 @@ solving_state_t solve_quadratic(quadratic_equation_t *equation);
 
 /**
 ===============================================================================================================================
-    @brief   - Prints roots of quadratic equation in console.
+    @brief   - Solves quadratic equation ax^2 + bx + c == 0 given by separate coefficients.
+
+    @details - Core of solve_quadratic(), shared with batch solvers.\n
+             - Return values and roots are the same as in solve_quadratic().\n
+             - x1 and x2 are not changed if equation has zero or infinitely many roots.
+
+    @param   [in]  a                  Coefficient of x^2.
+    @param   [in]  b                  Coefficient of x.
+    @param   [in]  c                  Free coefficient.
+    @param   [out] x1                 Pointer to first root.
+    @param   [out] x2                 Pointer to second root.
+    @param   [out] number             Pointer to number of roots.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+solving_state_t solve_quadratic_roots(double a, double b, double c, double *x1, double *x2, roots_number_t *number);
+
+/**
+===============================================================================================================================
+    @brief   - Finds number of roots of quadratic equation ax^2 + bx + c == 0 without finding roots.
+
+    @details - Number is the same as number found by solve_quadratic() with the same coefficients,
+               but square root of discriminant and divisions are skipped.\n
+             - In precise mode number is found by exact sign of discriminant (see quadratic_precise.h).\n
+             - Returns NOT_SOLVED if one of coefficients is not finite.
+
+    @param   [in]  a                  Coefficient of x^2.
+    @param   [in]  b                  Coefficient of x.
+    @param   [in]  c                  Free coefficient.
 
-    @param   [in]  equation           Pointer to equation struct, that is already solved.
+    @return  Number of roots.
 
 ===============================================================================================================================
 */
-void print_quadratic_result(const quadratic_equation_t *equation);
+roots_number_t classify_quadratic(double a, double b, double c);
 
 #endif
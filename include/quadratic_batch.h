@@ -0,0 +1,179 @@
+/**
+===============================================================================================================================
+    @file    quadratic_batch.h
+    @brief   Header of library, allowing to solve many quadratic equations stored as columns of coefficients.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#ifndef QUADRATIC_BATCH_H
+#define QUADRATIC_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "quadratic.h"
+
+/**
+===============================================================================================================================
+    @brief   - Number of counters of count_quadratic_roots(), counts[number - INF_ROOTS] is number of equations
+               with given roots_number_t (NOT_SOLVED is number of equations with not finite coefficients).
+
+===============================================================================================================================
+*/
+static const size_t ROOTS_COUNTS_NUMBER = TWO_ROOTS - INF_ROOTS + 1;
+
+/**
+===============================================================================================================================
+    @brief   - Solves n quadratic equations a[i]x^2 + b[i]x + c[i] == 0.
+
+    @details - Coefficients and results are stored as separate columns (structure of arrays).\n
+             - Every equation is solved with the same rules as solve_quadratic().\n
+             - Roots are written to x1[i] and x2[i], number of roots (roots_number_t) is written to number[i].\n
+             - If equation has zero or infinitely many roots x1[i] and x2[i] are set to 0.\n
+             - If one of coefficients is not finite number:\n
+                + number[i] is set to NOT_SOLVED and x1[i], x2[i] are set to 0.\n
+                + invalid[i] is set to 1 (invalid[i] is 0 for all other equations).\n
+             - invalid can be NULL if mask is not needed.\n
+             - Equations are solved with vectorized kernel chosen on startup (see quadratic_simd.h),
+               results are the same bit for bit as results of solve_quadratic().\n
+             - In precise mode (see quadratic_precise.h) equations are solved with solve_quadratic_batch_precise().\n
+             - If cache is on (see solve_cache.h), equations are solved with solve_quadratic_batch_cached().\n
+             - Function returns:\n
+                + SOLVING_SUCCESS (if all equations were solved).\n
+                + INVALID_COEFFICIENTS (if at least one equation has not finite coefficients).\n
+                + SOLVING_ERROR (in case of unexpected error).\n
+                + There are no other return values.
+
+    @param   [in]  a                  Column of coefficients of x^2.
+    @param   [in]  b                  Column of coefficients of x.
+    @param   [in]  c                  Column of free coefficients.
+    @param   [in]  n                  Number of equations.
+    @param   [out] x1                 Column of first roots.
+    @param   [out] x2                 Column of second roots.
+    @param   [out] number             Column of roots numbers.
+    @param   [out] invalid            Mask of equations with invalid coefficients (can be NULL).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+solving_state_t solve_quadratic_batch(const double *a, const double *b, const double *c, size_t n,
+                                      double *x1, double *x2, int8_t *number, uint8_t *invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Solves n quadratic equations with all threads of pool (see thread_pool.h).
+
+    @details - Columns are split in cache-sized chunks, every chunk is solved with solve_quadratic_batch().\n
+             - Arguments, results and return values are the same as in solve_quadratic_batch().
+
+===============================================================================================================================
+*/
+solving_state_t solve_quadratic_batch_parallel(const double *a, const double *b, const double *c, size_t n,
+                                               double *x1, double *x2, int8_t *number, uint8_t *invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Solves n quadratic equations one by one, without vectorized kernels.
+
+    @details - Arguments and return values are the same as in solve_quadratic_batch().\n
+             - Used as reference for vectorized kernels.
+
+===============================================================================================================================
+*/
+solving_state_t solve_quadratic_batch_scalar(const double *a, const double *b, const double *c, size_t n,
+                                             double *x1, double *x2, int8_t *number, uint8_t *invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Solves n quadratic equations with float coefficients and roots.
+
+    @details - Every equation is solved in float with the same rules as solve_quadratic_roots_generic<float>()
+               (see quadratic_generic.h), results are the same bit for bit.\n
+             - Vectors of float kernels have twice as many lanes as double ones, and columns take half of memory.\n
+             - Precise mode does not change float solver.\n
+             - Arguments, results and return values are the same as in solve_quadratic_batch().
+
+===============================================================================================================================
+*/
+solving_state_t solve_quadratic_batch_float(const float *a, const float *b, const float *c, size_t n,
+                                            float *x1, float *x2, int8_t *number, uint8_t *invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Solves n float quadratic equations with all threads of pool (see thread_pool.h).
+
+    @details - Columns are split in cache-sized chunks, every chunk is solved with solve_quadratic_batch_float().
+
+===============================================================================================================================
+*/
+solving_state_t solve_quadratic_batch_float_parallel(const float *a, const float *b, const float *c, size_t n,
+                                                     float *x1, float *x2, int8_t *number, uint8_t *invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Finds numbers of roots of n quadratic equations without finding roots.
+
+    @details - number[i] is the same as classify_quadratic(a[i], b[i], c[i]) and as number[i]
+               of solve_quadratic_batch(), but square roots and divisions are skipped.\n
+             - Equations are classified with vectorized kernel chosen on startup (see quadratic_simd.h),
+               in precise mode they are classified one by one with classify_quadratic_precise().\n
+             - invalid and return values are the same as in solve_quadratic_batch().
+
+    @param   [in]  a                  Column of coefficients of x^2.
+    @param   [in]  b                  Column of coefficients of x.
+    @param   [in]  c                  Column of free coefficients.
+    @param   [in]  n                  Number of equations.
+    @param   [out] number             Column of roots numbers.
+    @param   [out] invalid            Mask of equations with invalid coefficients (can be NULL).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+solving_state_t classify_quadratic_batch(const double *a, const double *b, const double *c, size_t n,
+                                         int8_t *number, uint8_t *invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Finds numbers of roots of n quadratic equations with all threads of pool (see thread_pool.h).
+
+    @details - Columns are split in cache-sized chunks, every chunk is classified with classify_quadratic_batch().
+
+===============================================================================================================================
+*/
+solving_state_t classify_quadratic_batch_parallel(const double *a, const double *b, const double *c, size_t n,
+                                                  int8_t *number, uint8_t *invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Counts equations with every number of roots without writing number of every equation.
+
+    @details - Equations are classified by small blocks with classify_quadratic_batch(),
+               so only coefficients are read from memory.\n
+             - Return values are the same as in solve_quadratic_batch().
+
+    @param   [in]  a, b, c            Columns of coefficients.
+    @param   [in]  n                  Number of equations.
+    @param   [out] counts             Array of ROOTS_COUNTS_NUMBER counters (they are reset first).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+solving_state_t count_quadratic_roots(const double *a, const double *b, const double *c, size_t n, uint64_t *counts);
+
+/**
+===============================================================================================================================
+    @brief   - Counts equations with every number of roots with all threads of pool.
+
+    @details - Same as count_quadratic_roots(), columns are split in cache-sized chunks.
+
+===============================================================================================================================
+*/
+solving_state_t count_quadratic_roots_parallel(const double *a, const double *b, const double *c, size_t n, uint64_t *counts);
+
+#endif
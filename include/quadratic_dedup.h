@@ -0,0 +1,76 @@
+/**
+===============================================================================================================================
+    @file    quadratic_dedup.h
+    @brief   Header of library, allowing to solve batches with repeated equations once per unique equation.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Batch is solved in three stages:\n
+                + Coefficients are hashed (bit patterns of a, b and c), every row gets index of its unique equation.\n
+                + Unique equations are packed to columns and solved with solve_quadratic_batch_parallel().\n
+                + Results are scattered back to rows.\n
+             - Equations are the same only if their coefficients are the same bit for bit,
+               so results are the same as results of solving every row.\n
+             - Equations are not scaled to canonical form: comparisons with EPSILON are absolute,
+               so ax^2 + bx + c and 2ax^2 + 2bx + 2c can have different results.
+
+===============================================================================================================================
+*/
+
+#ifndef QUADRATIC_DEDUP_H
+#define QUADRATIC_DEDUP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "quadratic.h"
+
+/**
+===============================================================================================================================
+    @brief   Counters of all deduplicated batches.
+
+===============================================================================================================================
+*/
+struct dedup_stats_t {
+    uint64_t rows;
+    uint64_t unique;
+};
+
+/**
+===============================================================================================================================
+    @brief   - Solves n quadratic equations, every unique equation is solved once.
+
+    @details - Arguments, results and return values are the same as in solve_quadratic_batch().\n
+             - If memory for unique equations could not be allocated, batch is solved with
+               solve_quadratic_batch_parallel() without deduplication.
+
+===============================================================================================================================
+*/
+solving_state_t solve_quadratic_batch_dedup(const double *a, const double *b, const double *c, size_t n,
+                                            double *x1, double *x2, int8_t *number, uint8_t *invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Turns deduplication of batches in stream and .qbin modes on or off (off by default).
+
+===============================================================================================================================
+*/
+void set_batch_dedup(bool dedup);
+
+/**
+===============================================================================================================================
+    @brief   - Returns true if batches in stream and .qbin modes are deduplicated.
+
+===============================================================================================================================
+*/
+bool is_batch_dedup(void);
+
+/**
+===============================================================================================================================
+    @brief   - Writes number of rows and unique equations of all batches solved with solve_quadratic_batch_dedup().
+
+===============================================================================================================================
+*/
+void get_dedup_stats(dedup_stats_t *stats);
+
+#endif
@@ -0,0 +1,110 @@
+/**
+===============================================================================================================================
+    @file    quadratic_family.h
+    @brief   Header of library, allowing to solve many equations with the same a and b and different c.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Family is prepared once from a and b: b^2, 4a, -b, 2a and -b / 2a are computed
+               and family is classified as quadratic, linear, degenerate (a and b are zeros) or invalid.\n
+             - Solving equation of quadratic family costs one multiplication and subtraction for discriminant,
+               one square root and two divisions, batches are solved with vectorized kernels (see quadratic_simd.h).\n
+             - Expressions are the same as in solve_quadratic_roots() (4 * a * c is (4 * a) * c),
+               so roots are the same bit for bit. Roots are not multiplied by cached 1 / 2a for the same reason.\n
+             - In precise mode equations are solved with solve_quadratic_precise_roots().
+
+===============================================================================================================================
+*/
+
+#ifndef QUADRATIC_FAMILY_H
+#define QUADRATIC_FAMILY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "quadratic.h"
+
+enum family_kind_t {
+    FAMILY_QUADRATIC,
+    FAMILY_LINEAR,
+    FAMILY_DEGENERATE,
+    FAMILY_INVALID
+};
+
+/**
+===============================================================================================================================
+    @brief   Equations ax^2 + bx + c == 0 with fixed a and b.
+
+    @details - FAMILY_QUADRATIC: a is not zero.\n
+             - FAMILY_LINEAR: is_zero(a), b is not zero, the only root is -c / b.\n
+             - FAMILY_DEGENERATE: is_zero(a) and is_zero(b), equations have no roots or infinitely many roots.\n
+             - FAMILY_INVALID: a or b is not finite.\n
+             - vertex is -b / 2a, the root of equations with zero discriminant.
+
+===============================================================================================================================
+*/
+struct quadratic_family_t {
+    double a, b;
+    double squared_b;
+    double four_a;
+    double minus_b;
+    double two_a;
+    double vertex;
+    family_kind_t kind;
+};
+
+/**
+===============================================================================================================================
+    @brief   - Computes terms of family, that do not depend on c.
+
+    @param   [in]  a                  Coefficient of x^2.
+    @param   [in]  b                  Coefficient of x.
+    @param   [out] family             Pointer to family.
+
+===============================================================================================================================
+*/
+void prepare_quadratic_family(double a, double b, quadratic_family_t *family);
+
+/**
+===============================================================================================================================
+    @brief   - Solves equation of family with free coefficient c.
+
+    @details - Return values, roots and number are the same as in solve_quadratic() with a and b of family.
+
+    @param   [in]  family             Pointer to prepared family.
+    @param   [in]  c                  Free coefficient.
+    @param   [out] x1                 Pointer to first root.
+    @param   [out] x2                 Pointer to second root.
+    @param   [out] number             Pointer to number of roots.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+solving_state_t solve_quadratic_family(const quadratic_family_t *family, double c, double *x1, double *x2, roots_number_t *number);
+
+/**
+===============================================================================================================================
+    @brief   - Solves n equations of family with free coefficients from column c.
+
+    @details - Results, invalid and return values are the same as in solve_quadratic_batch()
+               with columns of a and b filled with a and b of family.\n
+             - Quadratic families are solved with vectorized kernel chosen on startup, other families
+               and precise mode are solved one by one with solve_quadratic_family().
+
+    @param   [in]  family             Pointer to prepared family.
+    @param   [in]  c                  Column of free coefficients.
+    @param   [in]  n                  Number of equations.
+    @param   [out] x1                 Column of first roots.
+    @param   [out] x2                 Column of second roots.
+    @param   [out] number             Column of roots numbers.
+    @param   [out] invalid            Mask of equations with invalid coefficients (can be NULL).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+solving_state_t solve_quadratic_family_batch(const quadratic_family_t *family, const double *c, size_t n,
+                                             double *x1, double *x2, int8_t *number, uint8_t *invalid);
+
+#endif
@@ -0,0 +1,290 @@
+/**
+===============================================================================================================================
+    @file    quadratic_generic.h
+    @brief   Header of library, allowing to solve quadratic equations in float, double and long double.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Solvers are constexpr templates, that are instantiated for float, double and long double in quadratic_generic.cpp.\n
+             - All arithmetic is done in type T, so float equations are solved in float.\n
+             - Tolerance of comparisons with zero is computed at compile time from std::numeric_limits<T>
+               (see solving_tolerance()), for double it is EPSILON, so double solver is the same as solve_quadratic().\n
+             - Solvers can be used in constant expressions, square root and checks of finiteness are done with
+               GCC builtins, that are folded by compiler, so tables of roots of known equations can be built
+               at compile time:\n
+               constexpr quadratic_equation_t ROOTS[] = {solved_equation(1, -3, 2), solved_equation(1, 0, -4)};
+
+===============================================================================================================================
+*/
+
+#ifndef QUADRATIC_GENERIC_H
+#define QUADRATIC_GENERIC_H
+
+#include <limits>
+#include "quadratic.h"
+#include "utils.h"
+#include "custom_assert.h"
+
+/**
+===============================================================================================================================
+    @brief   Quadratic equation with coefficients and roots of type T.
+
+===============================================================================================================================
+*/
+template<typename T>
+struct quadratic_equation_generic_t {
+    T a;
+    T b;
+    T c;
+    T x1;
+    T x2;
+    roots_number_t number;
+};
+
+/**
+===============================================================================================================================
+    @brief   - Returns 2^power.
+
+===============================================================================================================================
+*/
+template<typename T>
+constexpr T power_of_two(int power) {
+    return power == 0 ? T(1) : power > 0 ? 2 * power_of_two<T>(power - 1) : power_of_two<T>(power + 1) / 2;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns tolerance of comparisons with zero for type T.
+
+    @details - Tolerance is proportional to square root of machine epsilon of T:
+               EPSILON * 2^((digits of double - digits of T) / 2), so it is EPSILON for double,
+               EPSILON * 2^14 for float and EPSILON / 2^5 for 80-bit long double.
+
+===============================================================================================================================
+*/
+template<typename T>
+constexpr T solving_tolerance(void) {
+    return T(EPSILON) * power_of_two<T>((std::numeric_limits<double>::digits - std::numeric_limits<T>::digits) / 2);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Square roots of float, double and long double, that can be used in constant expressions.
+
+===============================================================================================================================
+*/
+constexpr float square_root_generic(float number) {
+    return __builtin_sqrtf(number);
+}
+
+constexpr double square_root_generic(double number) {
+    return __builtin_sqrt(number);
+}
+
+constexpr long double square_root_generic(long double number) {
+    return __builtin_sqrtl(number);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Checks if number is neither infinite nor NAN.
+
+===============================================================================================================================
+*/
+template<typename T>
+constexpr bool is_finite_generic(T number) {
+    return __builtin_isfinite(number);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Checks if |number| < solving_tolerance<T>().
+
+===============================================================================================================================
+*/
+template<typename T>
+constexpr bool is_zero_generic(T number) {
+    return (number < 0 ? -number : number) < solving_tolerance<T>();
+}
+
+/**
+===============================================================================================================================
+    @brief   - Function solves linear equation bx + c == 0 in type T.
+
+    @details - Function returns:
+                + SOLVING_SUCCESS (if solved equation successfully).\n
+                + SOLVING_ERROR (in case of unexpected error).\n
+                + There are no other return values.\n
+             - Function write root to 'x1' and 'x2' (negative zero is replaced with zero by adding zero).\n
+             - Function writes number of roots in 'number':\n
+                + NO_ROOTS if equation has no real roots.\n
+                + ONE_ROOT if equation has one real root.\n
+                + INF_ROOTS if equation has infinitely many roots.\n
+                + TWO_ROOTS can't occure in case of linear equation.
+
+    @param   [in]  b                  Coefficient of x.
+    @param   [in]  c                  Free coefficient.
+    @param   [out] x1                 Pointer to first root.
+    @param   [out] x2                 Pointer to second root.
+    @param   [out] number             Pointer to number of roots.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+template<typename T>
+constexpr solving_state_t solve_linear_generic(T b, T c, T *x1, T *x2, roots_number_t *number) {
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    if(is_zero_generic(b)) {
+        *number = is_zero_generic(c) ? INF_ROOTS : NO_ROOTS;
+        return SOLVING_SUCCESS;
+    }
+
+    *number = ONE_ROOT;
+    *x1 = *x2 = -c / b + T(0);
+    return SOLVING_SUCCESS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves quadratic equation ax^2 + bx + c == 0 in type T.
+
+    @details - Rules, return values and roots are the same as in solve_quadratic_roots(),
+               EPSILON is replaced with solving_tolerance<T>().
+
+    @param   [in]  a                  Coefficient of x^2.
+    @param   [in]  b                  Coefficient of x.
+    @param   [in]  c                  Free coefficient.
+    @param   [out] x1                 Pointer to first root.
+    @param   [out] x2                 Pointer to second root.
+    @param   [out] number             Pointer to number of roots.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+template<typename T>
+constexpr solving_state_t solve_quadratic_roots_generic(T a, T b, T c, T *x1, T *x2, roots_number_t *number) {
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    if(!is_finite_generic(a) || !is_finite_generic(b) || !is_finite_generic(c))
+        return INVALID_COEFFICIENTS;
+
+    //equation is linear if a == 0
+    if(is_zero_generic(a))
+        return solve_linear_generic(b, c, x1, x2, number);
+
+    T discriminant = b * b - 4 * a * c;
+
+    if(is_zero_generic(discriminant)) {
+        *number = ONE_ROOT;
+        *x1 = *x2 = (-b) / (2 * a) + T(0);
+        return SOLVING_SUCCESS;
+    }
+
+    if(discriminant > 0) {
+        T discriminant_root = square_root_generic(discriminant);
+        *number = TWO_ROOTS;
+        *x1 = (-b - discriminant_root) / (2 * a) + T(0);
+        *x2 = (-b + discriminant_root) / (2 * a) + T(0);
+        return SOLVING_SUCCESS;
+    }
+
+    *number = NO_ROOTS;
+    return SOLVING_SUCCESS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Finds number of roots of quadratic equation ax^2 + bx + c == 0 in type T without finding roots.
+
+    @details - Number is the same as in solve_quadratic_roots_generic(), but square root and divisions are skipped.\n
+             - Returns NOT_SOLVED if one of coefficients is not finite.
+
+    @param   [in]  a                  Coefficient of x^2.
+    @param   [in]  b                  Coefficient of x.
+    @param   [in]  c                  Free coefficient.
+
+    @return  Number of roots.
+
+===============================================================================================================================
+*/
+template<typename T>
+constexpr roots_number_t classify_quadratic_generic(T a, T b, T c) {
+    if(!is_finite_generic(a) || !is_finite_generic(b) || !is_finite_generic(c))
+        return NOT_SOLVED;
+
+    if(is_zero_generic(a)) {
+        if(is_zero_generic(b))
+            return is_zero_generic(c) ? INF_ROOTS : NO_ROOTS;
+        return ONE_ROOT;
+    }
+
+    T discriminant = b * b - 4 * a * c;
+
+    if(is_zero_generic(discriminant))
+        return ONE_ROOT;
+
+    return discriminant > 0 ? TWO_ROOTS : NO_ROOTS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves quadratic equation given by structure in type T.
+
+    @details - Same as solve_quadratic() for quadratic_equation_generic_t<T>.
+
+    @param   [out] equation           Pointer to equation structure.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+template<typename T>
+constexpr solving_state_t solve_quadratic_generic(quadratic_equation_generic_t<T> *equation) {
+    C_ASSERT(equation != NULL, SOLVING_ERROR);
+
+    return solve_quadratic_roots_generic(equation->a, equation->b, equation->c,
+                                         &equation->x1, &equation->x2, &equation->number);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns solved equation ax^2 + bx + c == 0 in type T.
+
+    @details - Roots that equation does not have are zeros.\n
+             - number is NOT_SOLVED if coefficients are not finite.
+
+===============================================================================================================================
+*/
+template<typename T>
+constexpr quadratic_equation_generic_t<T> solved_equation_generic(T a, T b, T c) {
+    quadratic_equation_generic_t<T> equation = {a, b, c, T(0), T(0), NOT_SOLVED};
+
+    if(solve_quadratic_generic(&equation) != SOLVING_SUCCESS)
+        equation.number = NOT_SOLVED;
+
+    return equation;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns solved equation ax^2 + bx + c == 0 (roots are the same as in solve_quadratic()).
+
+    @details - Same as solved_equation_generic<double>(), but returns quadratic_equation_t.
+
+===============================================================================================================================
+*/
+constexpr quadratic_equation_t solved_equation(double a, double b, double c) {
+    quadratic_equation_generic_t<double> equation = solved_equation_generic(a, b, c);
+
+    return {equation.a, equation.b, equation.c, equation.x1, equation.x2, equation.number};
+}
+
+#endif
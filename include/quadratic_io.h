@@ -0,0 +1,82 @@
+/**
+===============================================================================================================================
+    @file    quadratic_io.h
+    @brief   Header of library to enter coefficients, print roots and read tests files with stdio.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Functions are kept apart from solver, so libquadratic does not depend on stdio and colors.
+
+===============================================================================================================================
+*/
+
+#ifndef QUADRATIC_IO_H
+#define QUADRATIC_IO_H
+
+#include <stdio.h>
+#include "quadratic.h"
+#include "utils.h"
+
+enum getting_coeffs_state_t {
+    GETTING_SUCCESS,
+    GETTING_EXIT,
+    GETTING_ERROR
+};
+
+/**
+===============================================================================================================================
+    @brief   - Writes coefficients, that user typed, in in equation struct.
+
+    @details - Function asks user to type in coefficients of quadratic equation.\n
+             - It will ask user until he/she type in valid double number or word "exit".\n
+             - Function returns:\n
+                + GETTING_SUCCESS (in case of successful writing users inputs to equation fields).\n
+                + GETTING_EXIT (in case of typed in word "exit" by user).\n
+                + There are no other return values.
+
+    @param   [out] equation           Pointer to quadratic equation struct.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+getting_coeffs_state_t get_coefficients(quadratic_equation_t *equation);
+
+/**
+===============================================================================================================================
+    @brief   - Prints roots of quadratic equation in console.
+
+    @param   [in]  equation           Pointer to equation struct, that is already solved.
+
+===============================================================================================================================
+*/
+void print_quadratic_result(const quadratic_equation_t *equation);
+
+/**
+===============================================================================================================================
+    @brief   - Reads line of tests file.
+
+    @details - Format of reading: "%lg %lg %lg %lg %lg %d".\n
+             - Inputs are considered as "a b c x1 x2 n_roots", where.\n
+                + a, b and c are coefficients of quadratic equation ax^2 + bx + c == 0.\n
+                + x1 and x2 are roots of these equation.\n
+                + n_roots is expected number of roots.\n
+             - Note that roots are not compared if n_roots == -2 || n_roots == 0\ and only x1 is compared if n_roots == 1.\n
+             - Read documentation of test_solve_quadratic().\n
+             - Puts result of reading in equation structure.\n
+             - Function returns:\n
+                + READING_SUCCESS if it read coefficients successfully.\n
+                + READING_ERROR if it read coefficients unsiccessfully.\n
+                + READING_END if pointer in file reached the EOF.\n
+
+    @param   [in]  file               Pointer to opened file where tests are located.
+    @param   [out] equation           Pointer a structure where function puts coefficients, expected roots and roots number.
+
+    @return  Error (or success) code
+
+================================================================================================================================
+*/
+reading_state_t read_expected_line(FILE *file, quadratic_equation_t *equation);
+
+#endif
@@ -0,0 +1,99 @@
+/**
+===============================================================================================================================
+    @file    quadratic_precise.h
+    @brief   Header of library, allowing to solve quadratic equations with correctly classified discriminant.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - solve_quadratic() compares b^2 - 4ac with EPSILON, so equations near double root can get
+               wrong number of roots and roots lose precision because of cancellation in -b +- sqrt(D).\n
+             - Precise solver finds sign of discriminant of given coefficients exactly:\n
+                + Discriminant is computed in doubles together with bound of its rounding error.\n
+                + Only if the bound is not much smaller than |D| (sign is uncertain or cancellation made D inaccurate)
+                  or products overflow, discriminant is recomputed with FMA (Kahan's algorithm)
+                  on coefficients scaled by power of two.\n
+             - Roots are found without cancellation: q = -(b + sign(b) sqrt(D)) / 2, roots are q / a and c / q.
+
+===============================================================================================================================
+*/
+
+#ifndef QUADRATIC_PRECISE_H
+#define QUADRATIC_PRECISE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "quadratic.h"
+
+/**
+===============================================================================================================================
+    @brief   - Solves quadratic equation ax^2 + bx + c == 0 with precise discriminant.
+
+    @details - Equation is linear if is_zero(a), linear equations are solved in the same way as by solve_quadratic_roots().\n
+             - Equation has one root only if discriminant of given coefficients is exactly zero.\n
+             - Roots are ordered as in solve_quadratic(): x1 is (-b - sqrt(D)) / 2a, x2 is (-b + sqrt(D)) / 2a.\n
+             - Sign of discriminant is exact unless magnitudes of coefficients differ more than 2^500 times
+               (then products can be lost in underflow).\n
+             - Return values are the same as in solve_quadratic_roots(),
+               x1 and x2 are not changed if equation has zero or infinitely many roots.
+
+    @param   [in]  a                  Coefficient of x^2.
+    @param   [in]  b                  Coefficient of x.
+    @param   [in]  c                  Free coefficient.
+    @param   [out] x1                 Pointer to first root.
+    @param   [out] x2                 Pointer to second root.
+    @param   [out] number             Pointer to number of roots.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+solving_state_t solve_quadratic_precise_roots(double a, double b, double c, double *x1, double *x2, roots_number_t *number);
+
+/**
+===============================================================================================================================
+    @brief   - Finds number of roots of equation as solve_quadratic_precise_roots() without finding roots.
+
+    @details - Returns NOT_SOLVED if one of coefficients is not finite.
+
+    @param   [in]  a                  Coefficient of x^2.
+    @param   [in]  b                  Coefficient of x.
+    @param   [in]  c                  Free coefficient.
+
+    @return  Number of roots.
+
+===============================================================================================================================
+*/
+roots_number_t classify_quadratic_precise(double a, double b, double c);
+
+/**
+===============================================================================================================================
+    @brief   - Solves n quadratic equations with solve_quadratic_precise_roots().
+
+    @details - Arguments, results and return values are the same as in solve_quadratic_batch().
+
+===============================================================================================================================
+*/
+solving_state_t solve_quadratic_batch_precise(const double *a, const double *b, const double *c, size_t n,
+                                              double *x1, double *x2, int8_t *number, uint8_t *invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Turns precise mode on or off.
+
+    @details - In precise mode solve_quadratic() and batch solvers use precise solver.\n
+             - Precise mode is off by default.
+
+===============================================================================================================================
+*/
+void set_precise_solving(bool precise);
+
+/**
+===============================================================================================================================
+    @brief   - Returns true if precise mode is on.
+
+===============================================================================================================================
+*/
+bool is_precise_solving(void);
+
+#endif
@@ -0,0 +1,179 @@
+/**
+===============================================================================================================================
+    @file    quadratic_simd.h
+    @brief   Header of vectorized kernels for solving batches of quadratic equations.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#ifndef QUADRATIC_SIMD_H
+#define QUADRATIC_SIMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "quadratic_family.h"
+
+/**
+===============================================================================================================================
+    @brief   Instruction sets that batch kernels can be run with, from the weakest to the strongest.
+===============================================================================================================================
+*/
+enum simd_level_t {
+    SIMD_NONE   = 0,
+    SIMD_SSE2   = 1,
+    SIMD_AVX2   = 2,
+    SIMD_AVX512 = 3
+};
+
+/**
+===============================================================================================================================
+    @brief   - Type of vectorized kernel.
+
+    @details - Kernel solves equations from the beginning of columns while full vectors of them are left.\n
+             - Kernel returns number of solved equations, the tail is left for scalar code.\n
+             - Kernel sets *has_invalid to true if one of solved equations has not finite coefficients.
+
+===============================================================================================================================
+*/
+typedef size_t (*simd_kernel_t)(const double *a, const double *b, const double *c, size_t n,
+                                double *x1, double *x2, int8_t *number, uint8_t *invalid, bool *has_invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Type of vectorized kernel for float equations.
+
+    @details - Same as simd_kernel_t, vectors have twice as many lanes.\n
+             - Results are the same bit for bit as results of solve_quadratic_roots_generic<float>().
+
+===============================================================================================================================
+*/
+typedef size_t (*simd_float_kernel_t)(const float *a, const float *b, const float *c, size_t n,
+                                      float *x1, float *x2, int8_t *number, uint8_t *invalid, bool *has_invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Type of vectorized kernel, that finds only numbers of roots.
+
+    @details - Same as simd_kernel_t without roots, square roots and divisions are skipped.\n
+             - Numbers are the same as results of classify_quadratic_generic<double>().
+
+===============================================================================================================================
+*/
+typedef size_t (*simd_classify_kernel_t)(const double *a, const double *b, const double *c, size_t n,
+                                         int8_t *number, uint8_t *invalid, bool *has_invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Type of vectorized kernel for equations of quadratic family (see quadratic_family.h).
+
+    @details - Same as simd_kernel_t, a and b are taken from family, that must be FAMILY_QUADRATIC.\n
+             - Results are the same bit for bit as results of solve_quadratic_family().
+
+===============================================================================================================================
+*/
+typedef size_t (*simd_family_kernel_t)(const quadratic_family_t *family, const double *c, size_t n,
+                                       double *x1, double *x2, int8_t *number, uint8_t *invalid, bool *has_invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Detects the strongest instruction set supported by processor.
+
+    @details - Uses cpuid (through __builtin_cpu_supports()).\n
+             - Returns SIMD_NONE on processors that are not x86.
+
+    @return  Strongest supported instruction set.
+
+===============================================================================================================================
+*/
+simd_level_t detect_simd_level(void);
+
+/**
+===============================================================================================================================
+    @brief   - Returns instruction set that is used by solve_quadratic_batch().
+
+    @details - Instruction set is detected once, on the first call.
+
+    @return  Instruction set used by batch solver.
+
+===============================================================================================================================
+*/
+simd_level_t get_simd_level(void);
+
+/**
+===============================================================================================================================
+    @brief   - Changes instruction set used by solve_quadratic_batch().
+
+    @details - Level is clamped to the strongest one supported by processor.
+
+    @param   [in]  level              Wanted instruction set.
+
+    @return  Instruction set that is actually used.
+
+===============================================================================================================================
+*/
+simd_level_t set_simd_level(simd_level_t level);
+
+/**
+===============================================================================================================================
+    @brief   - Returns kernel for instruction set or NULL for SIMD_NONE.
+
+    @param   [in]  level              Instruction set.
+
+    @return  Pointer to kernel function.
+
+===============================================================================================================================
+*/
+simd_kernel_t get_simd_kernel(simd_level_t level);
+
+/**
+===============================================================================================================================
+    @brief   - Returns float kernel for instruction set or NULL for SIMD_NONE.
+
+    @param   [in]  level              Instruction set.
+
+    @return  Pointer to kernel function.
+
+===============================================================================================================================
+*/
+simd_float_kernel_t get_simd_float_kernel(simd_level_t level);
+
+/**
+===============================================================================================================================
+    @brief   - Returns classifying kernel for instruction set or NULL for SIMD_NONE.
+
+    @param   [in]  level              Instruction set.
+
+    @return  Pointer to kernel function.
+
+===============================================================================================================================
+*/
+simd_classify_kernel_t get_simd_classify_kernel(simd_level_t level);
+
+/**
+===============================================================================================================================
+    @brief   - Returns kernel for quadratic families for instruction set or NULL for SIMD_NONE.
+
+    @param   [in]  level              Instruction set.
+
+    @return  Pointer to kernel function.
+
+===============================================================================================================================
+*/
+simd_family_kernel_t get_simd_family_kernel(simd_level_t level);
+
+/**
+===============================================================================================================================
+    @brief   - Returns name of instruction set ("none", "sse2", "avx2" or "avx512").
+
+    @param   [in]  level              Instruction set.
+
+    @return  Constant string with name.
+
+===============================================================================================================================
+*/
+const char *simd_level_name(simd_level_t level);
+
+#endif
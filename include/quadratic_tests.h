@@ -12,6 +12,10 @@
 #ifndef QUADRATIC_TESTS_H
 #define QUADRATIC_TESTS_H
 
+#include <stddef.h>
+#include <stdio.h>
+#include "quadratic.h"
+
 enum test_state_t {
     NO_SUCH_FILE,
     INVALID_LINES,
@@ -39,14 +43,107 @@ const char *const DEFAULT_TEST_FILE_NAME = "tests.txt";
                 + NO_SUCH_FILE if there is no file "tests.txt".\n
                 + INVALID_LINES if there is error in "tests.txt".\n
                 + SUCCESS_TEST if all test provided in "tests.txt" were carried out.\n
+                + TEST_ERROR if file could not be mapped to memory.\n
+             - File is mapped to memory and parsed with read_expected_text().\n
+             - Chunks of file are tested in parallel, results are printed in the order of file
+               and totals are the same as if tests were run one by one.\n
+             - If file is .qbin file with results (see qbin.h), its columns are solved with batch solver.
 
     @param   [out] tests_number       Pointer to ineteger in which function will put total number of tests.
     @param   [out] errors_number      Pointer to integer in which function will put total number of errors.
+    @param   [in]  filename           Name of tests file.
+    @param   [out] error_line         Pointer to number of invalid line (if INVALID_LINES is returned).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+test_state_t test_solving_quadratic(int *tests_number, int *errors_number, const char *filename, size_t *error_line);
+
+/**
+===============================================================================================================================
+    @brief   - Checks that vectorized batch kernels give the same results as solve_quadratic(...).
+
+    @details - Equations are taken from file in the same format as in test_solving_quadratic(...),
+               and random equations (including zeros, infinities, NAN and numbers near EPSILON) are added.\n
+             - Every kernel supported by processor is run on all equations.\n
+             - Results are compared with solve_quadratic(...) bit by bit.\n
+             - Float kernels are run on the same equations rounded to float
+               and compared with solve_quadratic_roots_generic<float>(...).\n
+             - Function returns:\n
+                + NO_SUCH_FILE if there is no such file.\n
+                + INVALID_LINES if there is error in file.\n
+                + TEST_ERROR if memory could not be allocated.\n
+                + SUCCESS_TEST if all kernels were checked.
+
+    @param   [out] tests_number       Pointer to integer in which function will put total number of solved equations.
+    @param   [out] errors_number      Pointer to integer in which function will put number of different results.
+    @param   [in]  filename           Name of file with equations.
 
     @return  Error (or success) code.
 
 ===============================================================================================================================
 */
-test_state_t test_solving_quadratic(int *tests_number, int *errors_number, const char *filename);
+test_state_t test_batch_solving(int *tests_number, int *errors_number, const char *filename);
+
+/**
+===============================================================================================================================
+    @brief   - Writes tests from file as header with constexpr table GOLDEN_TESTS.
+
+    @details - Tests file has the same format as in test_solving_quadratic(...).\n
+             - Header is included in quadratic_tests.cpp as "golden_tests.h", table is used by test_golden_solving(...)
+               and, if EMBED_GOLDEN_TESTS is defined, checked with static_assert while compiling.\n
+             - Function returns:\n
+                + NO_SUCH_FILE if there is no such file.\n
+                + INVALID_LINES if there is error in file or there are no tests in it.\n
+                + TEST_ERROR if file could not be mapped to memory.\n
+                + SUCCESS_TEST if header was written.\n
+             - Output is not complete if function did not return SUCCESS_TEST.
+
+    @param   [in]  filename           Name of tests file.
+    @param   [out] output             File to write header to.
+    @param   [out] tests_number       Pointer to number of written tests.
+    @param   [out] error_line         Pointer to number of invalid line (if INVALID_LINES is returned).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+test_state_t embed_golden_tests(const char *filename, FILE *output, size_t *tests_number, size_t *error_line);
+
+/**
+===============================================================================================================================
+    @brief   - Runs tests, that are compiled into program (see embed_golden_tests(...)).
+
+    @details - Tests are run as in test_solving_quadratic(...), but without any files.\n
+             - Only failed tests are printed.\n
+             - Function returns SUCCESS_TEST or TEST_ERROR (in case of unexpected error).
+
+    @param   [out] tests_number       Pointer to integer in which function will put total number of tests.
+    @param   [out] errors_number      Pointer to integer in which function will put total number of errors.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+test_state_t test_golden_solving(int *tests_number, int *errors_number);
+
+/**
+===============================================================================================================================
+    @brief   - Compares roots depending on their amount.
+
+    @details - If amounts of roots are different roots are NOT the same.\n
+             - If there is zero or infinitely many roots they are the same.\n
+             - Checks only x1 if there is one root.\n
+             - Checks x1 and x2 if there is two roots.\n
+
+    @param   [in]  first              Pointer to first equation structure to be compared.
+    @param   [in]  second             Pointer to second equation structure to be compared.
+
+    @return  True if roots are the same and false if not.
+
+===============================================================================================================================
+*/
+bool compare_roots(const quadratic_equation_t *first, const quadratic_equation_t *second);
 
 #endif
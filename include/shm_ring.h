@@ -0,0 +1,193 @@
+/**
+===============================================================================================================================
+    @file    shm_ring.h
+    @brief   Header of library, allowing processes on the same host to solve equations through shared memory.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Server creates POSIX shared memory object with ring of SHM_SLOTS_NUMBER slots,
+               every client maps it and solves equations with solve_quadratic_shm().\n
+             - Client takes ticket (number of request), request k uses slot k % SHM_SLOTS_NUMBER,
+               client writes coefficients to slot, server writes roots to the same slot.\n
+             - State of slot is lap of ring and phase (free, writing, request, done), so slot of the previous lap
+               is never taken for the next one (wraparound).\n
+             - Both sides poll first and sleep on futex only after SHM_SPINS checks,
+               so there are no system calls while requests come faster than server solves them.\n
+             - If client crashes, server returns its slot to ring after SHM_ABANDON_MILLISECONDS.\n
+             - Works only on Linux, on other systems SHM_UNSUPPORTED is returned.
+
+===============================================================================================================================
+*/
+
+#ifndef SHM_RING_H
+#define SHM_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "quadratic.h"
+#include "latency_histogram.h"
+
+/**
+===============================================================================================================================
+    @brief   - Number of slots in ring (power of two).
+
+===============================================================================================================================
+*/
+static const size_t SHM_SLOTS_NUMBER = 1024;
+
+/**
+===============================================================================================================================
+    @brief   - Number of checks of shared memory before sleeping on futex.
+
+===============================================================================================================================
+*/
+static const size_t SHM_SPINS = 4096;
+
+/**
+===============================================================================================================================
+    @brief   - Time after which slot of client, that does not change it, is checked and returned to ring
+               if client is not alive.
+
+===============================================================================================================================
+*/
+static const int SHM_ABANDON_MILLISECONDS = 500;
+
+enum shm_state_t {
+    SHM_SUCCESS,
+    SHM_NAME_ERROR,
+    SHM_NO_SERVER,
+    SHM_MAPPING_ERROR,
+    SHM_MEMORY_ERROR,
+    SHM_UNSUPPORTED
+};
+
+/**
+===============================================================================================================================
+    @brief   Connection of client to server.
+
+    @details - Zero initialized structure is not connected.
+
+===============================================================================================================================
+*/
+struct shm_client_t {
+    void *region;
+    size_t size;
+    int pid;
+};
+
+/**
+===============================================================================================================================
+    @brief   Counters of server.
+
+    @details - sleeps is number of futex waits of server, reclaimed is number of slots returned from crashed clients.
+
+===============================================================================================================================
+*/
+struct shm_server_stats_t {
+    uint64_t requests;
+    uint64_t batches;
+    size_t max_batch;
+    uint64_t sleeps;
+    uint64_t reclaimed;
+};
+
+/**
+===============================================================================================================================
+    @brief   Results of solve_quadratic_shm() round trips measured by run_shm_ping().
+
+===============================================================================================================================
+*/
+struct shm_ping_stats_t {
+    uint64_t requests;
+    uint64_t mismatches;
+    double seconds;
+    latency_histogram_t latency;
+};
+
+/**
+===============================================================================================================================
+    @brief   - Creates shared memory object and solves requests until SIGINT or SIGTERM.
+
+    @details - Old object with the same name is replaced, object is removed after server stops.\n
+             - Function returns:\n
+                + SHM_SUCCESS if server was stopped by signal.\n
+                + SHM_NAME_ERROR if name is too long.\n
+                + SHM_MAPPING_ERROR if object could not be created or mapped.\n
+                + SHM_MEMORY_ERROR if memory for batch could not be allocated.\n
+                + SHM_UNSUPPORTED if system is not Linux.
+
+    @param   [in]  name               Name of object ('/' is added to beginning if there is no one).
+    @param   [out] stats              Pointer to counters (they are reset first).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+shm_state_t run_shm_server(const char *name, shm_server_stats_t *stats);
+
+/**
+===============================================================================================================================
+    @brief   - Maps shared memory object of server.
+
+    @details - Function returns SHM_NO_SERVER if object does not exist, or it was not created by running server.
+
+    @param   [in]  name               Name of object.
+    @param   [out] client             Pointer to client.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+shm_state_t open_shm_client(const char *name, shm_client_t *client);
+
+/**
+===============================================================================================================================
+    @brief   - Unmaps shared memory object.
+
+===============================================================================================================================
+*/
+void close_shm_client(shm_client_t *client);
+
+/**
+===============================================================================================================================
+    @brief   - Solves quadratic equation ax^2 + bx + c == 0 in server.
+
+    @details - Roots are the same as in solve_quadratic() of server (its options are used).\n
+             - Function returns SHM_NO_SERVER if server stopped.
+
+    @param   [in]  client             Pointer to client.
+    @param   [in]  a                  Coefficient of x^2.
+    @param   [in]  b                  Coefficient of x.
+    @param   [in]  c                  Free coefficient.
+    @param   [out] x1                 Pointer to first root.
+    @param   [out] x2                 Pointer to second root.
+    @param   [out] number             Pointer to number of roots.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+shm_state_t solve_quadratic_shm(shm_client_t *client, double a, double b, double c,
+                                double *x1, double *x2, roots_number_t *number);
+
+/**
+===============================================================================================================================
+    @brief   - Solves requests equations one by one with solve_quadratic_shm() and measures every round trip.
+
+    @details - Coefficients are multiples of 1/2 in [-8, 8).\n
+             - Every reply is compared with result of solve_quadratic_batch() in client,
+               so client must be run with the same solving options (for example '--precise') as server.\n
+             - Return values are the same as in open_shm_client() and solve_quadratic_shm().
+
+    @param   [in]  name               Name of object.
+    @param   [in]  requests           Number of equations.
+    @param   [out] stats              Pointer to results (they are reset first).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+shm_state_t run_shm_ping(const char *name, size_t requests, shm_ping_stats_t *stats);
+
+#endif
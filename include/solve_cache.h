@@ -0,0 +1,114 @@
+/**
+===============================================================================================================================
+    @file    solve_cache.h
+    @brief   Header of library, allowing to reuse roots of repeated equations.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Every thread has its own cache, so there are no locks.\n
+             - Cache is open addressing hash table with linear probing, keys are bit patterns of a, b and c,
+               so equations are the same only if their coefficients are the same bit for bit.\n
+             - Cache keeps at most capacity equations, the least recently used equation is evicted.\n
+             - Cache is off by default (capacity is 0).
+
+===============================================================================================================================
+*/
+
+#ifndef SOLVE_CACHE_H
+#define SOLVE_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "quadratic.h"
+
+/**
+===============================================================================================================================
+    @brief   - The maximum number of equations in cache of one thread.
+
+===============================================================================================================================
+*/
+static const size_t MAX_SOLVE_CACHE_CAPACITY = 1 << 24;
+
+/**
+===============================================================================================================================
+    @brief   Counters of cache lookups of all threads.
+
+===============================================================================================================================
+*/
+struct solve_cache_stats_t {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+};
+
+/**
+===============================================================================================================================
+    @brief   - Sets number of equations, that cache of every thread keeps.
+
+    @details - 0 turns cache off.\n
+             - Caches are cleared when they are used next time after capacity was changed.
+
+    @param   [in]  capacity           Number of equations, not bigger than MAX_SOLVE_CACHE_CAPACITY.
+
+    @return  False if capacity is too big.
+
+===============================================================================================================================
+*/
+bool set_solve_cache_capacity(size_t capacity);
+
+/**
+===============================================================================================================================
+    @brief   - Returns number of equations, that cache of every thread keeps (0 if cache is off).
+
+===============================================================================================================================
+*/
+size_t get_solve_cache_capacity(void);
+
+/**
+===============================================================================================================================
+    @brief   - Solves quadratic equation ax^2 + bx + c == 0 using cache of calling thread.
+
+    @details - Roots, return values and rules are the same as in solve_quadratic() (precise mode is taken into account).\n
+             - Only equations that were solved successfully are kept in cache.\n
+             - If cache is off or its memory could not be allocated, equation is solved without cache.
+
+    @param   [in]  a                  Coefficient of x^2.
+    @param   [in]  b                  Coefficient of x.
+    @param   [in]  c                  Free coefficient.
+    @param   [out] x1                 Pointer to first root.
+    @param   [out] x2                 Pointer to second root.
+    @param   [out] number             Pointer to number of roots.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+solving_state_t solve_quadratic_cached(double a, double b, double c, double *x1, double *x2, roots_number_t *number);
+
+/**
+===============================================================================================================================
+    @brief   - Solves n quadratic equations with solve_quadratic_cached().
+
+    @details - Arguments, results and return values are the same as in solve_quadratic_batch().\n
+             - Counters of calling thread are added to totals after batch is solved.
+
+===============================================================================================================================
+*/
+solving_state_t solve_quadratic_batch_cached(const double *a, const double *b, const double *c, size_t n,
+                                             double *x1, double *x2, int8_t *number, uint8_t *invalid);
+
+/**
+===============================================================================================================================
+    @brief   - Writes total counters of all threads.
+
+    @details - Counters of calling thread are added to totals first,
+               other threads add their counters after every batch and when they exit.
+
+    @param   [out] stats              Pointer to counters.
+
+===============================================================================================================================
+*/
+void get_solve_cache_stats(solve_cache_stats_t *stats);
+
+#endif
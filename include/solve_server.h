@@ -0,0 +1,97 @@
+/**
+===============================================================================================================================
+    @file    solve_server.h
+    @brief   Header of library, allowing to solve equations sent by other processes through local socket.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Address is port number (server listens on 127.0.0.1) or path of unix socket.\n
+             - Protocol is text, one request per line:\n
+                + Request is line "a b c" (the same as in input of '--solve-stream').\n
+                + Reply is line "a b c x1 x2 roots_number" (the same as in output of '--solve-stream')
+                  or line "ERROR" if request is invalid.\n
+                + Replies are sent in order of requests, so client can send many requests without waiting for replies.\n
+             - Server is single epoll loop, requests, that are read in one iteration of loop from all connections,
+               are solved as one batch with solve_quadratic_batch_parallel().\n
+             - Server works only on Linux, on other systems SERVER_UNSUPPORTED is returned.
+
+===============================================================================================================================
+*/
+
+#ifndef SOLVE_SERVER_H
+#define SOLVE_SERVER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "latency_histogram.h"
+
+/**
+===============================================================================================================================
+    @brief   - Maximum number of requests in one batch.
+
+===============================================================================================================================
+*/
+static const size_t SERVER_BATCH_SIZE = 1 << 12;
+
+enum server_state_t {
+    SERVER_SUCCESS,
+    SERVER_ADDRESS_ERROR,
+    SERVER_SOCKET_ERROR,
+    SERVER_MEMORY_ERROR,
+    SERVER_UNSUPPORTED
+};
+
+/**
+===============================================================================================================================
+    @brief   Counters of server.
+
+    @details - Latency of request is time from reading of request to sending of its reply to socket.
+
+===============================================================================================================================
+*/
+struct server_stats_t {
+    uint64_t connections;
+    uint64_t requests;
+    uint64_t invalid_requests;
+    uint64_t batches;
+    size_t max_batch;
+    latency_histogram_t latency;
+};
+
+/**
+===============================================================================================================================
+    @brief   - Serves requests until SIGINT or SIGTERM.
+
+    @details - Unix socket file is removed after server stops.\n
+             - Function returns:\n
+                + SERVER_SUCCESS if server was stopped by signal.\n
+                + SERVER_ADDRESS_ERROR if address is invalid.\n
+                + SERVER_SOCKET_ERROR if socket could not be created or bound or epoll failed.\n
+                + SERVER_MEMORY_ERROR if memory could not be allocated.\n
+                + SERVER_UNSUPPORTED if system is not Linux.
+
+    @param   [in]  address            Port number or path of unix socket.
+    @param   [out] stats              Pointer to counters (they are reset first).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+server_state_t run_server(const char *address, server_stats_t *stats);
+
+/**
+===============================================================================================================================
+    @brief   - Connects to server.
+
+    @details - Socket is blocking, -1 is returned if address is invalid, connection failed or system is not Linux.
+
+    @param   [in]  address            Port number or path of unix socket.
+
+    @return  Descriptor of socket.
+
+===============================================================================================================================
+*/
+int connect_to_server(const char *address);
+
+#endif
@@ -0,0 +1,199 @@
+/**
+===============================================================================================================================
+    @file    solve_stats.h
+    @brief   Header of library, allowing to count results of solve_quadratic() and measure time of stages of tests.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Instrumentation is compiled in, but when it is disabled every probe is one check of global flag.\n
+             - Stages are timed with std::chrono::steady_clock, so about 20 ns of every sample is the clock itself.\n
+             - Every thread collects statistics in its own block, blocks are added to totals
+               by flush_solve_stats(), get_solve_stats() and when thread exits.
+
+===============================================================================================================================
+*/
+
+#ifndef SOLVE_STATS_H
+#define SOLVE_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "quadratic.h"
+#include "latency_histogram.h"
+
+enum stats_stage_t {
+    STATS_STAGE_READ,
+    STATS_STAGE_SOLVE,
+    STATS_STAGE_COMPARE,
+    STATS_STAGE_OUTPUT,
+    STATS_STAGES_NUMBER
+};
+
+/**
+===============================================================================================================================
+    @brief   - Number of values of roots_number_t (from INF_ROOTS to TWO_ROOTS).
+
+===============================================================================================================================
+*/
+static const size_t STATS_ROOTS_NUMBERS = TWO_ROOTS - INF_ROOTS + 1;
+
+/**
+===============================================================================================================================
+    @brief   - Number of values of solving_state_t.
+
+===============================================================================================================================
+*/
+static const size_t STATS_SOLVING_STATES = INVALID_COEFFICIENTS + 1;
+
+/**
+===============================================================================================================================
+    @brief   Statistics of all threads.
+
+    @details - roots_numbers[number - INF_ROOTS] is number of equations with given number of roots.\n
+             - solving_states[state] is number of calls of solve_quadratic() that returned given state.\n
+             - Structure is big, so it should not be kept on stack.
+
+===============================================================================================================================
+*/
+struct solve_stats_t {
+    uint64_t roots_numbers[STATS_ROOTS_NUMBERS];
+    uint64_t solving_states[STATS_SOLVING_STATES];
+    latency_histogram_t stages[STATS_STAGES_NUMBER];
+};
+
+/**
+===============================================================================================================================
+    @brief   - Whether statistics are collected (do not change it directly, use set_solve_stats_enabled()).
+
+===============================================================================================================================
+*/
+extern bool solve_stats_enabled;
+
+/**
+===============================================================================================================================
+    @brief   - Turns collecting of statistics on or off.
+
+    @details - Must be called before other threads are started.
+
+===============================================================================================================================
+*/
+void set_solve_stats_enabled(bool enabled);
+
+/**
+===============================================================================================================================
+    @brief   - Returns current time of steady clock in nanoseconds.
+
+===============================================================================================================================
+*/
+uint64_t get_stats_time(void);
+
+/**
+===============================================================================================================================
+    @brief   - Adds time of stage to histogram of calling thread.
+
+    @param   [in]  stage              Stage.
+    @param   [in]  nanoseconds        Time of stage.
+
+===============================================================================================================================
+*/
+void add_stage_time(stats_stage_t stage, uint64_t nanoseconds);
+
+/**
+===============================================================================================================================
+    @brief   - Adds result of solve_quadratic() to counters of calling thread.
+
+    @param   [in]  state              Returned state.
+    @param   [in]  number             Number of roots (is counted only if state is SOLVING_SUCCESS).
+
+===============================================================================================================================
+*/
+void add_solving_result(solving_state_t state, roots_number_t number);
+
+/**
+===============================================================================================================================
+    @brief   - Starts timing of stage.
+
+    @return  Start time (0 if statistics are disabled).
+
+===============================================================================================================================
+*/
+inline uint64_t start_stats_stage(void) {
+    if(!solve_stats_enabled)
+        return 0;
+    return get_stats_time();
+}
+
+/**
+===============================================================================================================================
+    @brief   - Finishes timing of stage, started by start_stats_stage().
+
+    @param   [in]  stage              Stage.
+    @param   [in]  start              Time returned by start_stats_stage().
+
+===============================================================================================================================
+*/
+inline void finish_stats_stage(stats_stage_t stage, uint64_t start) {
+    if(solve_stats_enabled)
+        add_stage_time(stage, get_stats_time() - start);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Counts result of solve_quadratic() if statistics are enabled.
+
+    @param   [in]  state              Returned state.
+    @param   [in]  number             Number of roots.
+
+===============================================================================================================================
+*/
+inline void count_solving_result(solving_state_t state, roots_number_t number) {
+    if(solve_stats_enabled)
+        add_solving_result(state, number);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Adds statistics of calling thread to totals.
+
+    @details - Threads of pool must call it after every task, because they exit only at the end of program.
+
+===============================================================================================================================
+*/
+void flush_solve_stats(void);
+
+/**
+===============================================================================================================================
+    @brief   - Copies totals of all threads (statistics of calling thread are flushed first).
+
+    @param   [out] stats              Pointer to statistics.
+
+===============================================================================================================================
+*/
+void get_solve_stats(solve_stats_t *stats);
+
+/**
+===============================================================================================================================
+    @brief   - Returns name of stage, that is used in table and JSON ("read", "solve", "compare", "output").
+
+===============================================================================================================================
+*/
+const char *stats_stage_name(stats_stage_t stage);
+
+/**
+===============================================================================================================================
+    @brief   - Returns name of number of roots ("inf_roots", "not_solved", "no_roots", "one_root", "two_roots").
+
+===============================================================================================================================
+*/
+const char *stats_roots_name(roots_number_t number);
+
+/**
+===============================================================================================================================
+    @brief   - Returns name of solving state ("success", "error", "invalid_coefficients").
+
+===============================================================================================================================
+*/
+const char *stats_solving_state_name(solving_state_t state);
+
+#endif
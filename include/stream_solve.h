@@ -0,0 +1,125 @@
+/**
+===============================================================================================================================
+    @file    stream_solve.h
+    @brief   Header of library, allowing to solve streams of quadratic equations without user interaction.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#ifndef STREAM_SOLVE_H
+#define STREAM_SOLVE_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "mapped_file.h"
+
+enum stream_state_t {
+    STREAM_SUCCESS,
+    STREAM_READING_ERROR,
+    STREAM_WRITING_ERROR,
+    STREAM_MEMORY_ERROR
+};
+
+/**
+===============================================================================================================================
+    @brief   - Size of stdio buffers of streamed files.
+
+===============================================================================================================================
+*/
+static const size_t STREAM_BUFFER_SIZE = 1 << 20;
+
+/**
+===============================================================================================================================
+    @brief   Counters of rings between two stages of pipeline.
+
+    @details - Depth is number of blocks in ring before push.\n
+             - Producer stall is push to full ring (next stage is slower),
+               consumer stall is pop from empty ring (previous stage is slower).
+
+===============================================================================================================================
+*/
+struct pipeline_queue_stats_t {
+    uint64_t pushes;
+    uint64_t depth_sum;
+    size_t max_depth;
+    uint64_t full_stalls;
+    uint64_t empty_stalls;
+};
+
+/**
+===============================================================================================================================
+    @brief   Counters of pipeline of the last solved stream.
+
+===============================================================================================================================
+*/
+struct pipeline_stats_t {
+    size_t solvers_number;
+    size_t blocks_number;
+    size_t block_size;
+    pipeline_queue_stats_t parsed;
+    pipeline_queue_stats_t solved;
+    pipeline_queue_stats_t free;
+};
+
+/**
+===============================================================================================================================
+    @brief   - Solves equations from input and writes results to output.
+
+    @details - Every line of input is "a b c" (empty lines are skipped).\n
+             - For every equation line "a b c x1 x2 roots_number" is written to output,
+               numbers are printed with 17 significant digits, so output can be used as tests file.\n
+             - Roots are 0 if there are zero or infinitely many roots, roots_number is -1 if coefficients are not finite.\n
+             - Equations are solved by pipeline:\n
+                + Reader thread parses input to blocks.\n
+                + Solver threads (number of threads minus 2, at least 1) solve blocks with solve_quadratic_batch()
+                  and format results to text.\n
+                + Calling thread writes text of blocks in order of input.\n
+                + Stages are connected by lock-free bounded rings with one producer and one consumer,
+                  full ring stops producer (backpressure), so memory does not depend on size of input.\n
+             - Function returns:\n
+                + STREAM_SUCCESS if all equations were solved.\n
+                + STREAM_READING_ERROR if line could not be read (its number is put to error_line).\n
+                + STREAM_WRITING_ERROR if output could not be written.\n
+                + STREAM_MEMORY_ERROR if buffers could not be allocated.
+
+    @param   [in]  input              Opened file with coefficients.
+    @param   [in]  output             Opened file for results.
+    @param   [out] equations_number   Number of solved equations.
+    @param   [out] error_line         Number of invalid line (counting from 1).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+stream_state_t solve_stream(FILE *input, FILE *output, size_t *equations_number, size_t *error_line);
+
+/**
+===============================================================================================================================
+    @brief   - Solves equations from file mapped to memory and writes results to output.
+
+    @details - Same as solve_stream(), but lines are parsed directly from mapped file without copying.
+
+    @param   [in]  input              Mapped file with coefficients.
+    @param   [in]  output             Opened file for results.
+    @param   [out] equations_number   Number of solved equations.
+    @param   [out] error_line         Number of invalid line (counting from 1).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+stream_state_t solve_stream_mapped(const mapped_file_t *input, FILE *output, size_t *equations_number, size_t *error_line);
+
+/**
+===============================================================================================================================
+    @brief   - Writes counters of pipeline of the last solved stream.
+
+===============================================================================================================================
+*/
+void get_pipeline_stats(pipeline_stats_t *stats);
+
+#endif
@@ -0,0 +1,141 @@
+/**
+===============================================================================================================================
+    @file    sweep.h
+    @brief   Header of library, allowing to solve all equations of grid of coefficients without reading them.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Grid is a x b x c, every axis is first, first + step, ..., c is the fastest axis,
+               so equations go in order of a, then b, then c.\n
+             - Equations are solved by tiles of SWEEP_TILE_SIZE consecutive equations with all threads of pool,
+               tiles are written in order, so only a window of tiles is kept in memory.\n
+             - Every row along c axis is solved as family (see quadratic_family.h): b^2, 4a, -b and 2a
+               are computed once per row, so discriminant is b^2 - 4a * c, affine in c. It is computed exactly
+               as in solve_quadratic(), so roots are the same.
+
+===============================================================================================================================
+*/
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "quadratic_batch.h"
+
+/**
+===============================================================================================================================
+    @brief   - Number of equations solved by one task.
+
+===============================================================================================================================
+*/
+static const size_t SWEEP_TILE_SIZE = 1 << 14;
+
+enum sweep_format_t {
+    SWEEP_TEXT,
+    SWEEP_QBIN
+};
+
+enum sweep_state_t {
+    SWEEP_SUCCESS,
+    SWEEP_INVALID_GRID,
+    SWEEP_WRITING_ERROR,
+    SWEEP_MEMORY_ERROR
+};
+
+/**
+===============================================================================================================================
+    @brief   Axis of grid: count values first + i * step, i in [0, count).
+
+===============================================================================================================================
+*/
+struct sweep_axis_t {
+    double first;
+    double step;
+    size_t count;
+};
+
+/**
+===============================================================================================================================
+    @brief   Settings of sweep.
+
+    @details - Text lines are "a b c x1 x2 roots_number" (format of tests files).
+
+===============================================================================================================================
+*/
+struct sweep_config_t {
+    sweep_axis_t a, b, c;
+    sweep_format_t format;
+};
+
+/**
+===============================================================================================================================
+    @brief   Results of sweep.
+
+    @details - numbers[number - INF_ROOTS] is number of equations with given number of roots.
+
+===============================================================================================================================
+*/
+struct sweep_stats_t {
+    uint64_t equations;
+    uint64_t numbers[ROOTS_COUNTS_NUMBER];
+};
+
+/**
+===============================================================================================================================
+    @brief   - Fills config with grid of one equation x^2 == 0 and text output.
+
+    @param   [out] config             Pointer to settings.
+
+===============================================================================================================================
+*/
+void init_sweep_config(sweep_config_t *config);
+
+/**
+===============================================================================================================================
+    @brief   - Changes one axis given as "a=first:last:step" or "a=value" (keys are "a", "b" and "c").
+
+    @details - Axis has all values first + i * step, that are not beyond last (up to rounding),
+               step must have sign of last - first and must not be zero unless last == first.
+
+    @param   [out] config             Pointer to settings.
+    @param   [in]  setting            String with axis.
+
+    @return  False if key is unknown or values are invalid.
+
+===============================================================================================================================
+*/
+bool parse_sweep_axis(sweep_config_t *config, const char *setting);
+
+/**
+===============================================================================================================================
+    @brief   - Returns number of equations of grid or 0 if it does not fit in size_t.
+
+===============================================================================================================================
+*/
+size_t get_sweep_size(const sweep_config_t *config);
+
+/**
+===============================================================================================================================
+    @brief   - Solves all equations of grid and writes them to output.
+
+    @details - For SWEEP_QBIN output must be opened in binary mode and must allow seeking.\n
+             - Function returns:\n
+                + SWEEP_SUCCESS if all equations were written.\n
+                + SWEEP_INVALID_GRID if grid is empty or too big.\n
+                + SWEEP_WRITING_ERROR if output could not be written.\n
+                + SWEEP_MEMORY_ERROR if memory for tiles could not be allocated.
+
+    @param   [in]  output             Opened file.
+    @param   [in]  config             Pointer to settings.
+    @param   [out] stats              Pointer to results (they are reset first).
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+sweep_state_t sweep_equations(FILE *output, const sweep_config_t *config, sweep_stats_t *stats);
+
+#endif
@@ -0,0 +1,91 @@
+/**
+===============================================================================================================================
+    @file    thread_pool.h
+    @brief   Header of work-stealing thread pool, that is used to split big batches between cores.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stddef.h>
+
+/**
+===============================================================================================================================
+    @brief   - Size of data (in bytes), that one chunk of parallel work is expected to touch.
+
+    @details - Chosen to fit in L2 cache of one core.
+
+===============================================================================================================================
+*/
+static const size_t POOL_CHUNK_BYTES = 256 * 1024;
+
+/**
+===============================================================================================================================
+    @brief   - Function that handles elements [begin, end) of parallel work.
+
+    @details - worker is index of thread in [0, get_threads_number()), it can be used to access
+               per-thread resources without locks.
+
+===============================================================================================================================
+*/
+typedef void (*pool_task_t)(size_t begin, size_t end, size_t worker, void *context);
+
+/**
+===============================================================================================================================
+    @brief   - Sets number of threads used by parallel_for(...).
+
+    @details - Must be called before first parallel_for(...), later calls are ignored.\n
+             - 0 means number of hardware threads.
+
+    @param   [in]  threads_number     Number of threads (including thread that calls parallel_for(...)).
+
+    @return  True if number was set and false if pool is already running.
+
+===============================================================================================================================
+*/
+bool set_threads_number(size_t threads_number);
+
+/**
+===============================================================================================================================
+    @brief   - Returns number of threads used by parallel_for(...).
+
+===============================================================================================================================
+*/
+size_t get_threads_number(void);
+
+/**
+===============================================================================================================================
+    @brief   - Returns number of elements in chunk, that touches about POOL_CHUNK_BYTES of memory.
+
+    @param   [in]  element_size       Number of bytes touched by one element.
+
+===============================================================================================================================
+*/
+size_t cache_chunk_size(size_t element_size);
+
+/**
+===============================================================================================================================
+    @brief   - Runs task on elements [0, count) with all threads of pool.
+
+    @details - Elements are split in chunks of chunk_size elements.\n
+             - Every thread starts with contiguous range of chunks, threads that finished their range steal
+               half of the range from other threads.\n
+             - Calling thread works as worker 0 and returns when all chunks are done.\n
+             - Threads are created on the first call.\n
+             - Nested calls (from task) are run by the calling thread only.
+
+    @param   [in]  count              Number of elements.
+    @param   [in]  chunk_size         Number of elements in one chunk.
+    @param   [in]  task               Function that handles chunks.
+    @param   [in]  context            Pointer that is passed to task.
+
+===============================================================================================================================
+*/
+void parallel_for(size_t count, size_t chunk_size, pool_task_t task, void *context);
+
+#endif
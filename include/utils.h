@@ -1,7 +1,7 @@
 /**
 ===============================================================================================================================
     @file    utils.h
-    @brief   Header of library, allowing to compare doubles with zero and reading test cases for quadratic equation from file.
+    @brief   Header of library, allowing to compare doubles with zero and reading test cases for quadratic equation from text.
     @date    23.08.2024
     @author  Artem Neskorodov
     @link    https://vk.com/neskorodovartem
@@ -12,7 +12,11 @@
 #ifndef COMPARE_DOUBLES_H
 #define COMPARE_DOUBLES_H
 
+#include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
 #include "quadratic.h"
 
 /**
@@ -21,7 +25,7 @@
 
 ===============================================================================================================================
 */
-static const double EPSILON = 1e-9;
+static constexpr double EPSILON = 1e-9;
 
 enum compare_state_t {
     BIGGER,
@@ -35,6 +39,22 @@ enum reading_state_t {
     READING_END
 };
 
+/**
+===============================================================================================================================
+    @brief   - State of reading text that is already in memory (for example mapped file).
+
+    @details - line is number of line (counting from 1) where position is.\n
+             - error_line is number of line where last READING_ERROR occured.
+
+===============================================================================================================================
+*/
+struct text_reader_t {
+    const char *position;
+    const char *end;
+    size_t line;
+    size_t error_line;
+};
+
 /**
 ===============================================================================================================================
     @brief   - Compares number to zero.
@@ -47,7 +67,12 @@ enum reading_state_t {
 
 ===============================================================================================================================
 */
-bool is_zero(double num);
+inline bool is_zero(double num) {
+    if(fabs(num) < EPSILON)
+        return true;
+
+    return false;
+}
 
 /**
 ===============================================================================================================================
@@ -65,33 +90,83 @@ bool is_zero(double num);
 
 ===============================================================================================================================
 */
-compare_state_t compare_with_zero(double a);
+inline compare_state_t compare_with_zero(double a) {
+    if(is_zero(a) == true)
+        return EQUALS;
+
+    if(a > 0.0)
+        return BIGGER;
+
+    return LESS;
+}
+
+/**
+================================================================================================================================
+    @brief   - Starts reading text.
+
+    @param   [out] reader             Pointer to reader structure.
+    @param   [in]  data               Text (does not need to end with '\0').
+    @param   [in]  size               Length of text.
+
+================================================================================================================================
+*/
+void init_text_reader(text_reader_t *reader, const char *data, size_t size);
 
 /**
-===============================================================================================================================
-    @brief   - Reads line of tests file.
-
-    @details - Format of reading: "%lg %lg %lg %lg %lg %d".\n
-             - Inputs are considered as "a b c x1 x2 n_roots", where.\n
-                + a, b and c are coefficients of quadratic equation ax^2 + bx + c == 0.\n
-                + x1 and x2 are roots of these equation.\n
-                + n_roots is expected number of roots.\n
-             - Note that roots are not compared if n_roots == -2 || n_roots == 0\ and only x1 is compared if n_roots == 1.\n
-             - Read documentation of test_solve_quadratic().\n
-             - Puts result of reading in equation structure.\n
+================================================================================================================================
+    @brief   - Reads record of tests file from text in memory.
+
+    @details - Same as read_expected_line() (see quadratic_io.h), but reads from text_reader_t:\n
+                + Numbers are parsed with std::from_chars(), that does not depend on locale and
+                  does not interpret format string.\n
+                + Numbers that from_chars() does not understand (hexadecimal, out of range) are parsed with strtod(),
+                  so results are the same as with '%lg'.\n
+                + On READING_ERROR number of line with invalid number is put to reader->error_line.
+
+    @param   [out] reader             Pointer to reader structure.
+    @param   [out] equation           Pointer a structure where function puts coefficients, expected roots and roots number.
+
+    @return  Error (or success) code
+
+================================================================================================================================
+*/
+reading_state_t read_expected_text(text_reader_t *reader, quadratic_equation_t *equation);
+
+/**
+================================================================================================================================
+    @brief   - Reads line "a b c" from text in memory.
+
+    @details - Empty lines are skipped.\n
+             - Numbers must be in one line, there must not be anything except spaces after c.\n
              - Function returns:\n
                 + READING_SUCCESS if it read coefficients successfully.\n
-                + READING_ERROR if it read coefficients unsiccessfully.\n
-                + READING_END if pointer in file reached the EOF.\n
+                + READING_ERROR if line is invalid (its number is put to reader->error_line).\n
+                + READING_END if text ended.
 
-    @param   [in]  file               Pointer to opened file where tests are located.
-    @param   [out] equation           Pointer a structure where function puts coefficients, expected roots and roots number.
+    @param   [out] reader             Pointer to reader structure.
+    @param   [out] a, b, c            Pointers to coefficients.
 
     @return  Error (or success) code
 
 ================================================================================================================================
 */
-reading_state_t read_expected_line(FILE *file, quadratic_equation_t *equation);
+reading_state_t read_coefficients_text(text_reader_t *reader, double *a, double *b, double *c);
+
+/**
+================================================================================================================================
+    @brief   - Parses double from [*position, end) and moves *position after it.
+
+    @details - Accepts everything that '%lg' accepts (except leading spaces).
+
+    @param   [out] position           Pointer to position in text.
+    @param   [in]  end                End of text.
+    @param   [out] out                Pointer to parsed number.
+
+    @return  True if number was parsed and false if not.
+
+================================================================================================================================
+*/
+bool parse_double(const char **position, const char *end, double *out);
 
 /**
 ================================================================================================================================
@@ -105,7 +180,14 @@ reading_state_t read_expected_line(FILE *file, quadratic_equation_t *equation);
 
 ================================================================================================================================
 */
-bool is_minus_zero(double number);
+inline bool is_minus_zero(double number) {
+    const uint64_t minus_zero = (uint64_t)1 << (8 * sizeof(uint64_t) - 1);
+    uint64_t bits = 0;
+    memcpy(&bits, &number, sizeof(bits));
+    if(minus_zero == bits)
+        return true;
+    return false;
+}
 
 /**
 ================================================================================================================================
@@ -120,5 +202,10 @@ bool is_minus_zero(double number);
 
 ================================================================================================================================
 */
-bool is_equal(double a, double b);
+inline bool is_equal(double a, double b) {
+    if(is_zero(a - b))
+        return true;
+    return false;
+}
+
 #endif
@@ -21,6 +21,7 @@
 */
 
 int main(const int argc, const char *argv[]) {
+    set_assert_handler(print_colored_assert_error);
     return (int)parse_flags(argc, argv);
 }
 
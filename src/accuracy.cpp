@@ -0,0 +1,561 @@
+/**
+===============================================================================================================================
+    @file    accuracy.cpp
+    @brief   Measuring errors of solve_quadratic() against long double reference.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "accuracy.h"
+#include "quadratic_batch.h"
+#include "thread_pool.h"
+#include "qbin.h"
+#include "utils.h"
+#include "custom_assert.h"
+
+static_assert(LDBL_MANT_DIG > DBL_MANT_DIG, "Reference solver needs long double with longer mantissa than double");
+
+/**
+===============================================================================================================================
+    @brief   - Factor of Veltkamp splitting of long double in two halves, whose products are exact.
+
+===============================================================================================================================
+*/
+static const long double SPLIT_FACTOR = (long double)((1ULL << ((LDBL_MANT_DIG + 1) / 2)) + 1);
+
+/**
+===============================================================================================================================
+    @brief   Buffers and statistics of one thread.
+
+    @details - Columns of coefficients are allocated only for random equations.
+
+===============================================================================================================================
+*/
+struct accuracy_worker_t {
+    double *a, *b, *c;
+    double *x1, *x2;
+    int8_t *number;
+    accuracy_stats_t stats;
+};
+
+/**
+===============================================================================================================================
+    @brief   Context of verifying tasks.
+
+    @details - If config is not NULL, equations are generated, otherwise they are taken from columns.
+
+===============================================================================================================================
+*/
+struct accuracy_context_t {
+    const generator_config_t *config;
+    const double *a, *b, *c;
+    size_t count;
+    accuracy_worker_t *workers;
+};
+
+static accuracy_state_t run_verification(accuracy_context_t *context, accuracy_stats_t *stats);
+static bool allocate_worker(accuracy_worker_t *worker, bool with_coefficients);
+static void free_worker(accuracy_worker_t *worker);
+static void verify_blocks(size_t begin, size_t end, size_t worker, void *context);
+static void verify_row(accuracy_stats_t *stats, double a, double b, double c, double x1, double x2, roots_number_t number);
+static accuracy_cause_t misclassification_cause(double a, double b, double c);
+static void add_ulp_error(ulp_histogram_t *histogram, long double error);
+static long double ulp_error(double root, long double reference);
+static size_t ulp_bucket(long double error);
+static void add_accuracy_stats(accuracy_stats_t *stats, const accuracy_stats_t *added);
+static accuracy_state_t get_accuracy_state(qbin_state_t state);
+static long double reference_discriminant(double a, double b, double c);
+static void exact_product(long double x, long double y, long double *product, long double *error);
+static void split_long_double(long double x, long double *high, long double *low);
+static bool is_exact_zero(double number);
+
+void reference_quadratic_roots(double a, double b, double c, long double *x1, long double *x2, roots_number_t *number) {
+    C_ASSERT(x1     != NULL, );
+    C_ASSERT(x2     != NULL, );
+    C_ASSERT(number != NULL, );
+
+    if(is_exact_zero(a)) {
+        if(is_exact_zero(b)) {
+            *number = is_exact_zero(c) ? INF_ROOTS : NO_ROOTS;
+            return ;
+        }
+        *x1 = *x2 = -(long double)c / b;
+        *number = ONE_ROOT;
+        return ;
+    }
+
+    long double discriminant = reference_discriminant(a, b, c);
+    if(discriminant < 0) {
+        *number = NO_ROOTS;
+        return ;
+    }
+    if(!(discriminant > 0)) {
+        *x1 = *x2 = -(long double)b / (2 * (long double)a);
+        *number = ONE_ROOT;
+        return ;
+    }
+
+    long double half_sum = -((long double)b + copysignl(sqrtl(discriminant), b)) / 2;
+    long double first  = half_sum / a;
+    long double second = c / half_sum;
+    *x1 = fminl(first, second);
+    *x2 = fmaxl(first, second);
+    *number = TWO_ROOTS;
+}
+
+accuracy_state_t verify_accuracy_random(size_t count, const generator_config_t *config, accuracy_stats_t *stats) {
+    C_ASSERT(config != NULL, ACCURACY_INVALID_CONFIG);
+    C_ASSERT(stats  != NULL, ACCURACY_INVALID_CONFIG);
+
+    memset(stats, 0, sizeof(accuracy_stats_t));
+
+    //generating zero equations only validates config
+    double a = 0, b = 0, c = 0;
+    generator_stats_t classes = {};
+    if(!generate_coefficients(config, 0, 0, &a, &b, &c, &classes))
+        return ACCURACY_INVALID_CONFIG;
+
+    accuracy_context_t context = {.config = config, .a = NULL, .b = NULL, .c = NULL, .count = count, .workers = NULL};
+    return run_verification(&context, stats);
+}
+
+accuracy_state_t verify_accuracy_columns(const double *a, const double *b, const double *c, size_t count,
+                                         accuracy_stats_t *stats) {
+    C_ASSERT(a     != NULL, ACCURACY_INVALID_CONFIG);
+    C_ASSERT(b     != NULL, ACCURACY_INVALID_CONFIG);
+    C_ASSERT(c     != NULL, ACCURACY_INVALID_CONFIG);
+    C_ASSERT(stats != NULL, ACCURACY_INVALID_CONFIG);
+
+    memset(stats, 0, sizeof(accuracy_stats_t));
+
+    accuracy_context_t context = {.config = NULL, .a = a, .b = b, .c = c, .count = count, .workers = NULL};
+    return run_verification(&context, stats);
+}
+
+accuracy_state_t verify_accuracy_file(const char *filename, size_t limit, accuracy_stats_t *stats, size_t *error_line) {
+    C_ASSERT(filename   != NULL, ACCURACY_NO_FILE);
+    C_ASSERT(stats      != NULL, ACCURACY_INVALID_CONFIG);
+    C_ASSERT(error_line != NULL, ACCURACY_INVALID_CONFIG);
+
+    memset(stats, 0, sizeof(accuracy_stats_t));
+    *error_line = 0;
+
+    if(is_qbin_file(filename)) {
+        qbin_view_t view = {};
+        accuracy_state_t state = get_accuracy_state(open_qbin(filename, &view, false));
+        if(state != ACCURACY_SUCCESS)
+            return state;
+
+        size_t count = limit != 0 && limit < view.count ? limit : view.count;
+        state = verify_accuracy_columns(view.a, view.b, view.c, count, stats);
+        close_qbin(&view);
+        return state;
+    }
+
+    qbin_columns_t columns = {};
+    accuracy_state_t state = get_accuracy_state(read_text_columns(filename, &columns, error_line));
+    if(state != ACCURACY_SUCCESS)
+        return state;
+
+    size_t count = limit != 0 && limit < columns.size ? limit : columns.size;
+    state = verify_accuracy_columns(columns.a, columns.b, columns.c, count, stats);
+    free_qbin_columns(&columns);
+    return state;
+}
+
+double ulp_bucket_limit(size_t bucket) {
+    if(bucket + 1 >= ACCURACY_ULP_BUCKETS)
+        return INFINITY;
+    return ldexp(1.0, (int)bucket - 1);
+}
+
+const char *accuracy_cause_name(accuracy_cause_t cause) {
+    switch(cause) {
+        case ACCURACY_A_AS_ZERO:            return "a_as_zero";
+        case ACCURACY_B_AS_ZERO:            return "b_as_zero";
+        case ACCURACY_C_AS_ZERO:            return "c_as_zero";
+        case ACCURACY_DISCRIMINANT_AS_ZERO: return "discriminant_as_zero";
+        case ACCURACY_ROUNDING:             return "rounding";
+        case ACCURACY_CAUSES_NUMBER:        return "unknown";
+        default:                            return "unknown";
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Verifies blocks of context with all threads and adds statistics of threads.
+
+===============================================================================================================================
+*/
+accuracy_state_t run_verification(accuracy_context_t *context, accuracy_stats_t *stats) {
+    C_ASSERT(context != NULL, ACCURACY_INVALID_CONFIG);
+    C_ASSERT(stats   != NULL, ACCURACY_INVALID_CONFIG);
+
+    size_t threads_number = get_threads_number();
+    context->workers = (accuracy_worker_t *)calloc(threads_number, sizeof(accuracy_worker_t));
+    if(context->workers == NULL)
+        return ACCURACY_MEMORY_ERROR;
+
+    accuracy_state_t state = ACCURACY_SUCCESS;
+    for(size_t worker = 0; worker < threads_number; worker++) {
+        if(!allocate_worker(&context->workers[worker], context->config != NULL)) {
+            state = ACCURACY_MEMORY_ERROR;
+            break;
+        }
+    }
+
+    if(state == ACCURACY_SUCCESS) {
+        size_t blocks_number = (context->count + GENERATE_BLOCK_SIZE - 1) / GENERATE_BLOCK_SIZE;
+        parallel_for(blocks_number, 1, verify_blocks, context);
+
+        for(size_t worker = 0; worker < threads_number; worker++)
+            add_accuracy_stats(stats, &context->workers[worker].stats);
+    }
+
+    for(size_t worker = 0; worker < threads_number; worker++)
+        free_worker(&context->workers[worker]);
+    free(context->workers);
+    context->workers = NULL;
+    return state;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Allocates columns of roots (and of coefficients if they are generated) for one block.
+
+===============================================================================================================================
+*/
+bool allocate_worker(accuracy_worker_t *worker, bool with_coefficients) {
+    C_ASSERT(worker != NULL, false);
+
+    if(with_coefficients) {
+        worker->a = (double *)calloc(GENERATE_BLOCK_SIZE, sizeof(double));
+        worker->b = (double *)calloc(GENERATE_BLOCK_SIZE, sizeof(double));
+        worker->c = (double *)calloc(GENERATE_BLOCK_SIZE, sizeof(double));
+        if(worker->a == NULL || worker->b == NULL || worker->c == NULL)
+            return false;
+    }
+
+    worker->x1     = (double *)calloc(GENERATE_BLOCK_SIZE, sizeof(double));
+    worker->x2     = (double *)calloc(GENERATE_BLOCK_SIZE, sizeof(double));
+    worker->number = (int8_t *)calloc(GENERATE_BLOCK_SIZE, sizeof(int8_t));
+    return worker->x1 != NULL && worker->x2 != NULL && worker->number != NULL;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Frees columns of thread.
+
+===============================================================================================================================
+*/
+void free_worker(accuracy_worker_t *worker) {
+    C_ASSERT(worker != NULL, );
+
+    free(worker->a);
+    free(worker->b);
+    free(worker->c);
+    free(worker->x1);
+    free(worker->x2);
+    free(worker->number);
+    memset(worker, 0, sizeof(accuracy_worker_t));
+}
+
+/**
+===============================================================================================================================
+    @brief   - Task of pool, that solves blocks [begin, end) with solve_quadratic_batch() and compares them with reference.
+
+===============================================================================================================================
+*/
+void verify_blocks(size_t begin, size_t end, size_t worker, void *context) {
+    C_ASSERT(context != NULL, );
+
+    accuracy_context_t *verification = (accuracy_context_t *)context;
+    accuracy_worker_t *buffers = &verification->workers[worker];
+
+    for(size_t block = begin; block < end; block++) {
+        size_t first = block * GENERATE_BLOCK_SIZE;
+        size_t size  = verification->count - first < GENERATE_BLOCK_SIZE ? verification->count - first : GENERATE_BLOCK_SIZE;
+
+        const double *a = verification->a + first;
+        const double *b = verification->b + first;
+        const double *c = verification->c + first;
+        if(verification->config != NULL) {
+            generator_stats_t classes = {};
+            generate_coefficients(verification->config, first, size, buffers->a, buffers->b, buffers->c, &classes);
+            a = buffers->a;
+            b = buffers->b;
+            c = buffers->c;
+        }
+
+        //rows with not finite coefficients are marked NOT_SOLVED and skipped below
+        solve_quadratic_batch(a, b, c, size, buffers->x1, buffers->x2, buffers->number, NULL);
+
+        for(size_t row = 0; row < size; row++)
+            verify_row(&buffers->stats, a[row], b[row], c[row], buffers->x1[row], buffers->x2[row],
+                       (roots_number_t)buffers->number[row]);
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Compares roots of solver with reference roots and adds result to statistics.
+
+===============================================================================================================================
+*/
+void verify_row(accuracy_stats_t *stats, double a, double b, double c, double x1, double x2, roots_number_t number) {
+    C_ASSERT(stats != NULL, );
+
+    if(!isfinite(a) || !isfinite(b) || !isfinite(c)) {
+        stats->invalid++;
+        return ;
+    }
+    stats->equations++;
+
+    long double reference_x1 = 0, reference_x2 = 0;
+    roots_number_t reference = NOT_SOLVED;
+    reference_quadratic_roots(a, b, c, &reference_x1, &reference_x2, &reference);
+    stats->numbers[reference - INF_ROOTS][number - INF_ROOTS]++;
+
+    if(number != reference) {
+        stats->misclassified++;
+        stats->causes[misclassification_cause(a, b, c)]++;
+        return ;
+    }
+
+    ulp_histogram_t *histogram = &stats->ulps[reference - INF_ROOTS];
+    switch(reference) {
+        case ONE_ROOT: {
+            add_ulp_error(histogram, ulp_error(x1, reference_x1));
+            break;
+        }
+        case TWO_ROOTS: {
+            //order of roots depends on sign of a, so roots are paired in the way with smaller error
+            long double direct_x1  = ulp_error(x1, reference_x1), direct_x2  = ulp_error(x2, reference_x2);
+            long double swapped_x1 = ulp_error(x1, reference_x2), swapped_x2 = ulp_error(x2, reference_x1);
+            if(fmaxl(swapped_x1, swapped_x2) < fmaxl(direct_x1, direct_x2)) {
+                direct_x1 = swapped_x1;
+                direct_x2 = swapped_x2;
+            }
+            add_ulp_error(histogram, direct_x1);
+            add_ulp_error(histogram, direct_x2);
+            break;
+        }
+        case NO_ROOTS:
+        case INF_ROOTS:
+        case NOT_SOLVED: {
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Finds why solve_quadratic() found wrong number of roots (see accuracy_cause_t).
+
+===============================================================================================================================
+*/
+accuracy_cause_t misclassification_cause(double a, double b, double c) {
+    if(!is_exact_zero(a) && is_zero(a))
+        return ACCURACY_A_AS_ZERO;
+
+    if(is_exact_zero(a)) {
+        if(!is_exact_zero(b) && is_zero(b))
+            return ACCURACY_B_AS_ZERO;
+        if(is_zero(b) && !is_exact_zero(c) && is_zero(c))
+            return ACCURACY_C_AS_ZERO;
+        return ACCURACY_ROUNDING;
+    }
+
+    //the same expression as in solve_quadratic_roots_generic()
+    double discriminant = b * b - 4 * a * c;
+    if(!is_exact_zero(discriminant) && is_zero(discriminant))
+        return ACCURACY_DISCRIMINANT_AS_ZERO;
+    return ACCURACY_ROUNDING;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Adds error of one root to histogram.
+
+===============================================================================================================================
+*/
+void add_ulp_error(ulp_histogram_t *histogram, long double error) {
+    C_ASSERT(histogram != NULL, );
+
+    histogram->buckets[ulp_bucket(error)]++;
+    histogram->roots++;
+    histogram->sum += (double)error;
+    if((double)error > histogram->max || isnan(error))
+        histogram->max = (double)error;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns error of root in ulp of double, equal to reference root.
+
+    @details - Ulp of subnormal numbers and zero is the smallest subnormal number.
+
+===============================================================================================================================
+*/
+long double ulp_error(double root, long double reference) {
+    if(isnan(root))
+        return (long double)INFINITY;
+
+    int exponent = ilogbl(reference);
+    if(exponent < DBL_MIN_EXP - 1)
+        exponent = DBL_MIN_EXP - 1;
+    return fabsl((long double)root - reference) / ldexpl(1.0L, exponent - (DBL_MANT_DIG - 1));
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns bucket of histogram for error (see ACCURACY_ULP_BUCKETS).
+
+===============================================================================================================================
+*/
+size_t ulp_bucket(long double error) {
+    if(!(error > 0.5L))
+        return 0;
+    if(!isfinite(error))
+        return ACCURACY_ULP_BUCKETS - 1;
+
+    int exponent = 0;
+    long double mantissa = frexpl(error, &exponent);
+    size_t bucket = (size_t)exponent + (mantissa > 0.5L ? 1 : 0);
+    return bucket < ACCURACY_ULP_BUCKETS ? bucket : ACCURACY_ULP_BUCKETS - 1;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Adds statistics of one thread to total statistics.
+
+===============================================================================================================================
+*/
+void add_accuracy_stats(accuracy_stats_t *stats, const accuracy_stats_t *added) {
+    C_ASSERT(stats != NULL, );
+    C_ASSERT(added != NULL, );
+
+    stats->equations     += added->equations;
+    stats->invalid       += added->invalid;
+    stats->misclassified += added->misclassified;
+
+    for(size_t reference = 0; reference < STATS_ROOTS_NUMBERS; reference++)
+        for(size_t number = 0; number < STATS_ROOTS_NUMBERS; number++)
+            stats->numbers[reference][number] += added->numbers[reference][number];
+
+    for(size_t cause = 0; cause < ACCURACY_CAUSES_NUMBER; cause++)
+        stats->causes[cause] += added->causes[cause];
+
+    for(size_t number = 0; number < STATS_ROOTS_NUMBERS; number++) {
+        ulp_histogram_t *histogram = &stats->ulps[number];
+        const ulp_histogram_t *added_histogram = &added->ulps[number];
+
+        for(size_t bucket = 0; bucket < ACCURACY_ULP_BUCKETS; bucket++)
+            histogram->buckets[bucket] += added_histogram->buckets[bucket];
+        histogram->roots += added_histogram->roots;
+        histogram->sum   += added_histogram->sum;
+        if(added_histogram->max > histogram->max || isnan(added_histogram->max))
+            histogram->max = added_histogram->max;
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Converts result of reading file to accuracy_state_t.
+
+===============================================================================================================================
+*/
+accuracy_state_t get_accuracy_state(qbin_state_t state) {
+    switch(state) {
+        case QBIN_SUCCESS: {
+            return ACCURACY_SUCCESS;
+        }
+        case QBIN_NO_FILE: {
+            return ACCURACY_NO_FILE;
+        }
+        case QBIN_MEMORY_ERROR: {
+            return ACCURACY_MEMORY_ERROR;
+        }
+        case QBIN_INVALID_FILE:
+        case QBIN_WRONG_ENDIANNESS:
+        case QBIN_CHECKSUM_ERROR:
+        case QBIN_WRITING_ERROR: {
+            return ACCURACY_INVALID_FILE;
+        }
+        default: {
+            return ACCURACY_INVALID_FILE;
+        }
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Computes discriminant b^2 - 4ac from exact products in long double.
+
+    @details - Both products are represented as unevaluated sums of two long doubles,
+               difference of their big parts is exact when they are close (Sterbenz lemma).
+
+===============================================================================================================================
+*/
+long double reference_discriminant(double a, double b, double c) {
+    long double square = 0, square_error = 0;
+    exact_product(b, b, &square, &square_error);
+
+    long double product = 0, product_error = 0;
+    exact_product(4 * (long double)a, c, &product, &product_error);
+
+    return (square - product) + (square_error - product_error);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Computes product of x and y and its exact rounding error (Dekker's algorithm).
+
+===============================================================================================================================
+*/
+void exact_product(long double x, long double y, long double *product, long double *error) {
+    C_ASSERT(product != NULL, );
+    C_ASSERT(error   != NULL, );
+
+    long double x_high = 0, x_low = 0, y_high = 0, y_low = 0;
+    split_long_double(x, &x_high, &x_low);
+    split_long_double(y, &y_high, &y_low);
+
+    *product = x * y;
+    *error   = ((x_high * y_high - *product) + x_high * y_low + x_low * y_high) + x_low * y_low;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Splits x in two halves, whose mantissas have at most half of bits of long double.
+
+===============================================================================================================================
+*/
+void split_long_double(long double x, long double *high, long double *low) {
+    C_ASSERT(high != NULL, );
+    C_ASSERT(low  != NULL, );
+
+    long double scaled = SPLIT_FACTOR * x;
+    *high = scaled - (scaled - x);
+    *low  = x - *high;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Checks if number is zero exactly (of any sign).
+
+===============================================================================================================================
+*/
+bool is_exact_zero(double number) {
+    return fpclassify(number) == FP_ZERO;
+}
@@ -10,9 +10,18 @@
 */
 #include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
 #include "colors.h"
 #include "custom_assert.h"
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <io.h>
+#define isatty _isatty
+#define fileno _fileno
+#endif
+
 /**
 ===============================================================================================================================
     @brief   - Codes, that turn on colores when typed in console.
@@ -40,66 +49,209 @@ static const char *bold = "1";
 
 static const char *color_code_start = "\033[";
 
-static void reset_color(void);
-static void print_color_code(color_t color, bool is_bold, background_t background);
-const char *background_code(background_t background);
-const char *color_code(color_t color);
+static const char *reset_code = "\033[0m";
+
+/**
+===============================================================================================================================
+    @brief   - The maximum length of escape code with terminating zero ("\033[1;31;41m").
+
+===============================================================================================================================
+*/
+static const size_t MAX_ESCAPE_LENGTH = 16;
+
+static const size_t COLORS_NUMBER      = DEFAULT_TEXT + 1;
+static const size_t BACKGROUNDS_NUMBER = DEFAULT_BACKGROUND + 1;
+
+/**
+===============================================================================================================================
+    @brief   Escape codes for all combinations of color, boldness and background.
+
+===============================================================================================================================
+*/
+struct escape_table_t {
+    char codes[COLORS_NUMBER][2][BACKGROUNDS_NUMBER][MAX_ESCAPE_LENGTH];
+    size_t lengths[COLORS_NUMBER][2][BACKGROUNDS_NUMBER];
+};
+
+/**
+===============================================================================================================================
+    @brief   Output buffer of thread, it is written to stdout when thread exits.
+
+===============================================================================================================================
+*/
+struct color_buffer_t {
+    char data[COLOR_BUFFER_SIZE];
+    size_t size;
+
+    ~color_buffer_t() {
+        color_flush();
+    }
+};
+
+static escape_table_t make_escape_table(void);
+static size_t make_escape_code(char *out, color_t color, bool is_bold, background_t background);
+static void append_to_buffer(const char *text, size_t length);
+static bool is_terminal(FILE *stream);
+static const char *background_code(background_t background);
+static const char *color_code(color_t color);
+
+static const escape_table_t escape_table = make_escape_table();
+static bool colors_enabled = is_terminal(stdout);
+static FILE *color_stream = stdout;
+static thread_local color_buffer_t buffer = {};
 
 void color_printf(color_t color, bool is_bold, background_t background, const char *string, ...) {
     C_ASSERT(string != NULL, );
 
-    print_color_code(color, is_bold, background);
+    if(colors_enabled) {
+        size_t bold_index = is_bold ? 1 : 0;
+        append_to_buffer(escape_table.codes[color][bold_index][background], escape_table.lengths[color][bold_index][background]);
+    }
 
     va_list args;
     va_start(args, string);
-    vprintf(string, args);
+    va_list args_copy;
+    va_copy(args_copy, args);
+
+    size_t free_space = COLOR_BUFFER_SIZE - buffer.size;
+    int length = vsnprintf(buffer.data + buffer.size, free_space, string, args);
+    if(length >= 0 && (size_t)length < free_space)
+        buffer.size += (size_t)length;
+    else if(length >= 0) {
+        //text did not fit, it is formatted again after flush
+        color_flush();
+        if((size_t)length < COLOR_BUFFER_SIZE)
+            buffer.size = (size_t)vsnprintf(buffer.data, COLOR_BUFFER_SIZE, string, args_copy);
+        else
+            vfprintf(color_stream, string, args_copy);
+    }
 
-    reset_color();
+    va_end(args_copy);
     va_end(args);
+
+    if(colors_enabled)
+        append_to_buffer(reset_code, strlen(reset_code));
+}
+
+void color_flush(void) {
+    if(buffer.size == 0)
+        return ;
+
+    fwrite(buffer.data, 1, buffer.size, color_stream);
+    buffer.size = 0;
+}
+
+void set_colors_enabled(bool enabled) {
+    colors_enabled = enabled;
+}
+
+void set_color_stream(FILE *stream) {
+    C_ASSERT(stream != NULL, );
+
+    color_flush();
+    color_stream = stream;
+}
+
+void print_colored_assert_error(const char *string, int line_number, const char *filename) {
+    color_printf(RED_TEXT, true, DEFAULT_BACKGROUND,
+                 "-<<CUSTOM ASSERT>>-\n"
+                 "Caught error on line %d of file \"%s\"\n"
+                 "Expression: %s\n", line_number, filename, string);
+    color_flush();
+}
+
+/**
+===============================================================================================================================
+    @brief   - Makes escape codes for all combinations of color, boldness and background.
+
+===============================================================================================================================
+*/
+escape_table_t make_escape_table(void) {
+    escape_table_t table = {};
+
+    for(size_t color = 0; color < COLORS_NUMBER; color++)
+        for(size_t bold_index = 0; bold_index < 2; bold_index++)
+            for(size_t background = 0; background < BACKGROUNDS_NUMBER; background++)
+                table.lengths[color][bold_index][background] =
+                    make_escape_code(table.codes[color][bold_index][background],
+                                     (color_t)color, bold_index == 1, (background_t)background);
+
+    return table;
 }
 
-void print_color_code(color_t color, bool is_bold, background_t background) {
-    printf("%s", color_code_start);
+/**
+===============================================================================================================================
+    @brief   - Writes escape code, that turns on color, boldness and background.
+
+    @details - Code is empty if text is default, because text after every color_printf(...) is reset anyway.
+
+    @param   [out] out                Buffer of MAX_ESCAPE_LENGTH characters.
+
+    @return  Length of code.
+
+===============================================================================================================================
+*/
+size_t make_escape_code(char *out, color_t color, bool is_bold, background_t background) {
+    C_ASSERT(out != NULL, 0);
+
+    out[0] = '\0';
+    if(!is_bold && color == DEFAULT_TEXT && background == DEFAULT_BACKGROUND)
+        return 0;
+
+    strcat(out, color_code_start);
 
     //boldness
     if(is_bold == true) {
-        printf("%s", bold);
+        strcat(out, bold);
         if(color != DEFAULT_TEXT || background != DEFAULT_BACKGROUND)
-            printf(";");
-        else {
-            printf("m");
-            return ;
-        }
+            strcat(out, ";");
     }
 
     //color
     if(color != DEFAULT_TEXT) {
-        printf("%s", color_code(color));
+        strcat(out, color_code(color));
         if(background != DEFAULT_BACKGROUND)
-            printf(";");
-        else {
-            printf("m");
-            return ;
-        }
+            strcat(out, ";");
     }
 
     //background
-    if(background != DEFAULT_BACKGROUND) {
-        printf("%sm", background_code(background));
-        return ;
-    }
+    if(background != DEFAULT_BACKGROUND)
+        strcat(out, background_code(background));
 
-    reset_color();
+    strcat(out, "m");
+    return strlen(out);
 }
 
 /**
 ===============================================================================================================================
-    @brief   - Prints special code, that resets the color of text in console to default.
+    @brief   - Appends text to buffer of thread, buffer is flushed if text does not fit.
 
 ===============================================================================================================================
 */
-void reset_color(void){
-    printf("%s0m", color_code_start);
+void append_to_buffer(const char *text, size_t length) {
+    C_ASSERT(text != NULL, );
+
+    if(buffer.size + length > COLOR_BUFFER_SIZE)
+        color_flush();
+
+    memcpy(buffer.data + buffer.size, text, length);
+    buffer.size += length;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Checks if stream is written to terminal.
+
+===============================================================================================================================
+*/
+bool is_terminal(FILE *stream) {
+    C_ASSERT(stream != NULL, false);
+
+#if defined(__unix__) || defined(__APPLE__) || defined(_WIN32)
+    return isatty(fileno(stream)) != 0;
+#else
+    return true;
+#endif
 }
 
 const char *color_code(color_t color) {
@@ -10,11 +10,22 @@
 */
 #include <stdlib.h>
 #include "custom_assert.h"
-#include "colors.h"
+
+static assert_handler_t assert_handler = NULL;
+
+#if CONTRACT_LEVEL == CONTRACTS_SAMPLED
+static thread_local unsigned contract_sample_counter = 0;
+
+bool skip_sampled_contract(void) {
+    return ++contract_sample_counter % CONTRACT_SAMPLE_RATE != 0;
+}
+#endif
+
+void set_assert_handler(assert_handler_t handler) {
+    assert_handler = handler;
+}
 
 void print_assert_error(const char *string, int line_number, const char *filename) {
-    color_printf(RED_TEXT, true, DEFAULT_BACKGROUND,
-                 "-<<CUSTOM ASSERT>>-\n"
-                 "Caught error on line %d of file \"%s\"\n"
-                 "Expression: %s\n", line_number, filename, string);
+    if(assert_handler != NULL)
+        assert_handler(string, line_number, filename);
 }
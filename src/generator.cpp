@@ -0,0 +1,680 @@
+/**
+===============================================================================================================================
+    @file    generator.cpp
+    @brief   Generation of random workloads of quadratic equations with given mix of classes.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <charconv>
+#include "generator.h"
+#include "quadratic.h"
+#include "quadratic_precise.h"
+#include "qbin.h"
+#include "thread_pool.h"
+#include "custom_assert.h"
+
+/**
+===============================================================================================================================
+    @brief   - Number of bits of mantissas of roots and coefficients, products of three such numbers are exact.
+
+===============================================================================================================================
+*/
+static const int GENERATE_MANTISSA_BITS = 16;
+
+/**
+===============================================================================================================================
+    @brief   - Maximum difference of exponents of roots of GENERATE_TWO_ROOTS, so their sum is exact.
+
+===============================================================================================================================
+*/
+static const int TWO_ROOTS_EXPONENT_SPREAD = 20;
+
+/**
+===============================================================================================================================
+    @brief   - Maximum length of generated line "a b c x1 x2 roots_number\n" (shortest representation of double
+               takes at most 24 symbols).
+
+===============================================================================================================================
+*/
+static const size_t MAX_GENERATED_LINE_LENGTH = 160;
+
+/**
+===============================================================================================================================
+    @brief   - Number of blocks per thread, that are generated before they are written.
+
+===============================================================================================================================
+*/
+static const size_t GENERATE_BLOCKS_PER_THREAD = 2;
+
+/**
+===============================================================================================================================
+    @brief   State of xoshiro256** generator.
+
+===============================================================================================================================
+*/
+struct xoshiro_t {
+    uint64_t s[4];
+};
+
+/**
+===============================================================================================================================
+    @brief   Block of equations generated by one task.
+
+    @details - Block [first, first + size) is generated with generator seeded from seed and first / GENERATE_BLOCK_SIZE.
+
+===============================================================================================================================
+*/
+struct generator_block_t {
+    size_t first;
+    size_t size;
+    double *a, *b, *c;
+    double *x1, *x2;
+    int8_t *number;
+    char *text;
+    size_t text_size;
+    uint64_t classes[GENERATE_CLASSES_NUMBER];
+};
+
+/**
+===============================================================================================================================
+    @brief   Context of generating tasks.
+
+===============================================================================================================================
+*/
+struct generator_context_t {
+    generator_block_t *blocks;
+    const generator_config_t *config;
+    uint64_t total_weight;
+};
+
+static bool allocate_block(generator_block_t *block, const generator_config_t *config);
+static void free_block(generator_block_t *block);
+static void generate_blocks(size_t begin, size_t end, size_t worker, void *context);
+static void generate_block(generator_block_t *block, const generator_config_t *config, uint64_t total_weight);
+static void generate_block_coefficients(const generator_config_t *config, uint64_t total_weight, size_t first, size_t count,
+                                        double *a, double *b, double *c, uint64_t *classes);
+static uint64_t get_total_weight(const generator_config_t *config);
+static generator_class_t pick_class(xoshiro_t *random, const generator_config_t *config, uint64_t total_weight);
+static void generate_row(xoshiro_t *random, generator_class_t generator_class, int max_exponent,
+                         double *a, double *b, double *c);
+static void format_generated_block(generator_block_t *block, bool with_results);
+static char *append_number(char *position, char *end, double number);
+static void seed_xoshiro(xoshiro_t *random, uint64_t seed, uint64_t stream);
+static uint64_t next_random(xoshiro_t *random);
+static uint64_t random_below(xoshiro_t *random, uint64_t limit);
+static int random_exponent(xoshiro_t *random, int max_exponent);
+static double random_sign(xoshiro_t *random);
+static double random_dyadic(xoshiro_t *random, int exponent);
+static double truncate_mantissa(double number);
+
+/**
+===============================================================================================================================
+    @brief   - Names of classes in settings (in order of generator_class_t).
+
+===============================================================================================================================
+*/
+static const char *const CLASS_NAMES[GENERATE_CLASSES_NUMBER] = {"two", "one", "none", "linear", "inf", "near", "ill"};
+
+void init_generator_config(generator_config_t *config) {
+    C_ASSERT(config != NULL, );
+
+    config->seed         = 1;
+    config->max_exponent = 16;
+    config->with_results = true;
+    config->format       = GENERATE_TEXT;
+
+    config->weights[GENERATE_TWO_ROOTS]              = 40;
+    config->weights[GENERATE_ONE_ROOT]               = 10;
+    config->weights[GENERATE_NO_ROOTS]               = 20;
+    config->weights[GENERATE_LINEAR]                 = 10;
+    config->weights[GENERATE_INF_ROOTS]              = 5;
+    config->weights[GENERATE_NEAR_ZERO_DISCRIMINANT] = 10;
+    config->weights[GENERATE_ILL_CONDITIONED]        = 5;
+}
+
+bool parse_generator_setting(generator_config_t *config, const char *setting) {
+    C_ASSERT(config  != NULL, false);
+    C_ASSERT(setting != NULL, false);
+
+    const char *value = strchr(setting, '=');
+    if(value == NULL || value[1] == '\0' || value[1] == '-')
+        return false;
+    size_t key_length = (size_t)(value - setting);
+    value++;
+
+    char *end = NULL;
+    unsigned long long number = strtoull(value, &end, 0);
+    if(end == value || *end != '\0')
+        return false;
+
+    if(key_length == strlen("seed") && strncmp(setting, "seed", key_length) == 0) {
+        config->seed = number;
+        return true;
+    }
+    if(key_length == strlen("scale") && strncmp(setting, "scale", key_length) == 0) {
+        if(number > (unsigned long long)MAX_GENERATE_EXPONENT)
+            return false;
+        config->max_exponent = (int)number;
+        return true;
+    }
+    if(key_length == strlen("results") && strncmp(setting, "results", key_length) == 0) {
+        if(number > 1)
+            return false;
+        config->with_results = number == 1;
+        return true;
+    }
+
+    for(size_t generator_class = 0; generator_class < GENERATE_CLASSES_NUMBER; generator_class++) {
+        if(key_length == strlen(CLASS_NAMES[generator_class]) &&
+           strncmp(setting, CLASS_NAMES[generator_class], key_length) == 0) {
+            if(number > UINT32_MAX / GENERATE_CLASSES_NUMBER)
+                return false;
+            config->weights[generator_class] = (uint32_t)number;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char *generator_class_name(generator_class_t generator_class) {
+    switch(generator_class) {
+        case GENERATE_TWO_ROOTS:
+        case GENERATE_ONE_ROOT:
+        case GENERATE_NO_ROOTS:
+        case GENERATE_LINEAR:
+        case GENERATE_INF_ROOTS:
+        case GENERATE_NEAR_ZERO_DISCRIMINANT:
+        case GENERATE_ILL_CONDITIONED:
+            return CLASS_NAMES[generator_class];
+        case GENERATE_CLASSES_NUMBER:
+            return "unknown";
+        default:
+            return "unknown";
+    }
+}
+
+generator_state_t generate_equations(FILE *output, size_t count, const generator_config_t *config, generator_stats_t *stats) {
+    C_ASSERT(output != NULL, GENERATOR_WRITING_ERROR);
+    C_ASSERT(config != NULL, GENERATOR_INVALID_CONFIG);
+    C_ASSERT(stats  != NULL, GENERATOR_INVALID_CONFIG);
+
+    memset(stats, 0, sizeof(generator_stats_t));
+
+    uint64_t total_weight = get_total_weight(config);
+    if(total_weight == 0)
+        return GENERATOR_INVALID_CONFIG;
+
+    if(config->format == GENERATE_QBIN && write_qbin_header(output, count, config->with_results) != QBIN_SUCCESS)
+        return GENERATOR_WRITING_ERROR;
+
+    size_t blocks_number = get_threads_number() * GENERATE_BLOCKS_PER_THREAD;
+    generator_block_t *blocks = (generator_block_t *)calloc(blocks_number, sizeof(generator_block_t));
+    if(blocks == NULL)
+        return GENERATOR_MEMORY_ERROR;
+
+    generator_state_t state = GENERATOR_SUCCESS;
+    for(size_t block = 0; block < blocks_number; block++) {
+        if(!allocate_block(&blocks[block], config)) {
+            state = GENERATOR_MEMORY_ERROR;
+            break;
+        }
+    }
+
+    generator_context_t context = {.blocks = blocks, .config = config, .total_weight = total_weight};
+    size_t generated = 0;
+    while(state == GENERATOR_SUCCESS && generated < count) {
+        size_t window = 0;
+        for(; window < blocks_number && generated < count; window++) {
+            blocks[window].first = generated;
+            blocks[window].size  = count - generated < GENERATE_BLOCK_SIZE ? count - generated : GENERATE_BLOCK_SIZE;
+            generated += blocks[window].size;
+        }
+
+        parallel_for(window, 1, generate_blocks, &context);
+
+        for(size_t index = 0; index < window && state == GENERATOR_SUCCESS; index++) {
+            generator_block_t *block = &blocks[index];
+            for(size_t generator_class = 0; generator_class < GENERATE_CLASSES_NUMBER; generator_class++)
+                stats->classes[generator_class] += block->classes[generator_class];
+
+            switch(config->format) {
+                case GENERATE_TEXT: {
+                    if(fwrite(block->text, 1, block->text_size, output) != block->text_size)
+                        state = GENERATOR_WRITING_ERROR;
+                    break;
+                }
+                case GENERATE_QBIN: {
+                    if(write_qbin_rows(output, count, block->first, block->size, block->a, block->b, block->c,
+                                       block->x1, block->x2, block->number) != QBIN_SUCCESS)
+                        state = GENERATOR_WRITING_ERROR;
+                    break;
+                }
+                default: {
+                    state = GENERATOR_WRITING_ERROR;
+                    break;
+                }
+            }
+        }
+    }
+
+    for(size_t block = 0; block < blocks_number; block++)
+        free_block(&blocks[block]);
+    free(blocks);
+    return state;
+}
+
+bool generate_coefficients(const generator_config_t *config, size_t first, size_t count,
+                           double *a, double *b, double *c, generator_stats_t *stats) {
+    C_ASSERT(config != NULL, false);
+    C_ASSERT(a      != NULL, false);
+    C_ASSERT(b      != NULL, false);
+    C_ASSERT(c      != NULL, false);
+    C_ASSERT(stats  != NULL, false);
+    C_ASSERT(first % GENERATE_BLOCK_SIZE == 0, false);
+    C_ASSERT(count <= GENERATE_BLOCK_SIZE, false);
+
+    uint64_t total_weight = get_total_weight(config);
+    if(total_weight == 0)
+        return false;
+
+    generate_block_coefficients(config, total_weight, first, count, a, b, c, stats->classes);
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Allocates columns of block (results and text only if they are needed).
+
+===============================================================================================================================
+*/
+bool allocate_block(generator_block_t *block, const generator_config_t *config) {
+    C_ASSERT(block  != NULL, false);
+    C_ASSERT(config != NULL, false);
+
+    block->a = (double *)calloc(GENERATE_BLOCK_SIZE, sizeof(double));
+    block->b = (double *)calloc(GENERATE_BLOCK_SIZE, sizeof(double));
+    block->c = (double *)calloc(GENERATE_BLOCK_SIZE, sizeof(double));
+    if(block->a == NULL || block->b == NULL || block->c == NULL)
+        return false;
+
+    if(config->with_results) {
+        block->x1     = (double *)calloc(GENERATE_BLOCK_SIZE, sizeof(double));
+        block->x2     = (double *)calloc(GENERATE_BLOCK_SIZE, sizeof(double));
+        block->number = (int8_t *)calloc(GENERATE_BLOCK_SIZE, sizeof(int8_t));
+        if(block->x1 == NULL || block->x2 == NULL || block->number == NULL)
+            return false;
+    }
+
+    if(config->format == GENERATE_TEXT) {
+        block->text = (char *)calloc(GENERATE_BLOCK_SIZE, MAX_GENERATED_LINE_LENGTH);
+        if(block->text == NULL)
+            return false;
+    }
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Frees columns of block.
+
+===============================================================================================================================
+*/
+void free_block(generator_block_t *block) {
+    C_ASSERT(block != NULL, );
+
+    free(block->a);
+    free(block->b);
+    free(block->c);
+    free(block->x1);
+    free(block->x2);
+    free(block->number);
+    free(block->text);
+    memset(block, 0, sizeof(generator_block_t));
+}
+
+/**
+===============================================================================================================================
+    @brief   - Task of pool, that generates blocks [begin, end) of window.
+
+===============================================================================================================================
+*/
+void generate_blocks(size_t begin, size_t end, size_t worker, void *context) {
+    C_ASSERT(context != NULL, );
+    (void)worker;
+
+    generator_context_t *generator = (generator_context_t *)context;
+    for(size_t index = begin; index < end; index++)
+        generate_block(&generator->blocks[index], generator->config, generator->total_weight);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Generates equations of block, solves them if results are needed and formats them if output is text.
+
+===============================================================================================================================
+*/
+void generate_block(generator_block_t *block, const generator_config_t *config, uint64_t total_weight) {
+    C_ASSERT(block  != NULL, );
+    C_ASSERT(config != NULL, );
+
+    generate_block_coefficients(config, total_weight, block->first, block->size,
+                                block->a, block->b, block->c, block->classes);
+
+    for(size_t i = 0; i < block->size && config->with_results; i++) {
+        roots_number_t number = NOT_SOLVED;
+        block->x1[i] = block->x2[i] = 0;
+        if(solve_quadratic_precise_roots(block->a[i], block->b[i], block->c[i],
+                                         &block->x1[i], &block->x2[i], &number) != SOLVING_SUCCESS)
+            number = NOT_SOLVED;
+        block->number[i] = (int8_t)number;
+    }
+
+    if(config->format == GENERATE_TEXT)
+        format_generated_block(block, config->with_results);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Generates coefficients of equations [first, first + count) of one block and counts their classes.
+
+===============================================================================================================================
+*/
+void generate_block_coefficients(const generator_config_t *config, uint64_t total_weight, size_t first, size_t count,
+                                 double *a, double *b, double *c, uint64_t *classes) {
+    C_ASSERT(config  != NULL, );
+    C_ASSERT(a       != NULL, );
+    C_ASSERT(b       != NULL, );
+    C_ASSERT(c       != NULL, );
+    C_ASSERT(classes != NULL, );
+
+    xoshiro_t random = {};
+    seed_xoshiro(&random, config->seed, first / GENERATE_BLOCK_SIZE);
+    memset(classes, 0, GENERATE_CLASSES_NUMBER * sizeof(uint64_t));
+
+    for(size_t i = 0; i < count; i++) {
+        generator_class_t generator_class = pick_class(&random, config, total_weight);
+        classes[generator_class]++;
+        generate_row(&random, generator_class, config->max_exponent, &a[i], &b[i], &c[i]);
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns sum of weights of classes or 0 if config is invalid.
+
+===============================================================================================================================
+*/
+uint64_t get_total_weight(const generator_config_t *config) {
+    C_ASSERT(config != NULL, 0);
+
+    if(config->max_exponent < 0 || config->max_exponent > MAX_GENERATE_EXPONENT)
+        return 0;
+
+    uint64_t total_weight = 0;
+    for(size_t generator_class = 0; generator_class < GENERATE_CLASSES_NUMBER; generator_class++)
+        total_weight += config->weights[generator_class];
+    return total_weight;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Chooses class of equation with probabilities proportional to weights.
+
+===============================================================================================================================
+*/
+generator_class_t pick_class(xoshiro_t *random, const generator_config_t *config, uint64_t total_weight) {
+    C_ASSERT(random != NULL, GENERATE_TWO_ROOTS);
+    C_ASSERT(config != NULL, GENERATE_TWO_ROOTS);
+
+    uint64_t ticket = random_below(random, total_weight);
+    for(size_t generator_class = 0; generator_class < GENERATE_CLASSES_NUMBER; generator_class++) {
+        if(ticket < config->weights[generator_class])
+            return (generator_class_t)generator_class;
+        ticket -= config->weights[generator_class];
+    }
+    return GENERATE_TWO_ROOTS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Generates coefficients of equation of given class.
+
+    @details - GENERATE_TWO_ROOTS: a(x - r1)(x - r2), exponents of r1 and r2 differ at most by TWO_ROOTS_EXPONENT_SPREAD,
+               so b and c are exact.\n
+             - GENERATE_ONE_ROOT: a(x - r)^2, discriminant is exactly zero.\n
+             - GENERATE_NO_ROOTS: a and c have the same sign and b^2 < 4ac exactly.\n
+             - GENERATE_LINEAR: a is zero (of random sign), b(x - r).\n
+             - GENERATE_INF_ROOTS: all coefficients are zeros of random signs.\n
+             - GENERATE_NEAR_ZERO_DISCRIMINANT: a(x - r1)(x - r2) with |r1 - r2| / |r1| in [2^-30, 2^-17],
+               so discriminant is 2^-60 - 2^-34 of b^2 and naive formula loses about half of digits of roots.\n
+             - GENERATE_ILL_CONDITIONED: a(x - r1)(x - r2) with |r2| / |r1| about 2^-20 - 2^-60,
+               so -b +- sqrt(D) cancels for small root (b is rounded).
+
+===============================================================================================================================
+*/
+void generate_row(xoshiro_t *random, generator_class_t generator_class, int max_exponent,
+                  double *a, double *b, double *c) {
+    C_ASSERT(random != NULL, );
+    C_ASSERT(a      != NULL, );
+    C_ASSERT(b      != NULL, );
+    C_ASSERT(c      != NULL, );
+
+    switch(generator_class) {
+        case GENERATE_TWO_ROOTS: {
+            *a = random_dyadic(random, random_exponent(random, max_exponent));
+            int exponent = random_exponent(random, max_exponent);
+            double r1 = random_dyadic(random, exponent);
+            double r2 = random_dyadic(random, exponent + random_exponent(random, TWO_ROOTS_EXPONENT_SPREAD));
+            //mantissas are odd, so equal roots have equal bits
+            if(memcmp(&r1, &r2, sizeof(double)) == 0)
+                r2 = -r2;
+            *b = -*a * (r1 + r2);
+            *c = *a * r1 * r2;
+            break;
+        }
+        case GENERATE_ONE_ROOT: {
+            *a = random_dyadic(random, random_exponent(random, max_exponent));
+            double root = random_dyadic(random, random_exponent(random, max_exponent));
+            *b = -2 * *a * root;
+            *c = *a * root * root;
+            break;
+        }
+        case GENERATE_NO_ROOTS: {
+            *a = random_dyadic(random, random_exponent(random, max_exponent));
+            *c = copysign(random_dyadic(random, random_exponent(random, max_exponent)), *a);
+            double limit = 2 * sqrt(*a * *c);
+            *b = random_sign(random) * truncate_mantissa(limit * (double)(next_random(random) >> 11) * 0x1p-53);
+            if(!(*b * *b < 4 * *a * *c))
+                *b = 0;
+            break;
+        }
+        case GENERATE_LINEAR: {
+            *a = random_sign(random) * 0.0;
+            *b = random_dyadic(random, random_exponent(random, max_exponent));
+            *c = -*b * random_dyadic(random, random_exponent(random, max_exponent));
+            break;
+        }
+        case GENERATE_INF_ROOTS: {
+            *a = random_sign(random) * 0.0;
+            *b = random_sign(random) * 0.0;
+            *c = random_sign(random) * 0.0;
+            break;
+        }
+        case GENERATE_NEAR_ZERO_DISCRIMINANT: {
+            //3-bit a, 10-bit r1 and r2 = r1 + 2^-k r1, so products stay exact
+            *a = random_sign(random) * ldexp((double)(random_below(random, 7) + 1), random_exponent(random, max_exponent));
+            int exponent = random_exponent(random, max_exponent);
+            double r1 = random_sign(random) * ldexp((double)(random_below(random, 1 << 9) + (1 << 9)), exponent - 10);
+            int shift = 8 + (int)random_below(random, 13);
+            double r2 = r1 + random_sign(random) * ldexp(1.0, exponent - 10 - shift);
+            *b = -*a * (r1 + r2);
+            *c = *a * r1 * r2;
+            break;
+        }
+        case GENERATE_ILL_CONDITIONED: {
+            *a = random_dyadic(random, random_exponent(random, max_exponent));
+            int exponent = random_exponent(random, max_exponent);
+            double r1 = random_dyadic(random, exponent);
+            double r2 = random_dyadic(random, exponent - 20 - (int)random_below(random, 41));
+            *b = -*a * (r1 + r2);
+            *c = *a * r1 * r2;
+            break;
+        }
+        case GENERATE_CLASSES_NUMBER: {
+            *a = *b = *c = 0;
+            break;
+        }
+        default: {
+            *a = *b = *c = 0;
+            break;
+        }
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Formats equations of block to its text with the shortest representations, that are read back exactly.
+
+===============================================================================================================================
+*/
+void format_generated_block(generator_block_t *block, bool with_results) {
+    C_ASSERT(block != NULL, );
+
+    char *position = block->text;
+    for(size_t i = 0; i < block->size; i++) {
+        char *end = position + MAX_GENERATED_LINE_LENGTH;
+        position = append_number(position, end, block->a[i]);
+        *position++ = ' ';
+        position = append_number(position, end, block->b[i]);
+        *position++ = ' ';
+        position = append_number(position, end, block->c[i]);
+
+        if(with_results) {
+            *position++ = ' ';
+            position = append_number(position, end, block->x1[i]);
+            *position++ = ' ';
+            position = append_number(position, end, block->x2[i]);
+            *position++ = ' ';
+            position = std::to_chars(position, end, (int)block->number[i]).ptr;
+        }
+        *position++ = '\n';
+    }
+    block->text_size = (size_t)(position - block->text);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Writes the shortest representation of number, that is read back exactly.
+
+    @return  Position after number.
+
+===============================================================================================================================
+*/
+char *append_number(char *position, char *end, double number) {
+    C_ASSERT(position != NULL, position);
+    C_ASSERT(end      != NULL, position);
+
+    return std::to_chars(position, end, number).ptr;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Seeds generator of stream (number of block) with splitmix64, so streams are independent.
+
+===============================================================================================================================
+*/
+void seed_xoshiro(xoshiro_t *random, uint64_t seed, uint64_t stream) {
+    C_ASSERT(random != NULL, );
+
+    uint64_t state = seed ^ (stream * 0xD1B54A32D192ED03ULL);
+    for(size_t word = 0; word < sizeof(random->s) / sizeof(random->s[0]); word++) {
+        state += 0x9E3779B97F4A7C15ULL;
+        uint64_t mixed = state;
+        mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+        random->s[word] = mixed ^ (mixed >> 31);
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns next number of xoshiro256** generator.
+
+===============================================================================================================================
+*/
+uint64_t next_random(xoshiro_t *random) {
+    uint64_t *s = random->s;
+    uint64_t multiplied = s[1] * 5;
+    uint64_t result = ((multiplied << 7) | (multiplied >> 57)) * 9;
+    uint64_t shifted = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= shifted;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+
+    return result;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns random number in [0, limit) (limit must be positive).
+
+===============================================================================================================================
+*/
+uint64_t random_below(xoshiro_t *random, uint64_t limit) {
+    return next_random(random) % limit;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns random exponent in [-max_exponent, max_exponent].
+
+===============================================================================================================================
+*/
+int random_exponent(xoshiro_t *random, int max_exponent) {
+    return (int)random_below(random, 2 * (uint64_t)max_exponent + 1) - max_exponent;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns 1 or -1.
+
+===============================================================================================================================
+*/
+double random_sign(xoshiro_t *random) {
+    return (next_random(random) >> 63) != 0 ? -1.0 : 1.0;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns random number with odd GENERATE_MANTISSA_BITS-bit mantissa and magnitude in [2^(exponent - 16), 2^exponent).
+
+===============================================================================================================================
+*/
+double random_dyadic(xoshiro_t *random, int exponent) {
+    uint64_t mantissa = (random_below(random, (uint64_t)1 << (GENERATE_MANTISSA_BITS - 1)) << 1) | 1;
+    return random_sign(random) * ldexp((double)mantissa, exponent - GENERATE_MANTISSA_BITS);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Rounds number toward zero to GENERATE_MANTISSA_BITS significant bits.
+
+===============================================================================================================================
+*/
+double truncate_mantissa(double number) {
+    int exponent = 0;
+    double mantissa = frexp(number, &exponent);
+    return ldexp(trunc(ldexp(mantissa, GENERATE_MANTISSA_BITS)), exponent - GENERATE_MANTISSA_BITS);
+}
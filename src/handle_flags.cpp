@@ -12,12 +12,19 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <inttypes.h>
 #include "colors.h"
 #include "custom_assert.h"
 #include "handle_flags.h"
 #include "quadratic.h"
 #include "quadratic_tests.h"
 #include "handlers.h"
+#include "thread_pool.h"
+#include "quadratic_precise.h"
+#include "solve_cache.h"
+#include "quadratic_dedup.h"
+#include "stream_solve.h"
+#include "solve_stats.h"
 
 /**
 ===============================================================================================================================
@@ -31,21 +38,137 @@ struct solving_mode_t {
     exit_code_t (*handle_function)(const int argc, const char *argv[]);
 };
 
+/**
+===============================================================================================================================
+    @brief Structure to store names and handle functions of options, that can be used with any mode.
+
+    @details Options are removed from arguments before arguments are passed to mode.
+
+===============================================================================================================================
+*/
+struct program_option_t {
+    const char *long_name;
+    const char *short_name;
+    bool has_value;
+    bool (*handle_function)(const char *value);
+};
+
 enum push_state_t {
     PUSHED_SUCCESSFULLY,
     PUSHING_ERROR
 };
 
 const solving_mode_t modes[] =
-    {{"--test" , "-t", handle_test },
-     {"--help" , "-h", handle_help },
-     {"--solve", "-s", handle_solve}};
+    {{"--test"           , "-t" , handle_test           },
+     {"--help"           , "-h" , handle_help           },
+     {"--solve"          , "-s" , handle_solve          },
+     {"--solve-stream"   , "-ss", handle_solve_stream   },
+     {"--test-batch"     , "-tb", handle_test_batch     },
+     {"--to-qbin"        , "-tq", handle_to_qbin        },
+     {"--from-qbin"      , "-fq", handle_from_qbin      },
+     {"--embed-tests"    , "-et", handle_embed_tests    },
+     {"--self-test"      , "-st", handle_self_test      },
+     {"--serve"          , "-sv", handle_serve          },
+     {"--load"           , "-ld", handle_load           },
+     {"--shm"            , "-sm", handle_shm            },
+     {"--shm-ping"       , "-sp", handle_shm_ping       },
+     {"--generate"       , "-g" , handle_generate       },
+     {"--verify-accuracy", "-va", handle_verify_accuracy},
+     {"--count-only"     , "-co", handle_count_only     },
+     {"--sweep"          , "-sw", handle_sweep          }};
+
+static bool handle_threads_option(const char *value);
+static bool handle_no_color_option(const char *value);
+static bool handle_precise_option(const char *value);
+static bool handle_cache_option(const char *value);
+static bool handle_dedup_option(const char *value);
+static bool handle_pipeline_stats_option(const char *value);
+static bool handle_stats_option(const char *value);
+
+const program_option_t options[] =
+    {{"--threads"       , "-j" , true , handle_threads_option       },
+     {"--no-color"      , "-nc", false, handle_no_color_option      },
+     {"--precise"       , "-p" , false, handle_precise_option       },
+     {"--cache"         , "-c" , true , handle_cache_option         },
+     {"--dedup"         , "-d" , false, handle_dedup_option         },
+     {"--pipeline-stats", "-ps", false, handle_pipeline_stats_option},
+     {"--stats"         , "-sa", false, handle_stats_option         }};
 
 exit_code_t (* const default_handler)(const int, const char**) = handle_solve;
 
+static exit_code_t run_mode(const int argc, const char *argv[]);
+static const program_option_t *find_option(const char *flag);
+static void print_cache_stats(void);
+static void print_dedup_stats(void);
+static void print_pipeline_stats(void);
+static void print_queue_stats(const char *name, const pipeline_queue_stats_t *stats);
+static void print_solve_stats(void);
+static void print_solve_stats_json(const solve_stats_t *stats);
+
+static bool pipeline_stats_printing = false;
+
 exit_code_t parse_flags(const int argc, const char *argv[]){
     C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
 
+    const char **mode_argv = (const char **)calloc((size_t)argc + 1, sizeof(const char *));
+    if(mode_argv == NULL) {
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Unable to allocate memory for arguments\n");
+        return EXIT_CODE_FAILURE;
+    }
+
+    //removing options from arguments
+    int mode_argc = 0;
+    for(int arg = 0; arg < argc; arg++) {
+        const program_option_t *option = arg == 0 ? NULL : find_option(argv[arg]);
+        if(option == NULL) {
+            mode_argv[mode_argc++] = argv[arg];
+            continue;
+        }
+
+        const char *value = NULL;
+        if(option->has_value) {
+            if(arg + 1 >= argc) {
+                color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Option '%s' needs a value\n", argv[arg]);
+                free(mode_argv);
+                return EXIT_CODE_FAILURE;
+            }
+            value = argv[++arg];
+        }
+
+        if(!option->handle_function(value)) {
+            free(mode_argv);
+            return EXIT_CODE_FAILURE;
+        }
+    }
+
+    exit_code_t exit_code = run_mode(mode_argc, mode_argv);
+    free(mode_argv);
+
+    if(get_solve_cache_capacity() != 0)
+        print_cache_stats();
+    if(is_batch_dedup())
+        print_dedup_stats();
+    if(pipeline_stats_printing)
+        print_pipeline_stats();
+    if(solve_stats_enabled)
+        print_solve_stats();
+    return exit_code;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Runs mode named by argv[1] (or default mode if there is no argv[1]).
+
+    @param   [in]  argc               Number of strings in argv.
+    @param   [in]  argv               Array of strings with flags, options are already removed.
+
+    @return  Exit code.
+
+===============================================================================================================================
+*/
+exit_code_t run_mode(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
     if(argc == 1)
         return default_handler(argc, argv);
 
@@ -58,6 +181,300 @@ exit_code_t parse_flags(const int argc, const char *argv[]){
     return handle_unknown_flag(argv[1]);
 }
 
+/**
+===============================================================================================================================
+    @brief   - Searches option by its long or short name.
+
+    @param   [in]  flag               String typed in by user.
+
+    @return  Pointer to option or NULL if flag is not an option.
+
+===============================================================================================================================
+*/
+const program_option_t *find_option(const char *flag) {
+    C_ASSERT(flag != NULL, NULL);
+
+    for(size_t option = 0; option < sizeof(options) / sizeof(program_option_t); option++) {
+        if(strcmp(options[option].long_name , flag) == 0 ||
+           strcmp(options[option].short_name, flag) == 0)
+            return &options[option];
+    }
+    return NULL;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Handles '--threads N' option.
+
+    @details - N must be positive integer, it is number of threads used by batch solvers.
+
+    @param   [in]  value              String with N.
+
+    @return  True if option is valid and false if not.
+
+===============================================================================================================================
+*/
+bool handle_threads_option(const char *value) {
+    C_ASSERT(value != NULL, false);
+
+    char *end = NULL;
+    unsigned long threads = strtoul(value, &end, 10);
+    if(end == value || *end != '\0' || threads == 0 || value[0] == '-') {
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Invalid number of threads '%s'\n", value);
+        return false;
+    }
+
+    set_threads_number((size_t)threads);
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Handles '--no-color' option, that turns off escape codes in output.
+
+    @param   [in]  value              Is not used (option has no value).
+
+    @return  True.
+
+===============================================================================================================================
+*/
+bool handle_no_color_option(const char *value) {
+    (void)value;
+
+    set_colors_enabled(false);
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Handles '--precise' option, that turns on precise solver (see quadratic_precise.h).
+
+    @param   [in]  value              Is not used (option has no value).
+
+    @return  True.
+
+===============================================================================================================================
+*/
+bool handle_precise_option(const char *value) {
+    (void)value;
+
+    set_precise_solving(true);
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Handles '--cache N' option, that turns on cache of N equations per thread (see solve_cache.h).
+
+    @param   [in]  value              String with N.
+
+    @return  True if option is valid and false if not.
+
+===============================================================================================================================
+*/
+bool handle_cache_option(const char *value) {
+    C_ASSERT(value != NULL, false);
+
+    char *end = NULL;
+    unsigned long long capacity = strtoull(value, &end, 10);
+    if(end == value || *end != '\0' || value[0] == '-' || capacity > MAX_SOLVE_CACHE_CAPACITY ||
+       !set_solve_cache_capacity((size_t)capacity)) {
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Invalid cache capacity '%s' (0 - %zu)\n",
+                     value, MAX_SOLVE_CACHE_CAPACITY);
+        return false;
+    }
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Prints counters of cache to stderr, so they are not mixed with results.
+
+===============================================================================================================================
+*/
+void print_cache_stats(void) {
+    solve_cache_stats_t stats = {};
+    get_solve_cache_stats(&stats);
+
+    color_flush();
+    fflush(stdout);
+    fprintf(stderr, "Cache: %" PRIu64 " hits, %" PRIu64 " misses, %" PRIu64 " evictions\n",
+            stats.hits, stats.misses, stats.evictions);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Handles '--dedup' option, that turns on deduplication of batches (see quadratic_dedup.h).
+
+    @param   [in]  value              Is not used (option has no value).
+
+    @return  True.
+
+===============================================================================================================================
+*/
+bool handle_dedup_option(const char *value) {
+    (void)value;
+
+    set_batch_dedup(true);
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Prints number of rows and unique equations of deduplicated batches to stderr.
+
+===============================================================================================================================
+*/
+void print_dedup_stats(void) {
+    dedup_stats_t stats = {};
+    get_dedup_stats(&stats);
+
+    color_flush();
+    fflush(stdout);
+    fprintf(stderr, "Dedup: %" PRIu64 " rows, %" PRIu64 " unique (%.1lf%%)\n",
+            stats.rows, stats.unique, stats.rows == 0 ? 0.0 : 100.0 * (double)stats.unique / (double)stats.rows);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Handles '--pipeline-stats' option, that turns on printing of counters of '--solve-stream' pipeline.
+
+    @param   [in]  value              Is not used (option has no value).
+
+    @return  True.
+
+===============================================================================================================================
+*/
+bool handle_pipeline_stats_option(const char *value) {
+    (void)value;
+
+    pipeline_stats_printing = true;
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Prints counters of queues of the last stream pipeline to stderr.
+
+===============================================================================================================================
+*/
+void print_pipeline_stats(void) {
+    pipeline_stats_t stats = {};
+    get_pipeline_stats(&stats);
+
+    color_flush();
+    fflush(stdout);
+    fprintf(stderr, "Pipeline: %zu solvers, %zu blocks of %zu equations\n",
+            stats.solvers_number, stats.blocks_number, stats.block_size);
+    print_queue_stats("reader -> solvers", &stats.parsed);
+    print_queue_stats("solvers -> writer", &stats.solved);
+    print_queue_stats("writer -> reader" , &stats.free);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Prints statistics of queue to stderr.
+
+===============================================================================================================================
+*/
+void print_queue_stats(const char *name, const pipeline_queue_stats_t *stats) {
+    C_ASSERT(name  != NULL, );
+    C_ASSERT(stats != NULL, );
+
+    double mean_depth = stats->pushes == 0 ? 0.0 : (double)stats->depth_sum / (double)stats->pushes;
+    fprintf(stderr, "  %-18s %10" PRIu64 " blocks, mean depth %5.2lf, max depth %zu, "
+                    "producer stalls %" PRIu64 ", consumer stalls %" PRIu64 "\n",
+            name, stats->pushes, mean_depth, stats->max_depth, stats->full_stalls, stats->empty_stalls);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Handles '--stats' option, that turns on counters of solve_quadratic() results
+               and histograms of time of stages (see solve_stats.h).
+
+    @param   [in]  value              Is not used (option has no value).
+
+    @return  True.
+
+===============================================================================================================================
+*/
+bool handle_stats_option(const char *value) {
+    (void)value;
+
+    set_solve_stats_enabled(true);
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Prints statistics as table and then as one line of JSON to stderr.
+
+===============================================================================================================================
+*/
+void print_solve_stats(void) {
+    solve_stats_t *stats = (solve_stats_t *)calloc(1, sizeof(solve_stats_t));
+    if(stats == NULL) {
+        fprintf(stderr, "Unable to allocate memory for statistics\n");
+        return ;
+    }
+    get_solve_stats(stats);
+
+    color_flush();
+    fflush(stdout);
+
+    fprintf(stderr, "Stats:\n  solve_quadratic():");
+    for(size_t state = 0; state < STATS_SOLVING_STATES; state++)
+        fprintf(stderr, " %s %" PRIu64, stats_solving_state_name((solving_state_t)state), stats->solving_states[state]);
+    fprintf(stderr, "\n  roots:");
+    for(size_t number = 0; number < STATS_ROOTS_NUMBERS; number++)
+        fprintf(stderr, " %s %" PRIu64, stats_roots_name((roots_number_t)((int)number + INF_ROOTS)), stats->roots_numbers[number]);
+
+    fprintf(stderr, "\n  %-8s %12s %10s %10s %10s %10s %10s %10s\n",
+            "stage", "samples", "mean ns", "p50 ns", "p90 ns", "p99 ns", "p99.9 ns", "max ns");
+    for(size_t stage = 0; stage < STATS_STAGES_NUMBER; stage++) {
+        const latency_histogram_t *histogram = &stats->stages[stage];
+        double mean = histogram->samples == 0 ? 0.0 : (double)histogram->sum / (double)histogram->samples;
+        fprintf(stderr, "  %-8s %12" PRIu64 " %10.1lf %10" PRIu64 " %10" PRIu64 " %10" PRIu64 " %10" PRIu64 " %10" PRIu64 "\n",
+                stats_stage_name((stats_stage_t)stage), histogram->samples, mean,
+                latency_percentile(histogram, 50.0), latency_percentile(histogram, 90.0),
+                latency_percentile(histogram, 99.0), latency_percentile(histogram, 99.9), histogram->max);
+    }
+
+    print_solve_stats_json(stats);
+    free(stats);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Prints statistics as one line of JSON to stderr.
+
+===============================================================================================================================
+*/
+void print_solve_stats_json(const solve_stats_t *stats) {
+    C_ASSERT(stats != NULL, );
+
+    fprintf(stderr, "{\"solving_states\": {");
+    for(size_t state = 0; state < STATS_SOLVING_STATES; state++)
+        fprintf(stderr, "%s\"%s\": %" PRIu64, state == 0 ? "" : ", ",
+                stats_solving_state_name((solving_state_t)state), stats->solving_states[state]);
+
+    fprintf(stderr, "}, \"roots_numbers\": {");
+    for(size_t number = 0; number < STATS_ROOTS_NUMBERS; number++)
+        fprintf(stderr, "%s\"%s\": %" PRIu64, number == 0 ? "" : ", ",
+                stats_roots_name((roots_number_t)((int)number + INF_ROOTS)), stats->roots_numbers[number]);
+
+    fprintf(stderr, "}, \"stages_ns\": {");
+    for(size_t stage = 0; stage < STATS_STAGES_NUMBER; stage++) {
+        const latency_histogram_t *histogram = &stats->stages[stage];
+        fprintf(stderr, "%s\"%s\": {\"samples\": %" PRIu64 ", \"sum\": %" PRIu64 ", \"p50\": %" PRIu64
+                        ", \"p90\": %" PRIu64 ", \"p99\": %" PRIu64 ", \"p99.9\": %" PRIu64 ", \"max\": %" PRIu64 "}",
+                stage == 0 ? "" : ", ", stats_stage_name((stats_stage_t)stage), histogram->samples, histogram->sum,
+                latency_percentile(histogram, 50.0), latency_percentile(histogram, 90.0),
+                latency_percentile(histogram, 99.0), latency_percentile(histogram, 99.9), histogram->max);
+    }
+    fprintf(stderr, "}}\n");
+}
+
 exit_code_t handle_unknown_flag(const char *flag){
     C_ASSERT(flag != NULL, EXIT_CODE_FAILURE);
     color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Unknown flag '%s'\n", flag);
@@ -10,12 +10,41 @@
 */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
 #include "colors.h"
 #include "handle_flags.h"
 #include "handlers.h"
 #include "quadratic.h"
+#include "quadratic_io.h"
 #include "quadratic_tests.h"
 #include "custom_assert.h"
+#include "stream_solve.h"
+#include "mapped_file.h"
+#include "qbin.h"
+#include "solve_server.h"
+#include "load_client.h"
+#include "shm_ring.h"
+#include "solve_stats.h"
+#include "generator.h"
+#include "accuracy.h"
+#include "quadratic_batch.h"
+#include "sweep.h"
+
+static bool print_shm_state(shm_state_t state, const char *name);
+static void print_accuracy_stats(const accuracy_stats_t *stats, double seconds);
+static exit_code_t count_columns_roots(const double *a, const double *b, const double *c, size_t count,
+                                       const char *codes_name);
+static bool write_roots_numbers(FILE *output, const int8_t *number, size_t count);
+
+/**
+===============================================================================================================================
+    @brief   Size of buffer of write_roots_numbers(...).
+
+===============================================================================================================================
+*/
+static const size_t NUMBERS_BUFFER_SIZE = 1 << 12;
 
 exit_code_t handle_help(const int argc, const char *argv[]) {
     if(argc != 2) {
@@ -27,8 +56,54 @@ exit_code_t handle_help(const int argc, const char *argv[]) {
     color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " for help\n");
     color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--solve'");
     color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to type in and solve equation\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--solve-stream (input) (output)'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to solve \"a b c\" lines from file (or stdin) to file (or stdout) without prompts\n");
     color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--test (filename)'");
-    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to run tests\n");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to run tests (text or .qbin file)\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--to-qbin (text file) (qbin file)'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to convert coefficients or tests to binary format\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--from-qbin (qbin file) (text file)'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to convert binary file to text (stdout by default)\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--test-batch (filename)'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to check vectorized batch kernels\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--self-test'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to run tests compiled into program without reading files\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--embed-tests (tests file) (header)'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to write tests as constexpr table for include/golden_tests.h (stdout by default)\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--serve (port or socket path)'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to solve \"a b c\" lines sent through local socket until Ctrl+C (Linux only)\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--load (port or socket path) (connections) (requests)'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to load '--serve' with requests and print latency, default is 4 connections and 100000 requests\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--shm (name)'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to solve equations of local processes through shared memory ring until Ctrl+C (Linux only)\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--shm-ping (name) (requests)'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to measure round trips to '--shm', default is 100000 requests\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--generate N [out] [key=value ...]'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to write N random equations with expected roots (.qbin if out ends with '.qbin'),"
+                                                          " keys: seed, scale, results (0/1) and weights two, one, none, linear, inf, near, ill\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--verify-accuracy N [file] [key=value ...]'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to compare roots of N random equations ('--generate' keys) or of the first N equations of"
+                                                          " .qbin or text file (all if N is 0) with long double reference and print ulp errors\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--count-only (file) [codes]'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to find only numbers of roots of equations of .qbin or text file and print how many equations"
+                                                          " have every number (or write number of every equation to codes file)\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--sweep a=A0:A1:DA b=B0:B1:DB c=C0:C1:DC [out]'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " to solve every equation of grid of coefficients (axis can be single value 'a=1')"
+                                                          " and write them with roots (.qbin if out ends with '.qbin')\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--threads N'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " (with any mode) to solve batches with N threads, default is number of cores\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--no-color'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " (with any mode) to print without colors, default if output is not a terminal\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--precise'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " (with any mode) to find number of roots by exact sign of discriminant and roots without cancellation\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--cache N'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " (with any mode) to keep roots of N last equations per thread and print hits, misses and evictions\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--dedup'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " (with '--solve-stream' or .qbin tests) to solve every unique equation of batch once\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--pipeline-stats'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " (with '--solve-stream') to print depth and stalls of queues between reader, solvers and writer\n");
+    color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t'--stats'");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " (with '--solve' or '--test') to print results of solve_quadratic() and time of read, solve, compare and output as table and JSON\n");
     color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "\t''");
     color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, " is considered as ");
     color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "'--solve'\n");
@@ -61,7 +136,12 @@ exit_code_t handle_solve(const int argc, const char *argv[]) {
     }
 
     //Solving quadratic
-    switch(solve_quadratic(&equation)) {
+    uint64_t start = start_stats_stage();
+    solving_state_t solving_state = solve_quadratic(&equation);
+    finish_stats_stage(STATS_STAGE_SOLVE, start);
+    count_solving_result(solving_state, equation.number);
+
+    switch(solving_state) {
         case INVALID_COEFFICIENTS: {
             color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Your input was invalid, unable to solve equation :(\n");
             return EXIT_CODE_FAILURE;
@@ -71,7 +151,9 @@ exit_code_t handle_solve(const int argc, const char *argv[]) {
             return EXIT_CODE_FAILURE;
         }
         case SOLVING_SUCCESS: {
+            start = start_stats_stage();
             print_quadratic_result(&equation);
+            finish_stats_stage(STATS_STAGE_OUTPUT, start);
             return EXIT_CODE_SUCCESS;
         }
         default: {
@@ -86,6 +168,7 @@ exit_code_t handle_test(const int argc, const char *argv[]) {
     C_ASSERT(argc >= 0,    EXIT_CODE_FAILURE);
 
     int total = 0, errors = 0;
+    size_t error_line = 0;
     const char *filename = DEFAULT_TEST_FILE_NAME;
     if(argc == 3) {
         filename = argv[2];
@@ -94,13 +177,16 @@ exit_code_t handle_test(const int argc, const char *argv[]) {
         handle_unknown_flag(argv[3]);
         return EXIT_CODE_FAILURE;
     }
-    switch(test_solving_quadratic(&total, &errors, filename)) {
+    switch(test_solving_quadratic(&total, &errors, filename, &error_line)) {
         case NO_SUCH_FILE: {
             color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "There is no file \"%s\"\n", filename);
             return EXIT_CODE_FAILURE;
         }
         case INVALID_LINES:{
-            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Tests file is invalid\n");
+            if(error_line != 0)
+                color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Tests file is invalid (line %zu)\n", error_line);
+            else
+                color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Tests file is invalid\n");
             return EXIT_CODE_FAILURE;
         }
         case SUCCESS_TEST: {
@@ -109,12 +195,879 @@ exit_code_t handle_test(const int argc, const char *argv[]) {
             return EXIT_CODE_SUCCESS;
         }
         case TEST_ERROR: {
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Unable to read file \"%s\"\n", filename);
+            return EXIT_CODE_FAILURE;
+        }
+        default: {
             color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Unexpected return value from test function\n");
             return EXIT_CODE_FAILURE;
         }
+    }
+}
+
+exit_code_t handle_test_batch(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+    C_ASSERT(argc >= 0,    EXIT_CODE_FAILURE);
+
+    int total = 0, errors = 0;
+    const char *filename = DEFAULT_TEST_FILE_NAME;
+    if(argc == 3) {
+        filename = argv[2];
+    }
+    if(argc > 3) {
+        handle_unknown_flag(argv[3]);
+        return EXIT_CODE_FAILURE;
+    }
+    switch(test_batch_solving(&total, &errors, filename)) {
+        case NO_SUCH_FILE: {
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "There is no file \"%s\"\n", filename);
+            return EXIT_CODE_FAILURE;
+        }
+        case INVALID_LINES:{
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Tests file is invalid\n");
+            return EXIT_CODE_FAILURE;
+        }
+        case SUCCESS_TEST: {
+            color_printf(YELLOW_TEXT, false, DEFAULT_BACKGROUND, "All batch kernels have been checked\n");
+            color_printf(errors == 0 ? GREEN_TEXT : RED_TEXT, false, DEFAULT_BACKGROUND, "Total: %d, Errors: %d", total, errors);
+            return errors == 0 ? EXIT_CODE_SUCCESS : EXIT_CODE_FAILURE;
+        }
+        case TEST_ERROR: {
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Unable to allocate memory for batch tests\n");
+            return EXIT_CODE_FAILURE;
+        }
         default: {
             color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Unexpected return value from test function\n");
             return EXIT_CODE_FAILURE;
         }
     }
 }
+
+exit_code_t handle_solve_stream(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
+    if(argc > 4) {
+        handle_unknown_flag(argv[4]);
+        return EXIT_CODE_FAILURE;
+    }
+
+    const char *input_name  = argc >= 3 ? argv[2] : "-";
+    const char *output_name = argc >= 4 ? argv[3] : "-";
+
+    bool is_stdin = strcmp(input_name, "-") == 0;
+    mapped_file_t mapped_input = {};
+    if(!is_stdin && map_file(input_name, &mapped_input) != MAPPING_SUCCESS) {
+        fprintf(stderr, "Unable to read file \"%s\"\n", input_name);
+        return EXIT_CODE_FAILURE;
+    }
+
+    FILE *output = strcmp(output_name, "-") == 0 ? stdout : fopen(output_name, "w");
+    if(output == NULL) {
+        fprintf(stderr, "Unable to open file \"%s\"\n", output_name);
+        unmap_file(&mapped_input);
+        return EXIT_CODE_FAILURE;
+    }
+
+    size_t equations = 0, error_line = 0;
+    stream_state_t state = is_stdin ? solve_stream(stdin, output, &equations, &error_line) :
+                                      solve_stream_mapped(&mapped_input, output, &equations, &error_line);
+
+    unmap_file(&mapped_input);
+    if(output != stdout && fclose(output) != 0 && state == STREAM_SUCCESS)
+        state = STREAM_WRITING_ERROR;
+
+    switch(state) {
+        case STREAM_SUCCESS: {
+            return EXIT_CODE_SUCCESS;
+        }
+        case STREAM_READING_ERROR: {
+            fprintf(stderr, "Invalid line %zu in \"%s\" (expected \"a b c\"), %zu equations solved\n",
+                    error_line, input_name, equations);
+            return EXIT_CODE_FAILURE;
+        }
+        case STREAM_WRITING_ERROR: {
+            fprintf(stderr, "Unable to write results to \"%s\"\n", output_name);
+            return EXIT_CODE_FAILURE;
+        }
+        case STREAM_MEMORY_ERROR: {
+            fprintf(stderr, "Unable to allocate memory for stream\n");
+            return EXIT_CODE_FAILURE;
+        }
+        default: {
+            fprintf(stderr, "Unexpected return value from stream solver\n");
+            return EXIT_CODE_FAILURE;
+        }
+    }
+}
+
+exit_code_t handle_to_qbin(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
+    if(argc != 4) {
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Usage: '--to-qbin (text file) (qbin file)'\n");
+        return EXIT_CODE_FAILURE;
+    }
+
+    size_t count = 0, error_line = 0;
+    qbin_state_t state = convert_text_to_qbin(argv[2], argv[3], &count, &error_line);
+    if(state == QBIN_SUCCESS) {
+        color_printf(GREEN_TEXT, false, DEFAULT_BACKGROUND, "Converted %zu equations to \"%s\"\n", count, argv[3]);
+        return EXIT_CODE_SUCCESS;
+    }
+
+    if(state == QBIN_INVALID_FILE && error_line != 0)
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Line %zu of \"%s\" is invalid\n", error_line, argv[2]);
+    else
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Unable to convert \"%s\": %s\n", argv[2], qbin_state_message(state));
+    return EXIT_CODE_FAILURE;
+}
+
+exit_code_t handle_from_qbin(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
+    if(argc != 3 && argc != 4) {
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Usage: '--from-qbin (qbin file) (text file)'\n");
+        return EXIT_CODE_FAILURE;
+    }
+
+    const char *output_name = argc == 4 ? argv[3] : "-";
+    FILE *output = strcmp(output_name, "-") == 0 ? stdout : fopen(output_name, "w");
+    if(output == NULL) {
+        fprintf(stderr, "Unable to open file \"%s\"\n", output_name);
+        return EXIT_CODE_FAILURE;
+    }
+    setvbuf(output, NULL, _IOFBF, STREAM_BUFFER_SIZE);
+
+    size_t count = 0;
+    qbin_state_t state = convert_qbin_to_text(argv[2], output, &count);
+    if(fflush(output) != 0 && state == QBIN_SUCCESS)
+        state = QBIN_WRITING_ERROR;
+    if(output != stdout && fclose(output) != 0 && state == QBIN_SUCCESS)
+        state = QBIN_WRITING_ERROR;
+
+    if(state != QBIN_SUCCESS) {
+        fprintf(stderr, "Unable to convert \"%s\": %s\n", argv[2], qbin_state_message(state));
+        return EXIT_CODE_FAILURE;
+    }
+    return EXIT_CODE_SUCCESS;
+}
+
+exit_code_t handle_embed_tests(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
+    if(argc > 4) {
+        handle_unknown_flag(argv[4]);
+        return EXIT_CODE_FAILURE;
+    }
+
+    const char *filename    = argc >= 3 ? argv[2] : DEFAULT_TEST_FILE_NAME;
+    const char *output_name = argc >= 4 ? argv[3] : "-";
+
+    bool is_stdout = strcmp(output_name, "-") == 0;
+    FILE *output = is_stdout ? stdout : fopen(output_name, "w");
+    if(output == NULL) {
+        fprintf(stderr, "Unable to open file \"%s\"\n", output_name);
+        return EXIT_CODE_FAILURE;
+    }
+
+    size_t count = 0, error_line = 0;
+    test_state_t state = embed_golden_tests(filename, output, &count, &error_line);
+
+    bool written = fflush(output) == 0;
+    if(!is_stdout)
+        written = fclose(output) == 0 && written;
+
+    //incomplete header is removed, so it is not compiled
+    if((state != SUCCESS_TEST || !written) && !is_stdout)
+        remove(output_name);
+
+    switch(state) {
+        case SUCCESS_TEST: {
+            if(!written) {
+                fprintf(stderr, "Unable to write header to \"%s\"\n", output_name);
+                return EXIT_CODE_FAILURE;
+            }
+            fprintf(stderr, "Embedded %zu tests from \"%s\"\n", count, filename);
+            return EXIT_CODE_SUCCESS;
+        }
+        case NO_SUCH_FILE: {
+            fprintf(stderr, "There is no file \"%s\"\n", filename);
+            return EXIT_CODE_FAILURE;
+        }
+        case INVALID_LINES: {
+            if(error_line != 0)
+                fprintf(stderr, "Tests file is invalid (line %zu)\n", error_line);
+            else
+                fprintf(stderr, "There are no tests in \"%s\"\n", filename);
+            return EXIT_CODE_FAILURE;
+        }
+        case TEST_ERROR: {
+            fprintf(stderr, "Unable to read file \"%s\"\n", filename);
+            return EXIT_CODE_FAILURE;
+        }
+        default: {
+            fprintf(stderr, "Unexpected return value from test function\n");
+            return EXIT_CODE_FAILURE;
+        }
+    }
+}
+
+exit_code_t handle_self_test(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
+    if(argc != 2) {
+        handle_unknown_flag(argv[2]);
+        return EXIT_CODE_FAILURE;
+    }
+
+    int total = 0, errors = 0;
+    if(test_golden_solving(&total, &errors) != SUCCESS_TEST) {
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Caught unexpected error while testing\n");
+        return EXIT_CODE_FAILURE;
+    }
+
+    color_printf(YELLOW_TEXT, false, DEFAULT_BACKGROUND, "All embedded tests have been carried out\n");
+    color_printf(errors == 0 ? GREEN_TEXT : RED_TEXT, false, DEFAULT_BACKGROUND, "Total: %d, Errors: %d", total, errors);
+    return errors == 0 ? EXIT_CODE_SUCCESS : EXIT_CODE_FAILURE;
+}
+
+exit_code_t handle_serve(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
+    if(argc != 3) {
+        if(argc < 3)
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Port or socket path is expected after '%s'\n", argv[1]);
+        else
+            handle_unknown_flag(argv[3]);
+        return EXIT_CODE_FAILURE;
+    }
+
+    fprintf(stderr, "Serving on \"%s\", press Ctrl+C to stop\n", argv[2]);
+
+    server_stats_t stats = {};
+    switch(run_server(argv[2], &stats)) {
+        case SERVER_SUCCESS: {
+            break;
+        }
+        case SERVER_ADDRESS_ERROR: {
+            fprintf(stderr, "Invalid port or socket path \"%s\"\n", argv[2]);
+            return EXIT_CODE_FAILURE;
+        }
+        case SERVER_SOCKET_ERROR: {
+            fprintf(stderr, "Unable to listen on \"%s\"\n", argv[2]);
+            return EXIT_CODE_FAILURE;
+        }
+        case SERVER_MEMORY_ERROR: {
+            fprintf(stderr, "Unable to allocate memory for server\n");
+            return EXIT_CODE_FAILURE;
+        }
+        case SERVER_UNSUPPORTED: {
+            fprintf(stderr, "Server mode is supported only on Linux\n");
+            return EXIT_CODE_FAILURE;
+        }
+        default: {
+            fprintf(stderr, "Unexpected return value from server\n");
+            return EXIT_CODE_FAILURE;
+        }
+    }
+
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND,
+                 "Connections: %" PRIu64 ", requests: %" PRIu64 ", invalid: %" PRIu64 ", batches: %" PRIu64
+                 ", mean batch: %.1lf, max batch: %zu\n",
+                 stats.connections, stats.requests, stats.invalid_requests, stats.batches,
+                 stats.batches == 0 ? 0.0 : (double)stats.requests / (double)stats.batches, stats.max_batch);
+    print_latency_histogram("Latency", &stats.latency);
+    return EXIT_CODE_SUCCESS;
+}
+
+exit_code_t handle_load(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
+    if(argc < 3 || argc > 5) {
+        if(argc < 3)
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Port or socket path is expected after '%s'\n", argv[1]);
+        else
+            handle_unknown_flag(argv[5]);
+        return EXIT_CODE_FAILURE;
+    }
+
+    size_t numbers[] = {4, 100000};
+    for(int arg = 3; arg < argc; arg++) {
+        char *end = NULL;
+        unsigned long long number = strtoull(argv[arg], &end, 10);
+        if(end == argv[arg] || *end != '\0' || number == 0 || argv[arg][0] == '-' ||
+           (arg == 3 && number > MAX_LOAD_CONNECTIONS)) {
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Invalid number '%s'\n", argv[arg]);
+            return EXIT_CODE_FAILURE;
+        }
+        numbers[arg - 3] = (size_t)number;
+    }
+
+    load_stats_t stats = {};
+    switch(run_load(argv[2], numbers[0], numbers[1], &stats)) {
+        case LOAD_SUCCESS: {
+            break;
+        }
+        case LOAD_CONNECTION_ERROR: {
+            fprintf(stderr, "Connection with \"%s\" failed, %" PRIu64 " replies received\n", argv[2], stats.requests);
+            return EXIT_CODE_FAILURE;
+        }
+        case LOAD_PROTOCOL_ERROR: {
+            fprintf(stderr, "Unexpected reply from \"%s\"\n", argv[2]);
+            return EXIT_CODE_FAILURE;
+        }
+        case LOAD_MEMORY_ERROR: {
+            fprintf(stderr, "Unable to allocate memory for connections\n");
+            return EXIT_CODE_FAILURE;
+        }
+        case LOAD_UNSUPPORTED: {
+            fprintf(stderr, "Load mode is supported only on Linux\n");
+            return EXIT_CODE_FAILURE;
+        }
+        default: {
+            fprintf(stderr, "Unexpected return value from load client\n");
+            return EXIT_CODE_FAILURE;
+        }
+    }
+
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND,
+                 "Requests: %" PRIu64 ", connections: %zu, time: %.3lf s, throughput: %.0lf requests/s\n",
+                 stats.requests, numbers[0], stats.seconds,
+                 stats.seconds > 0 ? (double)stats.requests / stats.seconds : 0.0);
+    print_latency_histogram("Latency", &stats.latency);
+    color_printf(stats.mismatches == 0 ? GREEN_TEXT : RED_TEXT, false, DEFAULT_BACKGROUND,
+                 "Wrong replies: %" PRIu64 "\n", stats.mismatches);
+    return stats.mismatches == 0 ? EXIT_CODE_SUCCESS : EXIT_CODE_FAILURE;
+}
+
+exit_code_t handle_shm(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
+    if(argc != 3) {
+        if(argc < 3)
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Name of shared memory is expected after '%s'\n", argv[1]);
+        else
+            handle_unknown_flag(argv[3]);
+        return EXIT_CODE_FAILURE;
+    }
+
+    fprintf(stderr, "Serving shared memory \"%s\", press Ctrl+C to stop\n", argv[2]);
+
+    shm_server_stats_t stats = {};
+    if(!print_shm_state(run_shm_server(argv[2], &stats), argv[2]))
+        return EXIT_CODE_FAILURE;
+
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND,
+                 "Requests: %" PRIu64 ", batches: %" PRIu64 ", mean batch: %.1lf, max batch: %zu, "
+                 "sleeps: %" PRIu64 ", reclaimed slots: %" PRIu64 "\n",
+                 stats.requests, stats.batches, stats.batches == 0 ? 0.0 : (double)stats.requests / (double)stats.batches,
+                 stats.max_batch, stats.sleeps, stats.reclaimed);
+    return EXIT_CODE_SUCCESS;
+}
+
+exit_code_t handle_shm_ping(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
+    if(argc < 3 || argc > 4) {
+        if(argc < 3)
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Name of shared memory is expected after '%s'\n", argv[1]);
+        else
+            handle_unknown_flag(argv[4]);
+        return EXIT_CODE_FAILURE;
+    }
+
+    size_t requests = 100000;
+    if(argc == 4) {
+        char *end = NULL;
+        unsigned long long number = strtoull(argv[3], &end, 10);
+        if(end == argv[3] || *end != '\0' || number == 0 || argv[3][0] == '-') {
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Invalid number '%s'\n", argv[3]);
+            return EXIT_CODE_FAILURE;
+        }
+        requests = (size_t)number;
+    }
+
+    shm_ping_stats_t stats = {};
+    if(!print_shm_state(run_shm_ping(argv[2], requests, &stats), argv[2]))
+        return EXIT_CODE_FAILURE;
+
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND,
+                 "Requests: %" PRIu64 ", time: %.3lf s, throughput: %.0lf requests/s\n",
+                 stats.requests, stats.seconds, stats.seconds > 0 ? (double)stats.requests / stats.seconds : 0.0);
+    print_latency_histogram("Round trip", &stats.latency);
+    color_printf(stats.mismatches == 0 ? GREEN_TEXT : RED_TEXT, false, DEFAULT_BACKGROUND,
+                 "Wrong replies: %" PRIu64 "\n", stats.mismatches);
+    return stats.mismatches == 0 ? EXIT_CODE_SUCCESS : EXIT_CODE_FAILURE;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Prints error of shared memory server or client to stderr.
+
+    @param   [in]  state              Return value of run_shm_server() or run_shm_ping().
+    @param   [in]  name               Name of shared memory object.
+
+    @return  True if state is SHM_SUCCESS.
+
+===============================================================================================================================
+*/
+bool print_shm_state(shm_state_t state, const char *name) {
+    C_ASSERT(name != NULL, false);
+
+    switch(state) {
+        case SHM_SUCCESS: {
+            return true;
+        }
+        case SHM_NAME_ERROR: {
+            fprintf(stderr, "Invalid name of shared memory \"%s\"\n", name);
+            return false;
+        }
+        case SHM_NO_SERVER: {
+            fprintf(stderr, "There is no running '--shm' server with name \"%s\"\n", name);
+            return false;
+        }
+        case SHM_MAPPING_ERROR: {
+            fprintf(stderr, "Unable to map shared memory \"%s\"\n", name);
+            return false;
+        }
+        case SHM_MEMORY_ERROR: {
+            fprintf(stderr, "Unable to allocate memory for shared memory server\n");
+            return false;
+        }
+        case SHM_UNSUPPORTED: {
+            fprintf(stderr, "Shared memory mode is supported only on Linux\n");
+            return false;
+        }
+        default: {
+            fprintf(stderr, "Unexpected return value from shared memory solver\n");
+            return false;
+        }
+    }
+}
+
+exit_code_t handle_generate(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
+    if(argc < 3) {
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Usage: '--generate N [out] [key=value ...]'\n");
+        return EXIT_CODE_FAILURE;
+    }
+
+    char *end = NULL;
+    unsigned long long count = strtoull(argv[2], &end, 10);
+    if(end == argv[2] || *end != '\0' || argv[2][0] == '-' || count > SIZE_MAX) {
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Invalid number of equations '%s'\n", argv[2]);
+        return EXIT_CODE_FAILURE;
+    }
+
+    generator_config_t config = {};
+    init_generator_config(&config);
+
+    const char *output_name = "-";
+    int arg = 3;
+    if(arg < argc && strchr(argv[arg], '=') == NULL)
+        output_name = argv[arg++];
+    for(; arg < argc; arg++) {
+        if(!parse_generator_setting(&config, argv[arg])) {
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Invalid setting '%s'\n", argv[arg]);
+            return EXIT_CODE_FAILURE;
+        }
+    }
+
+    size_t name_length = strlen(output_name);
+    const char *qbin_suffix = ".qbin";
+    if(name_length >= strlen(qbin_suffix) && strcmp(output_name + name_length - strlen(qbin_suffix), qbin_suffix) == 0)
+        config.format = GENERATE_QBIN;
+
+    bool to_stdout = strcmp(output_name, "-") == 0;
+    FILE *output = to_stdout ? stdout : fopen(output_name, config.format == GENERATE_QBIN ? "wb" : "w");
+    if(output == NULL) {
+        fprintf(stderr, "Unable to open file \"%s\"\n", output_name);
+        return EXIT_CODE_FAILURE;
+    }
+    setvbuf(output, NULL, _IOFBF, STREAM_BUFFER_SIZE);
+
+    generator_stats_t stats = {};
+    uint64_t start = get_stats_time();
+    generator_state_t state = generate_equations(output, (size_t)count, &config, &stats);
+    double seconds = (double)(get_stats_time() - start) / 1e9;
+
+    if(fflush(output) != 0 && state == GENERATOR_SUCCESS)
+        state = GENERATOR_WRITING_ERROR;
+    if(!to_stdout && fclose(output) != 0 && state == GENERATOR_SUCCESS)
+        state = GENERATOR_WRITING_ERROR;
+
+    switch(state) {
+        case GENERATOR_SUCCESS: {
+            break;
+        }
+        case GENERATOR_INVALID_CONFIG: {
+            fprintf(stderr, "At least one weight of classes must be positive\n");
+            return EXIT_CODE_FAILURE;
+        }
+        case GENERATOR_WRITING_ERROR: {
+            fprintf(stderr, "Unable to write \"%s\"%s\n", output_name,
+                    config.format == GENERATE_QBIN ? " (.qbin output must be regular file)" : "");
+            return EXIT_CODE_FAILURE;
+        }
+        case GENERATOR_MEMORY_ERROR: {
+            fprintf(stderr, "Unable to allocate memory for blocks\n");
+            return EXIT_CODE_FAILURE;
+        }
+        default: {
+            fprintf(stderr, "Unexpected return value from generator\n");
+            return EXIT_CODE_FAILURE;
+        }
+    }
+
+    fprintf(stderr, "Generated %llu equations in %.3lf s (%.1lf millions per second):", count, seconds,
+            seconds > 0 ? (double)count / seconds / 1e6 : 0.0);
+    for(size_t generator_class = 0; generator_class < GENERATE_CLASSES_NUMBER; generator_class++)
+        fprintf(stderr, " %s %" PRIu64, generator_class_name((generator_class_t)generator_class), stats.classes[generator_class]);
+    fprintf(stderr, "\n");
+    return EXIT_CODE_SUCCESS;
+}
+
+exit_code_t handle_verify_accuracy(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
+    if(argc < 3) {
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Usage: '--verify-accuracy N [file] [key=value ...]'\n");
+        return EXIT_CODE_FAILURE;
+    }
+
+    char *end = NULL;
+    unsigned long long count = strtoull(argv[2], &end, 10);
+    if(end == argv[2] || *end != '\0' || argv[2][0] == '-' || count > SIZE_MAX) {
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Invalid number of equations '%s'\n", argv[2]);
+        return EXIT_CODE_FAILURE;
+    }
+
+    generator_config_t config = {};
+    init_generator_config(&config);
+
+    const char *input_name = NULL;
+    int arg = 3;
+    if(arg < argc && strchr(argv[arg], '=') == NULL)
+        input_name = argv[arg++];
+    for(; arg < argc; arg++) {
+        if(input_name != NULL || !parse_generator_setting(&config, argv[arg])) {
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Invalid setting '%s'\n", argv[arg]);
+            return EXIT_CODE_FAILURE;
+        }
+    }
+
+    accuracy_stats_t *stats = (accuracy_stats_t *)calloc(1, sizeof(accuracy_stats_t));
+    if(stats == NULL) {
+        fprintf(stderr, "Unable to allocate memory for statistics\n");
+        return EXIT_CODE_FAILURE;
+    }
+
+    size_t error_line = 0;
+    uint64_t start = get_stats_time();
+    accuracy_state_t state = input_name == NULL ? verify_accuracy_random((size_t)count, &config, stats) :
+                                                  verify_accuracy_file(input_name, (size_t)count, stats, &error_line);
+    double seconds = (double)(get_stats_time() - start) / 1e9;
+
+    exit_code_t exit_code = EXIT_CODE_FAILURE;
+    switch(state) {
+        case ACCURACY_SUCCESS: {
+            print_accuracy_stats(stats, seconds);
+            exit_code = EXIT_CODE_SUCCESS;
+            break;
+        }
+        case ACCURACY_INVALID_CONFIG: {
+            fprintf(stderr, "At least one weight of classes must be positive\n");
+            break;
+        }
+        case ACCURACY_NO_FILE: {
+            fprintf(stderr, "Unable to open file \"%s\"\n", input_name);
+            break;
+        }
+        case ACCURACY_INVALID_FILE: {
+            if(error_line != 0)
+                fprintf(stderr, "Invalid line %zu of file \"%s\"\n", error_line, input_name);
+            else
+                fprintf(stderr, "Invalid .qbin file \"%s\"\n", input_name);
+            break;
+        }
+        case ACCURACY_MEMORY_ERROR: {
+            fprintf(stderr, "Unable to allocate memory for equations\n");
+            break;
+        }
+        default: {
+            fprintf(stderr, "Unexpected return value from accuracy verification\n");
+            break;
+        }
+    }
+
+    free(stats);
+    return exit_code;
+}
+
+exit_code_t handle_sweep(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
+    if(argc < 3) {
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Usage: '--sweep a=A0:A1:DA b=B0:B1:DB c=C0:C1:DC [out]'\n");
+        return EXIT_CODE_FAILURE;
+    }
+
+    sweep_config_t config = {};
+    init_sweep_config(&config);
+
+    const char *output_name = NULL;
+    for(int arg = 2; arg < argc; arg++) {
+        if(strchr(argv[arg], '=') == NULL && output_name == NULL)
+            output_name = argv[arg];
+        else if(!parse_sweep_axis(&config, argv[arg])) {
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Invalid axis '%s'\n", argv[arg]);
+            return EXIT_CODE_FAILURE;
+        }
+    }
+    if(output_name == NULL)
+        output_name = "-";
+
+    size_t name_length = strlen(output_name);
+    const char *qbin_suffix = ".qbin";
+    if(name_length >= strlen(qbin_suffix) && strcmp(output_name + name_length - strlen(qbin_suffix), qbin_suffix) == 0)
+        config.format = SWEEP_QBIN;
+
+    bool to_stdout = strcmp(output_name, "-") == 0;
+    FILE *output = to_stdout ? stdout : fopen(output_name, config.format == SWEEP_QBIN ? "wb" : "w");
+    if(output == NULL) {
+        fprintf(stderr, "Unable to open file \"%s\"\n", output_name);
+        return EXIT_CODE_FAILURE;
+    }
+    setvbuf(output, NULL, _IOFBF, STREAM_BUFFER_SIZE);
+
+    sweep_stats_t stats = {};
+    uint64_t start = get_stats_time();
+    sweep_state_t state = sweep_equations(output, &config, &stats);
+    double seconds = (double)(get_stats_time() - start) / 1e9;
+
+    if(fflush(output) != 0 && state == SWEEP_SUCCESS)
+        state = SWEEP_WRITING_ERROR;
+    if(!to_stdout && fclose(output) != 0 && state == SWEEP_SUCCESS)
+        state = SWEEP_WRITING_ERROR;
+
+    switch(state) {
+        case SWEEP_SUCCESS: {
+            break;
+        }
+        case SWEEP_INVALID_GRID: {
+            fprintf(stderr, "Grid has too many equations\n");
+            return EXIT_CODE_FAILURE;
+        }
+        case SWEEP_WRITING_ERROR: {
+            fprintf(stderr, "Unable to write \"%s\"%s\n", output_name,
+                    config.format == SWEEP_QBIN ? " (.qbin output must be regular file)" : "");
+            return EXIT_CODE_FAILURE;
+        }
+        case SWEEP_MEMORY_ERROR: {
+            fprintf(stderr, "Unable to allocate memory for tiles\n");
+            return EXIT_CODE_FAILURE;
+        }
+        default: {
+            fprintf(stderr, "Unexpected return value from sweep\n");
+            return EXIT_CODE_FAILURE;
+        }
+    }
+
+    fprintf(stderr, "Swept %" PRIu64 " equations in %.3lf s (%.1lf millions per second):", stats.equations, seconds,
+            seconds > 0 ? (double)stats.equations / seconds / 1e6 : 0.0);
+    for(size_t number = 0; number < ROOTS_COUNTS_NUMBER; number++)
+        fprintf(stderr, " %s %" PRIu64, stats_roots_name((roots_number_t)((int)number + INF_ROOTS)), stats.numbers[number]);
+    fprintf(stderr, "\n");
+    return EXIT_CODE_SUCCESS;
+}
+
+exit_code_t handle_count_only(const int argc, const char *argv[]) {
+    C_ASSERT(argv != NULL, EXIT_CODE_FAILURE);
+
+    if(argc < 3 || argc > 4) {
+        color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Usage: '--count-only (file) [codes]'\n");
+        return EXIT_CODE_FAILURE;
+    }
+
+    const char *input_name = argv[2];
+    qbin_view_t view = {};
+    qbin_columns_t columns = {};
+    const double *a = NULL, *b = NULL, *c = NULL;
+    size_t count = 0, error_line = 0;
+    bool is_qbin = is_qbin_file(input_name);
+
+    qbin_state_t qbin_state = is_qbin ? open_qbin(input_name, &view, false) :
+                                        read_text_columns(input_name, &columns, &error_line);
+    if(qbin_state != QBIN_SUCCESS) {
+        if(error_line != 0)
+            fprintf(stderr, "Invalid line %zu of file \"%s\"\n", error_line, input_name);
+        else
+            fprintf(stderr, "Unable to read \"%s\": %s\n", input_name, qbin_state_message(qbin_state));
+        return EXIT_CODE_FAILURE;
+    }
+    if(is_qbin) {
+        a     = view.a;
+        b     = view.b;
+        c     = view.c;
+        count = view.count;
+    }
+    else {
+        a     = columns.a;
+        b     = columns.b;
+        c     = columns.c;
+        count = columns.size;
+    }
+
+    exit_code_t exit_code = count_columns_roots(a, b, c, count, argc == 4 ? argv[3] : NULL);
+
+    if(is_qbin)
+        close_qbin(&view);
+    else
+        free_qbin_columns(&columns);
+    return exit_code;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Prints matrix of roots numbers, causes of misclassifications and histograms of ulp errors.
+
+    @details - Histograms are printed up to the last not empty bucket.
+
+    @param   [in]  stats              Pointer to results of verification.
+    @param   [in]  seconds            Time of verification.
+
+===============================================================================================================================
+*/
+void print_accuracy_stats(const accuracy_stats_t *stats, double seconds) {
+    C_ASSERT(stats != NULL, );
+
+    printf("Verified %" PRIu64 " equations in %.3lf s (%.1lf millions per second), skipped %" PRIu64 " with not finite coefficients\n",
+           stats->equations, seconds, seconds > 0 ? (double)stats->equations / seconds / 1e6 : 0.0, stats->invalid);
+
+    printf("Roots numbers (rows are reference, columns are solve_quadratic()):\n  %-10s", "");
+    for(size_t number = 0; number < STATS_ROOTS_NUMBERS; number++)
+        printf(" %12s", stats_roots_name((roots_number_t)((int)number + INF_ROOTS)));
+    for(size_t reference = 0; reference < STATS_ROOTS_NUMBERS; reference++) {
+        printf("\n  %-10s", stats_roots_name((roots_number_t)((int)reference + INF_ROOTS)));
+        for(size_t number = 0; number < STATS_ROOTS_NUMBERS; number++)
+            printf(" %12" PRIu64, stats->numbers[reference][number]);
+    }
+
+    printf("\nMisclassified %" PRIu64 ":", stats->misclassified);
+    for(size_t cause = 0; cause < ACCURACY_CAUSES_NUMBER; cause++)
+        printf(" %s %" PRIu64, accuracy_cause_name((accuracy_cause_t)cause), stats->causes[cause]);
+
+    const ulp_histogram_t *one = &stats->ulps[ONE_ROOT  - INF_ROOTS];
+    const ulp_histogram_t *two = &stats->ulps[TWO_ROOTS - INF_ROOTS];
+    size_t buckets = 1;
+    for(size_t bucket = 0; bucket < ACCURACY_ULP_BUCKETS; bucket++) {
+        if(one->buckets[bucket] != 0 || two->buckets[bucket] != 0)
+            buckets = bucket + 1;
+    }
+
+    printf("\nUlp errors of roots of equations with right number of roots:\n  %-12s %12s %12s\n",
+           "error <=", stats_roots_name(ONE_ROOT), stats_roots_name(TWO_ROOTS));
+    for(size_t bucket = 0; bucket < buckets; bucket++)
+        printf("  %-12.6lg %12" PRIu64 " %12" PRIu64 "\n", ulp_bucket_limit(bucket), one->buckets[bucket], two->buckets[bucket]);
+    printf("  %-12s %12.3lg %12.3lg\n", "mean", one->roots == 0 ? 0.0 : one->sum / (double)one->roots,
+                                                 two->roots == 0 ? 0.0 : two->sum / (double)two->roots);
+    printf("  %-12s %12.3lg %12.3lg\n", "max", one->max, two->max);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Classifies columns of '--count-only' with all threads and prints counts or writes codes file.
+
+    @param   [in]  a, b, c            Columns of coefficients.
+    @param   [in]  count              Number of equations.
+    @param   [in]  codes_name         Name of codes file (NULL to print counts).
+
+    @return  Exit code of mode.
+
+===============================================================================================================================
+*/
+exit_code_t count_columns_roots(const double *a, const double *b, const double *c, size_t count, const char *codes_name) {
+    C_ASSERT(a != NULL, EXIT_CODE_FAILURE);
+    C_ASSERT(b != NULL, EXIT_CODE_FAILURE);
+    C_ASSERT(c != NULL, EXIT_CODE_FAILURE);
+
+    uint64_t counts[ROOTS_COUNTS_NUMBER] = {};
+    int8_t *number = NULL;
+    if(codes_name != NULL) {
+        number = (int8_t *)calloc(count == 0 ? 1 : count, sizeof(int8_t));
+        if(number == NULL) {
+            fprintf(stderr, "Unable to allocate memory for numbers of roots\n");
+            return EXIT_CODE_FAILURE;
+        }
+    }
+
+    uint64_t start = get_stats_time();
+    solving_state_t state = number != NULL ? classify_quadratic_batch_parallel(a, b, c, count, number, NULL) :
+                                             count_quadratic_roots_parallel(a, b, c, count, counts);
+    double seconds = (double)(get_stats_time() - start) / 1e9;
+
+    if(state == SOLVING_ERROR) {
+        fprintf(stderr, "Unable to classify equations\n");
+        free(number);
+        return EXIT_CODE_FAILURE;
+    }
+    fprintf(stderr, "Classified %zu equations in %.3lf s (%.1lf millions per second)\n",
+            count, seconds, seconds > 0 ? (double)count / seconds / 1e6 : 0.0);
+
+    if(number == NULL) {
+        for(size_t roots = 0; roots < ROOTS_COUNTS_NUMBER; roots++)
+            printf("%-10s %" PRIu64 "\n", stats_roots_name((roots_number_t)((int)roots + INF_ROOTS)), counts[roots]);
+        return EXIT_CODE_SUCCESS;
+    }
+
+    FILE *output = fopen(codes_name, "w");
+    if(output == NULL) {
+        fprintf(stderr, "Unable to open file \"%s\"\n", codes_name);
+        free(number);
+        return EXIT_CODE_FAILURE;
+    }
+    bool is_written = write_roots_numbers(output, number, count);
+    free(number);
+    if(fclose(output) != 0 || !is_written) {
+        fprintf(stderr, "Unable to write file \"%s\"\n", codes_name);
+        return EXIT_CODE_FAILURE;
+    }
+
+    return EXIT_CODE_SUCCESS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Writes numbers of roots, one per line, through buffer of NUMBERS_BUFFER_SIZE bytes.
+
+    @param   [in]  output             Opened file.
+    @param   [in]  number             Column of numbers of roots.
+    @param   [in]  count              Number of equations.
+
+    @return  False if output could not be written.
+
+===============================================================================================================================
+*/
+bool write_roots_numbers(FILE *output, const int8_t *number, size_t count) {
+    C_ASSERT(output != NULL, false);
+    C_ASSERT(number != NULL, false);
+
+    char buffer[NUMBERS_BUFFER_SIZE] = {};
+    size_t size = 0;
+
+    for(size_t i = 0; i < count; i++) {
+        //every number is at most "-2\n"
+        if(size + 3 > NUMBERS_BUFFER_SIZE) {
+            if(fwrite(buffer, 1, size, output) != size)
+                return false;
+            size = 0;
+        }
+        if(number[i] < 0)
+            buffer[size++] = '-';
+        buffer[size++] = (char)('0' + (number[i] < 0 ? -number[i] : number[i]));
+        buffer[size++] = '\n';
+    }
+
+    return fwrite(buffer, 1, size, output) == size;
+}
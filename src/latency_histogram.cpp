@@ -0,0 +1,124 @@
+/**
+===============================================================================================================================
+    @file    latency_histogram.cpp
+    @brief   Collecting latencies and finding their percentiles.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <inttypes.h>
+#include "latency_histogram.h"
+#include "colors.h"
+#include "custom_assert.h"
+
+/**
+===============================================================================================================================
+    @brief   - Number of bits of sub-bucket in bucket index.
+
+===============================================================================================================================
+*/
+static const unsigned LATENCY_SUB_BUCKET_BITS = 3;
+
+static_assert(1u << LATENCY_SUB_BUCKET_BITS == LATENCY_SUB_BUCKETS, "LATENCY_SUB_BUCKET_BITS does not match LATENCY_SUB_BUCKETS");
+
+static size_t latency_bucket(uint64_t nanoseconds);
+static uint64_t bucket_upper_bound(size_t bucket);
+
+void add_latency(latency_histogram_t *histogram, uint64_t nanoseconds) {
+    C_ASSERT(histogram != NULL, );
+
+    histogram->counts[latency_bucket(nanoseconds)]++;
+    histogram->samples++;
+    histogram->sum += nanoseconds;
+    if(nanoseconds > histogram->max)
+        histogram->max = nanoseconds;
+}
+
+void merge_latency_histograms(latency_histogram_t *histogram, const latency_histogram_t *other) {
+    C_ASSERT(histogram != NULL, );
+    C_ASSERT(other     != NULL, );
+
+    for(size_t bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+        histogram->counts[bucket] += other->counts[bucket];
+    histogram->samples += other->samples;
+    histogram->sum     += other->sum;
+    if(other->max > histogram->max)
+        histogram->max = other->max;
+}
+
+uint64_t latency_percentile(const latency_histogram_t *histogram, double percentile) {
+    C_ASSERT(histogram != NULL, 0);
+
+    if(histogram->samples == 0)
+        return 0;
+
+    double rank = percentile / 100.0 * (double)histogram->samples;
+    uint64_t needed = rank < 1.0 ? 1 : (uint64_t)rank;
+    if((double)needed < rank)
+        needed++;
+    if(needed > histogram->samples)
+        needed = histogram->samples;
+
+    uint64_t counted = 0;
+    for(size_t bucket = 0; bucket < LATENCY_BUCKETS; bucket++) {
+        counted += histogram->counts[bucket];
+        if(counted >= needed) {
+            uint64_t bound = bucket_upper_bound(bucket);
+            return bound < histogram->max ? bound : histogram->max;
+        }
+    }
+
+    return histogram->max;
+}
+
+void print_latency_histogram(const char *name, const latency_histogram_t *histogram) {
+    C_ASSERT(name      != NULL, );
+    C_ASSERT(histogram != NULL, );
+
+    double mean = histogram->samples == 0 ? 0.0 : (double)histogram->sum / (double)histogram->samples;
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND,
+                 "%s: %" PRIu64 " samples, mean %.1lf us, p50 %.1lf us, p90 %.1lf us, p99 %.1lf us, p99.9 %.1lf us, max %.1lf us\n",
+                 name, histogram->samples, mean / 1000.0,
+                 (double)latency_percentile(histogram, 50.0) / 1000.0,
+                 (double)latency_percentile(histogram, 90.0) / 1000.0,
+                 (double)latency_percentile(histogram, 99.0) / 1000.0,
+                 (double)latency_percentile(histogram, 99.9) / 1000.0,
+                 (double)histogram->max / 1000.0);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Finds bucket of latency.
+
+    @details - Latencies less than LATENCY_SUB_BUCKETS have their own buckets,
+               bigger latencies are split by their highest bit and LATENCY_SUB_BUCKET_BITS next bits.
+
+===============================================================================================================================
+*/
+size_t latency_bucket(uint64_t nanoseconds) {
+    if(nanoseconds < LATENCY_SUB_BUCKETS)
+        return (size_t)nanoseconds;
+
+    unsigned highest_bit = 63u - (unsigned)__builtin_clzll(nanoseconds);
+    unsigned shift = highest_bit - LATENCY_SUB_BUCKET_BITS;
+    size_t sub_bucket = (size_t)(nanoseconds >> shift) & (LATENCY_SUB_BUCKETS - 1);
+    return (size_t)(shift + 1) * LATENCY_SUB_BUCKETS + sub_bucket;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Finds the biggest latency of bucket.
+
+===============================================================================================================================
+*/
+uint64_t bucket_upper_bound(size_t bucket) {
+    if(bucket < LATENCY_SUB_BUCKETS)
+        return (uint64_t)bucket;
+
+    unsigned shift = (unsigned)(bucket / LATENCY_SUB_BUCKETS) - 1;
+    uint64_t lower = (uint64_t)(LATENCY_SUB_BUCKETS + bucket % LATENCY_SUB_BUCKETS) << shift;
+    return lower + ((uint64_t)1 << shift) - 1;
+}
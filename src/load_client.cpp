@@ -0,0 +1,407 @@
+/**
+===============================================================================================================================
+    @file    load_client.cpp
+    @brief   Loading server of solve_server.h with requests and measuring its latency.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "load_client.h"
+#include "solve_server.h"
+#include "quadratic_batch.h"
+#include "custom_assert.h"
+
+#if defined(__linux__)
+#define QUADRATIC_EPOLL
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#endif
+
+#ifdef QUADRATIC_EPOLL
+/**
+===============================================================================================================================
+    @brief   - Time, after which client stops waiting for replies.
+
+===============================================================================================================================
+*/
+static const int LOAD_TIMEOUT_MILLISECONDS = 10000;
+
+/**
+===============================================================================================================================
+    @brief   - Maximum length of request or reply line.
+
+===============================================================================================================================
+*/
+static const size_t MAX_LOAD_LINE_LENGTH = 5 * 32 + 8;
+
+/**
+===============================================================================================================================
+    @brief   - Size of input buffer of connection.
+
+===============================================================================================================================
+*/
+static const size_t LOAD_INPUT_SIZE = LOAD_WINDOW * MAX_LOAD_LINE_LENGTH;
+
+/**
+===============================================================================================================================
+    @brief   - Coefficients are integers from [-LOAD_COEFFICIENT_RANGE, LOAD_COEFFICIENT_RANGE] divided by 8.
+
+===============================================================================================================================
+*/
+static const uint64_t LOAD_COEFFICIENT_RANGE = 800;
+
+/**
+===============================================================================================================================
+    @brief   Connection with server.
+
+    @details - Request number k is kept in slot k % LOAD_WINDOW until its reply comes.
+
+===============================================================================================================================
+*/
+struct load_connection_t {
+    int descriptor;
+    uint64_t random;
+    size_t requests;
+    size_t sent;
+    size_t received;
+    double a[LOAD_WINDOW], b[LOAD_WINDOW], c[LOAD_WINDOW];
+    uint64_t sent_time[LOAD_WINDOW];
+    char input[LOAD_INPUT_SIZE];
+    size_t input_size;
+    char output[LOAD_INPUT_SIZE];
+    size_t output_size;
+    size_t output_sent;
+    uint32_t events;
+};
+
+static load_state_t open_connections(load_connection_t *connections, size_t connections_number,
+                                     const char *address, size_t requests, int epoll);
+static load_state_t run_connections(load_connection_t *connections, size_t connections_number,
+                                    int epoll, load_stats_t *stats);
+static void queue_requests(load_connection_t *connection);
+static double random_coefficient(uint64_t *state);
+static load_state_t read_replies(load_connection_t *connection, load_stats_t *stats);
+static void check_reply(load_connection_t *connection, const char *line, size_t length, load_stats_t *stats);
+static bool send_requests(load_connection_t *connection);
+static bool update_events(load_connection_t *connection, int epoll);
+static uint64_t now_nanoseconds(void);
+#endif
+
+load_state_t run_load(const char *address, size_t connections, size_t requests, load_stats_t *stats) {
+    C_ASSERT(address     != NULL, LOAD_CONNECTION_ERROR);
+    C_ASSERT(stats       != NULL, LOAD_CONNECTION_ERROR);
+    C_ASSERT(connections != 0 && connections <= MAX_LOAD_CONNECTIONS, LOAD_CONNECTION_ERROR);
+
+    *stats = {};
+
+#ifdef QUADRATIC_EPOLL
+    load_connection_t *load_connections = (load_connection_t *)calloc(connections, sizeof(load_connection_t));
+    int epoll = epoll_create1(EPOLL_CLOEXEC);
+    if(load_connections == NULL || epoll < 0) {
+        free(load_connections);
+        if(epoll >= 0)
+            close(epoll);
+        return load_connections == NULL ? LOAD_MEMORY_ERROR : LOAD_CONNECTION_ERROR;
+    }
+
+    for(size_t connection = 0; connection < connections; connection++)
+        load_connections[connection].descriptor = -1;
+
+    uint64_t start = now_nanoseconds();
+    load_state_t state = open_connections(load_connections, connections, address, requests, epoll);
+    if(state == LOAD_SUCCESS)
+        state = run_connections(load_connections, connections, epoll, stats);
+    stats->seconds = (double)(now_nanoseconds() - start) / 1e9;
+
+    for(size_t connection = 0; connection < connections; connection++) {
+        if(load_connections[connection].descriptor >= 0)
+            close(load_connections[connection].descriptor);
+    }
+    close(epoll);
+    free(load_connections);
+    return state;
+#else
+    (void)requests;
+    return LOAD_UNSUPPORTED;
+#endif
+}
+
+#ifdef QUADRATIC_EPOLL
+/**
+===============================================================================================================================
+    @brief   - Connects to server, splits requests between connections and registers connections in epoll.
+
+===============================================================================================================================
+*/
+load_state_t open_connections(load_connection_t *connections, size_t connections_number,
+                              const char *address, size_t requests, int epoll) {
+    C_ASSERT(connections != NULL, LOAD_CONNECTION_ERROR);
+    C_ASSERT(address     != NULL, LOAD_CONNECTION_ERROR);
+
+    for(size_t index = 0; index < connections_number; index++) {
+        load_connection_t *connection = &connections[index];
+
+        connection->descriptor = connect_to_server(address);
+        if(connection->descriptor < 0)
+            return LOAD_CONNECTION_ERROR;
+
+        int flags = fcntl(connection->descriptor, F_GETFL);
+        if(flags < 0 || fcntl(connection->descriptor, F_SETFL, flags | O_NONBLOCK) != 0)
+            return LOAD_CONNECTION_ERROR;
+
+        connection->random = 0x9E3779B97F4A7C15 * (index + 1);
+        connection->requests = requests / connections_number + (index < requests % connections_number ? 1 : 0);
+
+        connection->events = EPOLLIN;
+        epoll_event event = {};
+        event.events = connection->events;
+        event.data.ptr = connection;
+        if(epoll_ctl(epoll, EPOLL_CTL_ADD, connection->descriptor, &event) != 0)
+            return LOAD_CONNECTION_ERROR;
+    }
+
+    return LOAD_SUCCESS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Sends requests and reads replies until all connections get all replies.
+
+===============================================================================================================================
+*/
+load_state_t run_connections(load_connection_t *connections, size_t connections_number, int epoll, load_stats_t *stats) {
+    C_ASSERT(connections != NULL, LOAD_CONNECTION_ERROR);
+    C_ASSERT(stats       != NULL, LOAD_CONNECTION_ERROR);
+
+    size_t finished = 0;
+    for(size_t index = 0; index < connections_number; index++) {
+        load_connection_t *connection = &connections[index];
+        if(connection->requests == 0) {
+            finished++;
+            continue;
+        }
+
+        queue_requests(connection);
+        if(!send_requests(connection) || !update_events(connection, epoll))
+            return LOAD_CONNECTION_ERROR;
+    }
+
+    epoll_event events[64] = {};
+    while(finished < connections_number) {
+        int ready = epoll_wait(epoll, events, (int)(sizeof(events) / sizeof(epoll_event)), LOAD_TIMEOUT_MILLISECONDS);
+        if(ready < 0 && errno == EINTR)
+            continue;
+        if(ready <= 0)
+            return LOAD_CONNECTION_ERROR;
+
+        for(int event = 0; event < ready; event++) {
+            load_connection_t *connection = (load_connection_t *)events[event].data.ptr;
+
+            if(events[event].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                load_state_t state = read_replies(connection, stats);
+                if(state != LOAD_SUCCESS)
+                    return state;
+
+                if(connection->received == connection->requests) {
+                    finished++;
+                    epoll_ctl(epoll, EPOLL_CTL_DEL, connection->descriptor, NULL);
+                    close(connection->descriptor);
+                    connection->descriptor = -1;
+                    continue;
+                }
+                queue_requests(connection);
+            }
+
+            if(!send_requests(connection) || !update_events(connection, epoll))
+                return LOAD_CONNECTION_ERROR;
+        }
+    }
+
+    return LOAD_SUCCESS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Adds new requests to output of connection, so that LOAD_WINDOW requests are in flight.
+
+===============================================================================================================================
+*/
+void queue_requests(load_connection_t *connection) {
+    C_ASSERT(connection != NULL, );
+
+    if(connection->output_sent == connection->output_size)
+        connection->output_sent = connection->output_size = 0;
+
+    uint64_t now = now_nanoseconds();
+    while(connection->sent < connection->requests && connection->sent - connection->received < LOAD_WINDOW &&
+          LOAD_INPUT_SIZE - connection->output_size >= MAX_LOAD_LINE_LENGTH) {
+        size_t slot = connection->sent % LOAD_WINDOW;
+        connection->a[slot] = connection->sent % 8 == 0 ? 0 : random_coefficient(&connection->random);
+        connection->b[slot] = random_coefficient(&connection->random);
+        connection->c[slot] = random_coefficient(&connection->random);
+        connection->sent_time[slot] = now;
+
+        int printed = snprintf(connection->output + connection->output_size, MAX_LOAD_LINE_LENGTH, "%.17lg %.17lg %.17lg\n",
+                               connection->a[slot], connection->b[slot], connection->c[slot]);
+        if(printed < 0 || (size_t)printed >= MAX_LOAD_LINE_LENGTH)
+            return ;
+
+        connection->output_size += (size_t)printed;
+        connection->sent++;
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns next random coefficient (xorshift64*).
+
+===============================================================================================================================
+*/
+double random_coefficient(uint64_t *state) {
+    C_ASSERT(state != NULL, 0);
+
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    uint64_t random = *state * 0x2545F4914F6CDD1D;
+
+    return ((double)(random % (2 * LOAD_COEFFICIENT_RANGE + 1)) - (double)LOAD_COEFFICIENT_RANGE) / 8.0;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Reads replies of connection and checks them.
+
+===============================================================================================================================
+*/
+load_state_t read_replies(load_connection_t *connection, load_stats_t *stats) {
+    C_ASSERT(connection != NULL, LOAD_CONNECTION_ERROR);
+    C_ASSERT(stats      != NULL, LOAD_CONNECTION_ERROR);
+
+    ssize_t received = recv(connection->descriptor, connection->input + connection->input_size,
+                            LOAD_INPUT_SIZE - connection->input_size, 0);
+    if(received < 0)
+        return errno == EAGAIN || errno == EINTR ? LOAD_SUCCESS : LOAD_CONNECTION_ERROR;
+    if(received == 0)
+        return LOAD_CONNECTION_ERROR;
+
+    connection->input_size += (size_t)received;
+
+    const char *line = connection->input;
+    const char *end  = connection->input + connection->input_size;
+    while(line != end) {
+        const char *newline = (const char *)memchr(line, '\n', (size_t)(end - line));
+        if(newline == NULL)
+            break;
+
+        if(connection->received == connection->sent)
+            return LOAD_PROTOCOL_ERROR;
+
+        check_reply(connection, line, (size_t)(newline + 1 - line), stats);
+        line = newline + 1;
+    }
+
+    connection->input_size = (size_t)(end - line);
+    memmove(connection->input, line, connection->input_size);
+
+    return connection->input_size == LOAD_INPUT_SIZE ? LOAD_PROTOCOL_ERROR : LOAD_SUCCESS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Compares reply with result of solving of request in client and adds its latency to statistics.
+
+===============================================================================================================================
+*/
+void check_reply(load_connection_t *connection, const char *line, size_t length, load_stats_t *stats) {
+    C_ASSERT(connection != NULL, );
+    C_ASSERT(line       != NULL, );
+    C_ASSERT(stats      != NULL, );
+
+    size_t slot = connection->received % LOAD_WINDOW;
+    add_latency(&stats->latency, now_nanoseconds() - connection->sent_time[slot]);
+
+    double x1 = 0, x2 = 0;
+    int8_t number = 0;
+    solve_quadratic_batch(&connection->a[slot], &connection->b[slot], &connection->c[slot], 1, &x1, &x2, &number, NULL);
+
+    char expected[MAX_LOAD_LINE_LENGTH] = {};
+    int printed = snprintf(expected, MAX_LOAD_LINE_LENGTH, "%.17lg %.17lg %.17lg %.17lg %.17lg %d\n",
+                           connection->a[slot], connection->b[slot], connection->c[slot], x1, x2, number);
+    if(printed < 0 || (size_t)printed != length || memcmp(expected, line, length) != 0)
+        stats->mismatches++;
+
+    connection->received++;
+    stats->requests++;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Sends as many requests of connection as socket accepts.
+
+    @return  False if socket failed.
+
+===============================================================================================================================
+*/
+bool send_requests(load_connection_t *connection) {
+    C_ASSERT(connection != NULL, false);
+
+    while(connection->output_sent < connection->output_size) {
+        ssize_t sent = send(connection->descriptor, connection->output + connection->output_sent,
+                            connection->output_size - connection->output_sent, MSG_NOSIGNAL);
+        if(sent < 0) {
+            if(errno == EINTR)
+                continue;
+            return errno == EAGAIN;
+        }
+        connection->output_sent += (size_t)sent;
+    }
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Makes connection wait for EPOLLOUT only while it has unsent requests.
+
+    @return  False if epoll failed.
+
+===============================================================================================================================
+*/
+bool update_events(load_connection_t *connection, int epoll) {
+    C_ASSERT(connection != NULL, false);
+
+    uint32_t events = EPOLLIN;
+    if(connection->output_sent != connection->output_size)
+        events |= EPOLLOUT;
+
+    if(events == connection->events)
+        return true;
+
+    epoll_event event = {};
+    event.events = events;
+    event.data.ptr = connection;
+    connection->events = events;
+    return epoll_ctl(epoll, EPOLL_CTL_MOD, connection->descriptor, &event) == 0;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns time of monotonic clock in nanoseconds.
+
+===============================================================================================================================
+*/
+uint64_t now_nanoseconds(void) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
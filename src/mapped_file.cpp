@@ -0,0 +1,123 @@
+/**
+===============================================================================================================================
+    @file    mapped_file.cpp
+    @brief   Mapping files to memory for reading.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mapped_file.h"
+#include "custom_assert.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define QUADRATIC_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+static const char *EMPTY_FILE_DATA = "";
+
+#ifndef QUADRATIC_MMAP
+static mapping_state_t read_whole_file(const char *filename, mapped_file_t *file);
+#endif
+
+mapping_state_t map_file(const char *filename, mapped_file_t *file) {
+    C_ASSERT(filename != NULL, MAPPING_ERROR);
+    C_ASSERT(file     != NULL, MAPPING_ERROR);
+
+    file->data = EMPTY_FILE_DATA;
+    file->size = 0;
+    file->is_mapped = false;
+
+#ifdef QUADRATIC_MMAP
+    int descriptor = open(filename, O_RDONLY);
+    if(descriptor < 0)
+        return MAPPING_NO_FILE;
+
+    struct stat file_stat = {};
+    if(fstat(descriptor, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+        close(descriptor);
+        return MAPPING_ERROR;
+    }
+
+    if(file_stat.st_size == 0) {
+        close(descriptor);
+        return MAPPING_SUCCESS;
+    }
+
+    void *data = mmap(NULL, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if(data == MAP_FAILED)
+        return MAPPING_ERROR;
+
+    madvise(data, (size_t)file_stat.st_size, MADV_SEQUENTIAL);
+
+    file->data = (const char *)data;
+    file->size = (size_t)file_stat.st_size;
+    file->is_mapped = true;
+    return MAPPING_SUCCESS;
+#else
+    return read_whole_file(filename, file);
+#endif
+}
+
+void unmap_file(mapped_file_t *file) {
+    C_ASSERT(file != NULL, );
+
+    if(file->size != 0) {
+#ifdef QUADRATIC_MMAP
+        munmap(const_cast<char *>(file->data), file->size);
+#else
+        free(const_cast<char *>(file->data));
+#endif
+    }
+
+    file->data = EMPTY_FILE_DATA;
+    file->size = 0;
+    file->is_mapped = false;
+}
+
+#ifndef QUADRATIC_MMAP
+/**
+===============================================================================================================================
+    @brief   - Reads whole file to allocated buffer on systems without mmap().
+
+===============================================================================================================================
+*/
+mapping_state_t read_whole_file(const char *filename, mapped_file_t *file) {
+    FILE *input = fopen(filename, "rb");
+    if(input == NULL)
+        return MAPPING_NO_FILE;
+
+    if(fseek(input, 0, SEEK_END) != 0) {
+        fclose(input);
+        return MAPPING_ERROR;
+    }
+    long size = ftell(input);
+    rewind(input);
+    if(size <= 0) {
+        fclose(input);
+        return size == 0 ? MAPPING_SUCCESS : MAPPING_ERROR;
+    }
+
+    char *data = (char *)malloc((size_t)size);
+    if(data == NULL || fread(data, 1, (size_t)size, input) != (size_t)size) {
+        free(data);
+        fclose(input);
+        return MAPPING_ERROR;
+    }
+    fclose(input);
+
+    file->data = data;
+    file->size = (size_t)size;
+    return MAPPING_SUCCESS;
+}
+#endif
@@ -0,0 +1,548 @@
+/**
+===============================================================================================================================
+    @file    qbin.cpp
+    @brief   Reading and writing binary columnar files of equations (.qbin).
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "qbin.h"
+#include "mapped_file.h"
+#include "quadratic.h"
+#include "utils.h"
+#include "custom_assert.h"
+
+static const char QBIN_MAGIC[4] = {'Q', 'B', 'I', 'N'};
+
+static const uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325ULL;
+static const uint64_t FNV_PRIME        = 0x100000001B3ULL;
+
+/**
+===============================================================================================================================
+    @brief   - Number of equations in columns allocated first time.
+
+===============================================================================================================================
+*/
+static const size_t INITIAL_COLUMNS_CAPACITY = 1024;
+
+static size_t padded_numbers_size(size_t count);
+static size_t qbin_file_size(size_t count, bool has_results);
+static uint64_t hash_words(uint64_t hash, const void *data, size_t size);
+static uint64_t columns_checksum(const double *a, const double *b, const double *c,
+                                 const double *x1, const double *x2, const int8_t *number, size_t count);
+static bool grow_columns(qbin_columns_t *columns);
+static size_t count_first_line_fields(const char *data, size_t size, size_t *line);
+static void fill_qbin_header(qbin_header_t *header, size_t count, bool has_results, bool has_checksum, uint64_t checksum);
+static bool write_at(FILE *output, uint64_t offset, const void *data, size_t size);
+
+bool is_qbin_file(const char *filename) {
+    C_ASSERT(filename != NULL, false);
+
+    FILE *file = fopen(filename, "rb");
+    if(file == NULL)
+        return false;
+
+    char magic[sizeof(QBIN_MAGIC)] = {};
+    bool is_qbin = fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+                   memcmp(magic, QBIN_MAGIC, sizeof(QBIN_MAGIC)) == 0;
+    fclose(file);
+    return is_qbin;
+}
+
+qbin_state_t open_qbin(const char *filename, qbin_view_t *view, bool verify_checksum) {
+    C_ASSERT(filename != NULL, QBIN_INVALID_FILE);
+    C_ASSERT(view     != NULL, QBIN_INVALID_FILE);
+
+    memset(view, 0, sizeof(qbin_view_t));
+
+    switch(map_file(filename, &view->file)) {
+        case MAPPING_SUCCESS: {
+            break;
+        }
+        case MAPPING_NO_FILE: {
+            return QBIN_NO_FILE;
+        }
+        case MAPPING_ERROR: {
+            return QBIN_INVALID_FILE;
+        }
+        default: {
+            return QBIN_INVALID_FILE;
+        }
+    }
+
+    qbin_header_t header = {};
+    if(view->file.size < sizeof(qbin_header_t)) {
+        close_qbin(view);
+        return QBIN_INVALID_FILE;
+    }
+    memcpy(&header, view->file.data, sizeof(qbin_header_t));
+
+    if(memcmp(header.magic, QBIN_MAGIC, sizeof(QBIN_MAGIC)) != 0 || header.version != QBIN_VERSION) {
+        close_qbin(view);
+        return QBIN_INVALID_FILE;
+    }
+    if(header.endianness != QBIN_ENDIANNESS) {
+        close_qbin(view);
+        return QBIN_WRONG_ENDIANNESS;
+    }
+
+    bool has_results = (header.flags & QBIN_HAS_RESULTS) != 0;
+    size_t count = (size_t)header.count;
+    if(header.count > SIZE_MAX / (5 * sizeof(double)) || view->file.size != qbin_file_size(count, has_results)) {
+        close_qbin(view);
+        return QBIN_INVALID_FILE;
+    }
+
+    const char *columns = view->file.data + sizeof(qbin_header_t);
+    view->count = count;
+    view->a = (const double *)(const void *)(columns);
+    view->b = (const double *)(const void *)(columns + count * sizeof(double));
+    view->c = (const double *)(const void *)(columns + 2 * count * sizeof(double));
+    if(has_results) {
+        view->x1     = (const double *)(const void *)(columns + 3 * count * sizeof(double));
+        view->x2     = (const double *)(const void *)(columns + 4 * count * sizeof(double));
+        view->number = (const int8_t *)(const void *)(columns + 5 * count * sizeof(double));
+    }
+
+    if(verify_checksum && (header.flags & QBIN_HAS_CHECKSUM) != 0) {
+        uint64_t checksum = hash_words(FNV_OFFSET_BASIS, columns, view->file.size - sizeof(qbin_header_t));
+        if(checksum != header.checksum) {
+            close_qbin(view);
+            return QBIN_CHECKSUM_ERROR;
+        }
+    }
+
+    return QBIN_SUCCESS;
+}
+
+void close_qbin(qbin_view_t *view) {
+    C_ASSERT(view != NULL, );
+
+    unmap_file(&view->file);
+    view->count = 0;
+    view->a = view->b = view->c = view->x1 = view->x2 = NULL;
+    view->number = NULL;
+}
+
+qbin_state_t write_qbin(FILE *output, const double *a, const double *b, const double *c,
+                        const double *x1, const double *x2, const int8_t *number,
+                        size_t count, bool with_checksum) {
+    C_ASSERT(output != NULL, QBIN_WRITING_ERROR);
+    C_ASSERT(a      != NULL, QBIN_WRITING_ERROR);
+    C_ASSERT(b      != NULL, QBIN_WRITING_ERROR);
+    C_ASSERT(c      != NULL, QBIN_WRITING_ERROR);
+    C_ASSERT((x1 == NULL) == (x2 == NULL) && (x1 == NULL) == (number == NULL), QBIN_WRITING_ERROR);
+
+    bool has_results = x1 != NULL;
+
+    qbin_header_t header = {};
+    fill_qbin_header(&header, count, has_results, with_checksum,
+                     with_checksum ? columns_checksum(a, b, c, x1, x2, number, count) : 0);
+
+    if(fwrite(&header, sizeof(header), 1, output) != 1)
+        return QBIN_WRITING_ERROR;
+
+    const double *double_columns[] = {a, b, c, x1, x2};
+    size_t double_columns_number = has_results ? 5 : 3;
+    for(size_t column = 0; column < double_columns_number; column++) {
+        if(fwrite(double_columns[column], sizeof(double), count, output) != count)
+            return QBIN_WRITING_ERROR;
+    }
+
+    if(has_results) {
+        static const uint8_t padding[sizeof(uint64_t)] = {};
+        size_t padding_size = padded_numbers_size(count) - count;
+        if(fwrite(number, 1, count, output) != count ||
+           fwrite(padding, 1, padding_size, output) != padding_size)
+            return QBIN_WRITING_ERROR;
+    }
+
+    return QBIN_SUCCESS;
+}
+
+qbin_state_t write_qbin_header(FILE *output, size_t count, bool has_results) {
+    C_ASSERT(output != NULL, QBIN_WRITING_ERROR);
+
+    qbin_header_t header = {};
+    fill_qbin_header(&header, count, has_results, false, 0);
+    if(!write_at(output, 0, &header, sizeof(header)))
+        return QBIN_WRITING_ERROR;
+
+    //the last byte is written, so file has its full size before rows are written
+    size_t file_size = qbin_file_size(count, has_results);
+    static const uint8_t zero = 0;
+    if(file_size > sizeof(header) && !write_at(output, file_size - 1, &zero, 1))
+        return QBIN_WRITING_ERROR;
+
+    return QBIN_SUCCESS;
+}
+
+qbin_state_t write_qbin_rows(FILE *output, size_t count, size_t first, size_t rows,
+                             const double *a, const double *b, const double *c,
+                             const double *x1, const double *x2, const int8_t *number) {
+    C_ASSERT(output != NULL, QBIN_WRITING_ERROR);
+    C_ASSERT(a      != NULL, QBIN_WRITING_ERROR);
+    C_ASSERT(b      != NULL, QBIN_WRITING_ERROR);
+    C_ASSERT(c      != NULL, QBIN_WRITING_ERROR);
+    C_ASSERT((x1 == NULL) == (x2 == NULL) && (x1 == NULL) == (number == NULL), QBIN_WRITING_ERROR);
+    C_ASSERT(first <= count && rows <= count - first, QBIN_WRITING_ERROR);
+
+    const double *double_columns[] = {a, b, c, x1, x2};
+    size_t double_columns_number = x1 != NULL ? 5 : 3;
+    for(size_t column = 0; column < double_columns_number; column++) {
+        uint64_t offset = sizeof(qbin_header_t) + ((uint64_t)column * count + first) * sizeof(double);
+        if(!write_at(output, offset, double_columns[column], rows * sizeof(double)))
+            return QBIN_WRITING_ERROR;
+    }
+
+    if(number != NULL) {
+        uint64_t offset = sizeof(qbin_header_t) + (5 * (uint64_t)count * sizeof(double)) + first;
+        if(!write_at(output, offset, number, rows))
+            return QBIN_WRITING_ERROR;
+    }
+
+    return QBIN_SUCCESS;
+}
+
+qbin_state_t read_text_columns(const char *filename, qbin_columns_t *columns, size_t *error_line) {
+    C_ASSERT(filename   != NULL, QBIN_INVALID_FILE);
+    C_ASSERT(columns    != NULL, QBIN_INVALID_FILE);
+    C_ASSERT(error_line != NULL, QBIN_INVALID_FILE);
+
+    memset(columns, 0, sizeof(qbin_columns_t));
+    *error_line = 0;
+
+    mapped_file_t input = {};
+    mapping_state_t mapping_state = map_file(filename, &input);
+    if(mapping_state == MAPPING_NO_FILE)
+        return QBIN_NO_FILE;
+    if(mapping_state != MAPPING_SUCCESS)
+        return QBIN_INVALID_FILE;
+
+    size_t first_line = 1;
+    size_t fields = count_first_line_fields(input.data, input.size, &first_line);
+    columns->has_results = fields == 6;
+    if(fields != 3 && fields != 6 && fields != 0) {
+        unmap_file(&input);
+        *error_line = first_line;
+        return QBIN_INVALID_FILE;
+    }
+
+    text_reader_t reader = {};
+    init_text_reader(&reader, input.data, input.size);
+
+    reading_state_t reading_state = READING_SUCCESS;
+    while(true) {
+        if(columns->size == columns->capacity && !grow_columns(columns)) {
+            unmap_file(&input);
+            free_qbin_columns(columns);
+            return QBIN_MEMORY_ERROR;
+        }
+
+        size_t index = columns->size;
+        if(columns->has_results) {
+            quadratic_equation_t equation = {};
+            reading_state = read_expected_text(&reader, &equation);
+            columns->a[index]      = equation.a;
+            columns->b[index]      = equation.b;
+            columns->c[index]      = equation.c;
+            columns->x1[index]     = equation.x1;
+            columns->x2[index]     = equation.x2;
+            columns->number[index] = (int8_t)equation.number;
+        }
+        else {
+            reading_state = read_coefficients_text(&reader, &columns->a[index], &columns->b[index], &columns->c[index]);
+        }
+
+        if(reading_state != READING_SUCCESS)
+            break;
+        columns->size++;
+    }
+    unmap_file(&input);
+
+    if(reading_state == READING_ERROR) {
+        *error_line = reader.error_line;
+        free_qbin_columns(columns);
+        return QBIN_INVALID_FILE;
+    }
+    return QBIN_SUCCESS;
+}
+
+void free_qbin_columns(qbin_columns_t *columns) {
+    C_ASSERT(columns != NULL, );
+
+    free(columns->a);
+    free(columns->b);
+    free(columns->c);
+    free(columns->x1);
+    free(columns->x2);
+    free(columns->number);
+    memset(columns, 0, sizeof(qbin_columns_t));
+}
+
+qbin_state_t convert_text_to_qbin(const char *input_name, const char *output_name, size_t *count, size_t *error_line) {
+    C_ASSERT(input_name  != NULL, QBIN_INVALID_FILE);
+    C_ASSERT(output_name != NULL, QBIN_WRITING_ERROR);
+    C_ASSERT(count       != NULL, QBIN_INVALID_FILE);
+    C_ASSERT(error_line  != NULL, QBIN_INVALID_FILE);
+
+    *count = 0;
+
+    qbin_columns_t columns = {};
+    qbin_state_t state = read_text_columns(input_name, &columns, error_line);
+    if(state != QBIN_SUCCESS)
+        return state;
+
+    FILE *output = fopen(output_name, "wb");
+    if(output == NULL) {
+        free_qbin_columns(&columns);
+        return QBIN_WRITING_ERROR;
+    }
+
+    bool has_results = columns.has_results;
+    state = write_qbin(output, columns.a, columns.b, columns.c,
+                       has_results ? columns.x1     : NULL,
+                       has_results ? columns.x2     : NULL,
+                       has_results ? columns.number : NULL,
+                       columns.size, true);
+    if(fclose(output) != 0)
+        state = QBIN_WRITING_ERROR;
+
+    *count = columns.size;
+    free_qbin_columns(&columns);
+    return state;
+}
+
+qbin_state_t convert_qbin_to_text(const char *input_name, FILE *output, size_t *count) {
+    C_ASSERT(input_name != NULL, QBIN_INVALID_FILE);
+    C_ASSERT(output     != NULL, QBIN_WRITING_ERROR);
+    C_ASSERT(count      != NULL, QBIN_INVALID_FILE);
+
+    *count = 0;
+
+    qbin_view_t view = {};
+    qbin_state_t state = open_qbin(input_name, &view, true);
+    if(state != QBIN_SUCCESS)
+        return state;
+
+    for(size_t i = 0; i < view.count; i++) {
+        int printed = 0;
+        if(view.number != NULL)
+            printed = fprintf(output, "%.17lg %.17lg %.17lg %.17lg %.17lg %d\n",
+                              view.a[i], view.b[i], view.c[i], view.x1[i], view.x2[i], view.number[i]);
+        else
+            printed = fprintf(output, "%.17lg %.17lg %.17lg\n", view.a[i], view.b[i], view.c[i]);
+
+        if(printed < 0) {
+            close_qbin(&view);
+            return QBIN_WRITING_ERROR;
+        }
+    }
+
+    *count = view.count;
+    close_qbin(&view);
+    return QBIN_SUCCESS;
+}
+
+const char *qbin_state_message(qbin_state_t state) {
+    switch(state) {
+        case QBIN_SUCCESS: {
+            return "success";
+        }
+        case QBIN_NO_FILE: {
+            return "there is no such file";
+        }
+        case QBIN_INVALID_FILE: {
+            return "file is invalid";
+        }
+        case QBIN_WRONG_ENDIANNESS: {
+            return "file was written on machine with other byte order";
+        }
+        case QBIN_CHECKSUM_ERROR: {
+            return "checksum does not match";
+        }
+        case QBIN_WRITING_ERROR: {
+            return "unable to write file";
+        }
+        case QBIN_MEMORY_ERROR: {
+            return "unable to allocate memory";
+        }
+        default: {
+            return "unexpected error";
+        }
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Fills header of file with count equations.
+
+===============================================================================================================================
+*/
+void fill_qbin_header(qbin_header_t *header, size_t count, bool has_results, bool has_checksum, uint64_t checksum) {
+    C_ASSERT(header != NULL, );
+
+    memcpy(header->magic, QBIN_MAGIC, sizeof(QBIN_MAGIC));
+    header->version    = QBIN_VERSION;
+    header->endianness = QBIN_ENDIANNESS;
+    header->flags      = (uint32_t)((has_results ? QBIN_HAS_RESULTS : 0) | (has_checksum ? QBIN_HAS_CHECKSUM : 0));
+    header->count      = count;
+    header->checksum   = checksum;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Writes data at offset of file (offset can be bigger than 2 GiB).
+
+===============================================================================================================================
+*/
+bool write_at(FILE *output, uint64_t offset, const void *data, size_t size) {
+    C_ASSERT(output != NULL, false);
+    C_ASSERT(data   != NULL, false);
+
+#ifdef _WIN32
+    if(_fseeki64(output, (__int64)offset, SEEK_SET) != 0)
+        return false;
+#else
+    if(fseeko(output, (off_t)offset, SEEK_SET) != 0)
+        return false;
+#endif
+    return fwrite(data, 1, size, output) == size;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns size of roots numbers column padded to multiple of 8 bytes.
+
+===============================================================================================================================
+*/
+size_t padded_numbers_size(size_t count) {
+    return (count + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns expected size of .qbin file with count equations.
+
+===============================================================================================================================
+*/
+size_t qbin_file_size(size_t count, bool has_results) {
+    if(has_results)
+        return sizeof(qbin_header_t) + 5 * count * sizeof(double) + padded_numbers_size(count);
+
+    return sizeof(qbin_header_t) + 3 * count * sizeof(double);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Continues FNV-1a hash over 64-bit words of data (size must be multiple of 8).
+
+===============================================================================================================================
+*/
+uint64_t hash_words(uint64_t hash, const void *data, size_t size) {
+    const char *bytes = (const char *)data;
+    for(size_t offset = 0; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        memcpy(&word, bytes + offset, sizeof(uint64_t));
+        hash = (hash ^ word) * FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Computes checksum of columns in the same order as they are written to file.
+
+===============================================================================================================================
+*/
+uint64_t columns_checksum(const double *a, const double *b, const double *c,
+                          const double *x1, const double *x2, const int8_t *number, size_t count) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+    hash = hash_words(hash, a, count * sizeof(double));
+    hash = hash_words(hash, b, count * sizeof(double));
+    hash = hash_words(hash, c, count * sizeof(double));
+
+    if(x1 != NULL) {
+        hash = hash_words(hash, x1, count * sizeof(double));
+        hash = hash_words(hash, x2, count * sizeof(double));
+
+        size_t full_words = count / sizeof(uint64_t) * sizeof(uint64_t);
+        hash = hash_words(hash, number, full_words);
+        if(full_words != count) {
+            uint8_t last_word[sizeof(uint64_t)] = {};
+            memcpy(last_word, number + full_words, count - full_words);
+            hash = hash_words(hash, last_word, sizeof(last_word));
+        }
+    }
+    return hash;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Doubles capacity of columns.
+
+    @return  True if memory was allocated and false if not.
+
+===============================================================================================================================
+*/
+bool grow_columns(qbin_columns_t *columns) {
+    size_t capacity = columns->capacity == 0 ? INITIAL_COLUMNS_CAPACITY : columns->capacity * 2;
+
+    double **double_columns[] = {&columns->a, &columns->b, &columns->c, &columns->x1, &columns->x2};
+    for(size_t column = 0; column < sizeof(double_columns) / sizeof(double **); column++) {
+        double *grown = (double *)realloc(*double_columns[column], capacity * sizeof(double));
+        if(grown == NULL)
+            return false;
+        *double_columns[column] = grown;
+    }
+
+    int8_t *grown_number = (int8_t *)realloc(columns->number, capacity * sizeof(int8_t));
+    if(grown_number == NULL)
+        return false;
+    columns->number = grown_number;
+
+    columns->capacity = capacity;
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Counts numbers in the first non-empty line of text.
+
+    @param   [in]  data               Text.
+    @param   [in]  size               Length of text.
+    @param   [out] line               Number of the first non-empty line.
+
+    @return  Number of space separated fields (0 if text is empty).
+
+===============================================================================================================================
+*/
+size_t count_first_line_fields(const char *data, size_t size, size_t *line) {
+    size_t fields = 0;
+    bool in_field = false;
+    *line = 1;
+
+    for(size_t position = 0; position < size; position++) {
+        char symbol = data[position];
+        if(symbol == '\n') {
+            if(fields != 0)
+                return fields;
+            *line += 1;
+            in_field = false;
+            continue;
+        }
+
+        bool is_space = symbol == ' ' || symbol == '\t' || symbol == '\r' || symbol == '\v' || symbol == '\f';
+        if(!is_space && !in_field)
+            fields++;
+        in_field = !is_space;
+    }
+    return fields;
+}
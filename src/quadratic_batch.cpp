@@ -0,0 +1,508 @@
+/**
+===============================================================================================================================
+    @file    quadratic_batch.cpp
+    @brief   Solving quadratic equations stored as columns of coefficients.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "quadratic.h"
+#include "quadratic_batch.h"
+#include "quadratic_simd.h"
+#include "quadratic_precise.h"
+#include "quadratic_generic.h"
+#include "solve_cache.h"
+#include "thread_pool.h"
+#include "custom_assert.h"
+
+/**
+===============================================================================================================================
+    @brief   Arguments of solve_quadratic_batch_parallel(...) passed to threads.
+
+===============================================================================================================================
+*/
+struct batch_job_t {
+    const double *a, *b, *c;
+    double *x1, *x2;
+    int8_t *number;
+    uint8_t *invalid;
+    std::atomic<int> has_invalid;
+    std::atomic<int> has_error;
+};
+
+/**
+===============================================================================================================================
+    @brief   Arguments of solve_quadratic_batch_float_parallel(...) passed to threads.
+
+===============================================================================================================================
+*/
+struct batch_float_job_t {
+    const float *a, *b, *c;
+    float *x1, *x2;
+    int8_t *number;
+    uint8_t *invalid;
+    std::atomic<int> has_invalid;
+    std::atomic<int> has_error;
+};
+
+/**
+===============================================================================================================================
+    @brief   Arguments of classify_quadratic_batch_parallel(...) and count_quadratic_roots_parallel(...) passed to threads.
+
+    @details - number is NULL if only counts are needed.
+
+===============================================================================================================================
+*/
+struct classify_job_t {
+    const double *a, *b, *c;
+    int8_t *number;
+    uint8_t *invalid;
+    std::atomic<uint64_t> counts[ROOTS_COUNTS_NUMBER];
+    std::atomic<int> has_invalid;
+    std::atomic<int> has_error;
+};
+
+/**
+===============================================================================================================================
+    @brief   Number of bytes read and written while solving one equation.
+
+===============================================================================================================================
+*/
+static const size_t BATCH_EQUATION_BYTES = 5 * sizeof(double) + sizeof(int8_t) + sizeof(uint8_t);
+
+/**
+===============================================================================================================================
+    @brief   Number of bytes read and written while solving one float equation.
+
+===============================================================================================================================
+*/
+static const size_t BATCH_FLOAT_EQUATION_BYTES = 5 * sizeof(float) + sizeof(int8_t) + sizeof(uint8_t);
+
+/**
+===============================================================================================================================
+    @brief   Number of bytes read and written while classifying one equation.
+
+===============================================================================================================================
+*/
+static const size_t BATCH_CLASSIFY_EQUATION_BYTES = 3 * sizeof(double) + sizeof(int8_t) + sizeof(uint8_t);
+
+/**
+===============================================================================================================================
+    @brief   Number of equations classified at once by count_quadratic_roots(), their numbers are kept on stack.
+
+===============================================================================================================================
+*/
+static const size_t COUNT_BLOCK_SIZE = 1024;
+
+static void solve_batch_chunk(size_t begin, size_t end, size_t worker, void *context);
+static solving_state_t solve_batch_scalar(const double *a, const double *b, const double *c, size_t n,
+                                          double *x1, double *x2, int8_t *number, uint8_t *invalid);
+static void solve_batch_float_chunk(size_t begin, size_t end, size_t worker, void *context);
+static void classify_batch_chunk(size_t begin, size_t end, size_t worker, void *context);
+static solving_state_t classify_batch_scalar(const double *a, const double *b, const double *c, size_t n,
+                                             int8_t *number, uint8_t *invalid);
+static solving_state_t solve_batch_float_scalar(const float *a, const float *b, const float *c, size_t n,
+                                                float *x1, float *x2, int8_t *number, uint8_t *invalid);
+
+solving_state_t solve_quadratic_batch(const double *a, const double *b, const double *c, size_t n,
+                                      double *x1, double *x2, int8_t *number, uint8_t *invalid) {
+    C_ASSERT(a      != NULL, SOLVING_ERROR);
+    C_ASSERT(b      != NULL, SOLVING_ERROR);
+    C_ASSERT(c      != NULL, SOLVING_ERROR);
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    if(get_solve_cache_capacity() != 0)
+        return solve_quadratic_batch_cached(a, b, c, n, x1, x2, number, invalid);
+
+    if(is_precise_solving())
+        return solve_quadratic_batch_precise(a, b, c, n, x1, x2, number, invalid);
+
+    bool has_invalid = false;
+    size_t solved = 0;
+
+    simd_kernel_t kernel = get_simd_kernel(get_simd_level());
+    if(kernel != NULL)
+        solved = kernel(a, b, c, n, x1, x2, number, invalid, &has_invalid);
+
+    //tail that does not fill a vector
+    solving_state_t tail_state = solve_batch_scalar(a + solved, b + solved, c + solved, n - solved,
+                                                    x1 + solved, x2 + solved, number + solved,
+                                                    invalid == NULL ? NULL : invalid + solved);
+    if(tail_state == SOLVING_ERROR)
+        return SOLVING_ERROR;
+
+    if(has_invalid || tail_state == INVALID_COEFFICIENTS)
+        return INVALID_COEFFICIENTS;
+
+    return SOLVING_SUCCESS;
+}
+
+solving_state_t solve_quadratic_batch_parallel(const double *a, const double *b, const double *c, size_t n,
+                                               double *x1, double *x2, int8_t *number, uint8_t *invalid) {
+    C_ASSERT(a      != NULL, SOLVING_ERROR);
+    C_ASSERT(b      != NULL, SOLVING_ERROR);
+    C_ASSERT(c      != NULL, SOLVING_ERROR);
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    batch_job_t job = {.a = a, .b = b, .c = c, .x1 = x1, .x2 = x2, .number = number, .invalid = invalid,
+                       .has_invalid = {0}, .has_error = {0}};
+
+    parallel_for(n, cache_chunk_size(BATCH_EQUATION_BYTES), solve_batch_chunk, &job);
+
+    if(job.has_error.load())
+        return SOLVING_ERROR;
+
+    if(job.has_invalid.load())
+        return INVALID_COEFFICIENTS;
+
+    return SOLVING_SUCCESS;
+}
+
+solving_state_t solve_quadratic_batch_scalar(const double *a, const double *b, const double *c, size_t n,
+                                             double *x1, double *x2, int8_t *number, uint8_t *invalid) {
+    C_ASSERT(a      != NULL, SOLVING_ERROR);
+    C_ASSERT(b      != NULL, SOLVING_ERROR);
+    C_ASSERT(c      != NULL, SOLVING_ERROR);
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    return solve_batch_scalar(a, b, c, n, x1, x2, number, invalid);
+}
+
+solving_state_t solve_quadratic_batch_float(const float *a, const float *b, const float *c, size_t n,
+                                            float *x1, float *x2, int8_t *number, uint8_t *invalid) {
+    C_ASSERT(a      != NULL, SOLVING_ERROR);
+    C_ASSERT(b      != NULL, SOLVING_ERROR);
+    C_ASSERT(c      != NULL, SOLVING_ERROR);
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    bool has_invalid = false;
+    size_t solved = 0;
+
+    simd_float_kernel_t kernel = get_simd_float_kernel(get_simd_level());
+    if(kernel != NULL)
+        solved = kernel(a, b, c, n, x1, x2, number, invalid, &has_invalid);
+
+    //tail that does not fill a vector
+    solving_state_t tail_state = solve_batch_float_scalar(a + solved, b + solved, c + solved, n - solved,
+                                                          x1 + solved, x2 + solved, number + solved,
+                                                          invalid == NULL ? NULL : invalid + solved);
+    if(tail_state == SOLVING_ERROR)
+        return SOLVING_ERROR;
+
+    if(has_invalid || tail_state == INVALID_COEFFICIENTS)
+        return INVALID_COEFFICIENTS;
+
+    return SOLVING_SUCCESS;
+}
+
+solving_state_t solve_quadratic_batch_float_parallel(const float *a, const float *b, const float *c, size_t n,
+                                                     float *x1, float *x2, int8_t *number, uint8_t *invalid) {
+    C_ASSERT(a      != NULL, SOLVING_ERROR);
+    C_ASSERT(b      != NULL, SOLVING_ERROR);
+    C_ASSERT(c      != NULL, SOLVING_ERROR);
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    batch_float_job_t job = {.a = a, .b = b, .c = c, .x1 = x1, .x2 = x2, .number = number, .invalid = invalid,
+                             .has_invalid = {0}, .has_error = {0}};
+
+    parallel_for(n, cache_chunk_size(BATCH_FLOAT_EQUATION_BYTES), solve_batch_float_chunk, &job);
+
+    if(job.has_error.load())
+        return SOLVING_ERROR;
+
+    if(job.has_invalid.load())
+        return INVALID_COEFFICIENTS;
+
+    return SOLVING_SUCCESS;
+}
+
+solving_state_t classify_quadratic_batch(const double *a, const double *b, const double *c, size_t n,
+                                         int8_t *number, uint8_t *invalid) {
+    C_ASSERT(a      != NULL, SOLVING_ERROR);
+    C_ASSERT(b      != NULL, SOLVING_ERROR);
+    C_ASSERT(c      != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    bool has_invalid = false;
+    size_t classified = 0;
+
+    simd_classify_kernel_t kernel = is_precise_solving() ? NULL : get_simd_classify_kernel(get_simd_level());
+    if(kernel != NULL)
+        classified = kernel(a, b, c, n, number, invalid, &has_invalid);
+
+    //tail that does not fill a vector (or all equations in precise mode)
+    solving_state_t tail_state = classify_batch_scalar(a + classified, b + classified, c + classified, n - classified,
+                                                       number + classified, invalid == NULL ? NULL : invalid + classified);
+    if(has_invalid || tail_state == INVALID_COEFFICIENTS)
+        return INVALID_COEFFICIENTS;
+
+    return SOLVING_SUCCESS;
+}
+
+solving_state_t classify_quadratic_batch_parallel(const double *a, const double *b, const double *c, size_t n,
+                                                  int8_t *number, uint8_t *invalid) {
+    C_ASSERT(a      != NULL, SOLVING_ERROR);
+    C_ASSERT(b      != NULL, SOLVING_ERROR);
+    C_ASSERT(c      != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    classify_job_t job = {.a = a, .b = b, .c = c, .number = number, .invalid = invalid,
+                          .counts = {}, .has_invalid = {0}, .has_error = {0}};
+
+    parallel_for(n, cache_chunk_size(BATCH_CLASSIFY_EQUATION_BYTES), classify_batch_chunk, &job);
+
+    if(job.has_error.load())
+        return SOLVING_ERROR;
+
+    if(job.has_invalid.load())
+        return INVALID_COEFFICIENTS;
+
+    return SOLVING_SUCCESS;
+}
+
+solving_state_t count_quadratic_roots(const double *a, const double *b, const double *c, size_t n, uint64_t *counts) {
+    C_ASSERT(a      != NULL, SOLVING_ERROR);
+    C_ASSERT(b      != NULL, SOLVING_ERROR);
+    C_ASSERT(c      != NULL, SOLVING_ERROR);
+    C_ASSERT(counts != NULL, SOLVING_ERROR);
+
+    for(size_t number = 0; number < ROOTS_COUNTS_NUMBER; number++)
+        counts[number] = 0;
+
+    int8_t numbers[COUNT_BLOCK_SIZE] = {};
+    solving_state_t state = SOLVING_SUCCESS;
+
+    for(size_t first = 0; first < n; first += COUNT_BLOCK_SIZE) {
+        size_t size = n - first < COUNT_BLOCK_SIZE ? n - first : COUNT_BLOCK_SIZE;
+
+        solving_state_t block_state = classify_quadratic_batch(a + first, b + first, c + first, size, numbers, NULL);
+        if(block_state == SOLVING_ERROR)
+            return SOLVING_ERROR;
+        if(block_state == INVALID_COEFFICIENTS)
+            state = INVALID_COEFFICIENTS;
+
+        for(size_t i = 0; i < size; i++)
+            counts[numbers[i] - INF_ROOTS]++;
+    }
+
+    return state;
+}
+
+solving_state_t count_quadratic_roots_parallel(const double *a, const double *b, const double *c, size_t n, uint64_t *counts) {
+    C_ASSERT(a      != NULL, SOLVING_ERROR);
+    C_ASSERT(b      != NULL, SOLVING_ERROR);
+    C_ASSERT(c      != NULL, SOLVING_ERROR);
+    C_ASSERT(counts != NULL, SOLVING_ERROR);
+
+    classify_job_t job = {.a = a, .b = b, .c = c, .number = NULL, .invalid = NULL,
+                          .counts = {}, .has_invalid = {0}, .has_error = {0}};
+
+    parallel_for(n, cache_chunk_size(3 * sizeof(double)), classify_batch_chunk, &job);
+
+    for(size_t number = 0; number < ROOTS_COUNTS_NUMBER; number++)
+        counts[number] = job.counts[number].load();
+
+    if(job.has_error.load())
+        return SOLVING_ERROR;
+
+    if(job.has_invalid.load())
+        return INVALID_COEFFICIENTS;
+
+    return SOLVING_SUCCESS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves equations [begin, end) of batch_job_t with solve_quadratic_batch(...).
+
+===============================================================================================================================
+*/
+void solve_batch_chunk(size_t begin, size_t end, size_t worker, void *context) {
+    (void)worker;
+    batch_job_t *job = (batch_job_t *)context;
+
+    solving_state_t state = solve_quadratic_batch(job->a + begin, job->b + begin, job->c + begin, end - begin,
+                                                  job->x1 + begin, job->x2 + begin, job->number + begin,
+                                                  job->invalid == NULL ? NULL : job->invalid + begin);
+    if(state == INVALID_COEFFICIENTS)
+        job->has_invalid.store(1, std::memory_order_relaxed);
+    if(state == SOLVING_ERROR)
+        job->has_error.store(1, std::memory_order_relaxed);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves equations one by one with solve_quadratic_roots().
+
+    @details - Reference for vectorized kernels and solver of tails that do not fill a vector.\n
+             - Arguments and return values are the same as in solve_quadratic_batch().
+
+===============================================================================================================================
+*/
+solving_state_t solve_batch_scalar(const double *a, const double *b, const double *c, size_t n,
+                                   double *x1, double *x2, int8_t *number, uint8_t *invalid) {
+    solving_state_t batch_state = SOLVING_SUCCESS;
+
+    for(size_t i = 0; i < n; i++) {
+        roots_number_t roots_number = NOT_SOLVED;
+        x1[i] = x2[i] = 0;
+
+        switch(solve_quadratic_roots(a[i], b[i], c[i], &x1[i], &x2[i], &roots_number)) {
+            case SOLVING_SUCCESS: {
+                if(invalid != NULL)
+                    invalid[i] = 0;
+                break;
+            }
+            case INVALID_COEFFICIENTS: {
+                if(invalid != NULL)
+                    invalid[i] = 1;
+                batch_state = INVALID_COEFFICIENTS;
+                break;
+            }
+            case SOLVING_ERROR: {
+                number[i] = (int8_t)NOT_SOLVED;
+                return SOLVING_ERROR;
+            }
+            default: {
+                number[i] = (int8_t)NOT_SOLVED;
+                return SOLVING_ERROR;
+            }
+        }
+        number[i] = (int8_t)roots_number;
+    }
+
+    return batch_state;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves equations [begin, end) of batch_float_job_t with solve_quadratic_batch_float(...).
+
+===============================================================================================================================
+*/
+void solve_batch_float_chunk(size_t begin, size_t end, size_t worker, void *context) {
+    (void)worker;
+    batch_float_job_t *job = (batch_float_job_t *)context;
+
+    solving_state_t state = solve_quadratic_batch_float(job->a + begin, job->b + begin, job->c + begin, end - begin,
+                                                        job->x1 + begin, job->x2 + begin, job->number + begin,
+                                                        job->invalid == NULL ? NULL : job->invalid + begin);
+    if(state == INVALID_COEFFICIENTS)
+        job->has_invalid.store(1, std::memory_order_relaxed);
+    if(state == SOLVING_ERROR)
+        job->has_error.store(1, std::memory_order_relaxed);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves float equations one by one with solve_quadratic_roots_generic<float>().
+
+    @details - Reference for vectorized float kernels and solver of tails that do not fill a vector.\n
+             - Arguments and return values are the same as in solve_quadratic_batch_float().
+
+===============================================================================================================================
+*/
+solving_state_t solve_batch_float_scalar(const float *a, const float *b, const float *c, size_t n,
+                                         float *x1, float *x2, int8_t *number, uint8_t *invalid) {
+    solving_state_t batch_state = SOLVING_SUCCESS;
+
+    for(size_t i = 0; i < n; i++) {
+        roots_number_t roots_number = NOT_SOLVED;
+        x1[i] = x2[i] = 0;
+
+        switch(solve_quadratic_roots_generic<float>(a[i], b[i], c[i], &x1[i], &x2[i], &roots_number)) {
+            case SOLVING_SUCCESS: {
+                if(invalid != NULL)
+                    invalid[i] = 0;
+                break;
+            }
+            case INVALID_COEFFICIENTS: {
+                if(invalid != NULL)
+                    invalid[i] = 1;
+                batch_state = INVALID_COEFFICIENTS;
+                break;
+            }
+            case SOLVING_ERROR: {
+                number[i] = (int8_t)NOT_SOLVED;
+                return SOLVING_ERROR;
+            }
+            default: {
+                number[i] = (int8_t)NOT_SOLVED;
+                return SOLVING_ERROR;
+            }
+        }
+        number[i] = (int8_t)roots_number;
+    }
+
+    return batch_state;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Classifies equations [begin, end) of classify_job_t with classify_quadratic_batch(...)
+               or counts them with count_quadratic_roots(...) if numbers are not needed.
+
+===============================================================================================================================
+*/
+void classify_batch_chunk(size_t begin, size_t end, size_t worker, void *context) {
+    (void)worker;
+    classify_job_t *job = (classify_job_t *)context;
+
+    solving_state_t state = SOLVING_SUCCESS;
+    if(job->number != NULL) {
+        state = classify_quadratic_batch(job->a + begin, job->b + begin, job->c + begin, end - begin,
+                                         job->number + begin, job->invalid == NULL ? NULL : job->invalid + begin);
+    }
+    else {
+        uint64_t counts[ROOTS_COUNTS_NUMBER] = {};
+        state = count_quadratic_roots(job->a + begin, job->b + begin, job->c + begin, end - begin, counts);
+        for(size_t number = 0; number < ROOTS_COUNTS_NUMBER; number++)
+            job->counts[number].fetch_add(counts[number], std::memory_order_relaxed);
+    }
+
+    if(state == INVALID_COEFFICIENTS)
+        job->has_invalid.store(1, std::memory_order_relaxed);
+    if(state == SOLVING_ERROR)
+        job->has_error.store(1, std::memory_order_relaxed);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Classifies equations one by one with classify_quadratic().
+
+    @details - Reference for vectorized kernels, classifier of tails that do not fill a vector and of precise mode.\n
+             - Arguments and return values are the same as in classify_quadratic_batch().
+
+===============================================================================================================================
+*/
+solving_state_t classify_batch_scalar(const double *a, const double *b, const double *c, size_t n,
+                                      int8_t *number, uint8_t *invalid) {
+    solving_state_t batch_state = SOLVING_SUCCESS;
+
+    for(size_t i = 0; i < n; i++) {
+        roots_number_t roots_number = classify_quadratic(a[i], b[i], c[i]);
+        if(roots_number == NOT_SOLVED)
+            batch_state = INVALID_COEFFICIENTS;
+        if(invalid != NULL)
+            invalid[i] = roots_number == NOT_SOLVED ? 1 : 0;
+        number[i] = (int8_t)roots_number;
+    }
+
+    return batch_state;
+}
@@ -0,0 +1,267 @@
+/**
+===============================================================================================================================
+    @file    quadratic_dedup.cpp
+    @brief   Solving batches with repeated equations once per unique equation.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include "quadratic_dedup.h"
+#include "quadratic_batch.h"
+#include "thread_pool.h"
+#include "custom_assert.h"
+
+/**
+===============================================================================================================================
+    @brief   - Index, that marks empty slot of hash table.
+
+===============================================================================================================================
+*/
+static const uint32_t NO_UNIQUE = UINT32_MAX;
+
+/**
+===============================================================================================================================
+    @brief   - Number of bytes read and written while result of one row is scattered.
+
+===============================================================================================================================
+*/
+static const size_t SCATTER_ROW_BYTES = sizeof(uint32_t) + 2 * sizeof(double) + sizeof(int8_t) + sizeof(uint8_t);
+
+/**
+===============================================================================================================================
+    @brief   Unique equations of batch and index of unique equation of every row.
+
+===============================================================================================================================
+*/
+struct dedup_batch_t {
+    double *a, *b, *c;
+    double *x1, *x2;
+    int8_t *number;
+    uint8_t *invalid;
+    uint32_t *unique_index;
+    uint32_t *slots;
+    size_t slots_mask;
+    size_t size;
+};
+
+/**
+===============================================================================================================================
+    @brief   Arguments of scatter_chunk(...) passed to threads.
+
+===============================================================================================================================
+*/
+struct scatter_job_t {
+    const dedup_batch_t *batch;
+    double *x1, *x2;
+    int8_t *number;
+    uint8_t *invalid;
+};
+
+static bool allocate_dedup_batch(dedup_batch_t *batch, size_t n);
+static void free_dedup_batch(dedup_batch_t *batch);
+static void find_unique(dedup_batch_t *batch, const double *a, const double *b, const double *c, size_t n);
+static uint64_t hash_coefficients(double a, double b, double c);
+static bool same_coefficients(double first, double second);
+static void scatter_chunk(size_t begin, size_t end, size_t worker, void *context);
+
+static bool batch_dedup = false;
+
+static std::atomic<uint64_t> total_rows(0);
+static std::atomic<uint64_t> total_unique(0);
+
+solving_state_t solve_quadratic_batch_dedup(const double *a, const double *b, const double *c, size_t n,
+                                            double *x1, double *x2, int8_t *number, uint8_t *invalid) {
+    C_ASSERT(a      != NULL, SOLVING_ERROR);
+    C_ASSERT(b      != NULL, SOLVING_ERROR);
+    C_ASSERT(c      != NULL, SOLVING_ERROR);
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    dedup_batch_t batch = {};
+    if(n >= NO_UNIQUE || !allocate_dedup_batch(&batch, n)) {
+        free_dedup_batch(&batch);
+        return solve_quadratic_batch_parallel(a, b, c, n, x1, x2, number, invalid);
+    }
+
+    find_unique(&batch, a, b, c, n);
+
+    solving_state_t state = solve_quadratic_batch_parallel(batch.a, batch.b, batch.c, batch.size,
+                                                           batch.x1, batch.x2, batch.number, batch.invalid);
+
+    scatter_job_t job = {.batch = &batch, .x1 = x1, .x2 = x2, .number = number, .invalid = invalid};
+    parallel_for(n, cache_chunk_size(SCATTER_ROW_BYTES), scatter_chunk, &job);
+
+    total_rows.fetch_add(n, std::memory_order_relaxed);
+    total_unique.fetch_add(batch.size, std::memory_order_relaxed);
+
+    free_dedup_batch(&batch);
+    return state;
+}
+
+void set_batch_dedup(bool dedup) {
+    batch_dedup = dedup;
+}
+
+bool is_batch_dedup(void) {
+    return batch_dedup;
+}
+
+void get_dedup_stats(dedup_stats_t *stats) {
+    C_ASSERT(stats != NULL, );
+
+    stats->rows   = total_rows.load();
+    stats->unique = total_unique.load();
+}
+
+/**
+===============================================================================================================================
+    @brief   - Allocates columns for n unique equations, index of every row and hash table.
+
+    @details - Number of slots is power of two, at least twice bigger than n, so probe sequences stay short.
+
+    @return  True if memory was allocated and false if not.
+
+===============================================================================================================================
+*/
+bool allocate_dedup_batch(dedup_batch_t *batch, size_t n) {
+    C_ASSERT(batch != NULL, false);
+
+    size_t slots_number = 1;
+    while(slots_number < 2 * n)
+        slots_number *= 2;
+
+    size_t columns_size = n == 0 ? 1 : n;
+    batch->a            = (double *)malloc(columns_size * sizeof(double));
+    batch->b            = (double *)malloc(columns_size * sizeof(double));
+    batch->c            = (double *)malloc(columns_size * sizeof(double));
+    batch->x1           = (double *)malloc(columns_size * sizeof(double));
+    batch->x2           = (double *)malloc(columns_size * sizeof(double));
+    batch->number       = (int8_t *)malloc(columns_size * sizeof(int8_t));
+    batch->invalid      = (uint8_t *)malloc(columns_size * sizeof(uint8_t));
+    batch->unique_index = (uint32_t *)malloc(columns_size * sizeof(uint32_t));
+    batch->slots        = (uint32_t *)malloc(slots_number * sizeof(uint32_t));
+    if(batch->a == NULL || batch->b == NULL || batch->c == NULL || batch->x1 == NULL || batch->x2 == NULL ||
+       batch->number == NULL || batch->invalid == NULL || batch->unique_index == NULL || batch->slots == NULL)
+        return false;
+
+    memset(batch->slots, 0xFF, slots_number * sizeof(uint32_t));
+    batch->slots_mask = slots_number - 1;
+    batch->size = 0;
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Frees memory of deduplicated batch.
+
+===============================================================================================================================
+*/
+void free_dedup_batch(dedup_batch_t *batch) {
+    C_ASSERT(batch != NULL, );
+
+    free(batch->a);
+    free(batch->b);
+    free(batch->c);
+    free(batch->x1);
+    free(batch->x2);
+    free(batch->number);
+    free(batch->invalid);
+    free(batch->unique_index);
+    free(batch->slots);
+    *batch = {};
+}
+
+/**
+===============================================================================================================================
+    @brief   - Finds unique equations in order of their first rows and index of unique equation of every row.
+
+    @details - Hash table is open addressing table with linear probing, it stores indices of unique equations.
+
+===============================================================================================================================
+*/
+void find_unique(dedup_batch_t *batch, const double *a, const double *b, const double *c, size_t n) {
+    C_ASSERT(batch != NULL, );
+    C_ASSERT(a     != NULL, );
+    C_ASSERT(b     != NULL, );
+    C_ASSERT(c     != NULL, );
+
+    for(size_t row = 0; row < n; row++) {
+        size_t slot = (size_t)hash_coefficients(a[row], b[row], c[row]) & batch->slots_mask;
+
+        while(batch->slots[slot] != NO_UNIQUE) {
+            uint32_t unique = batch->slots[slot];
+            if(same_coefficients(batch->a[unique], a[row]) &&
+               same_coefficients(batch->b[unique], b[row]) &&
+               same_coefficients(batch->c[unique], c[row]))
+                break;
+
+            slot = (slot + 1) & batch->slots_mask;
+        }
+
+        if(batch->slots[slot] == NO_UNIQUE) {
+            batch->slots[slot] = (uint32_t)batch->size;
+            batch->a[batch->size] = a[row];
+            batch->b[batch->size] = b[row];
+            batch->c[batch->size] = c[row];
+            batch->size++;
+        }
+
+        batch->unique_index[row] = batch->slots[slot];
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Mixes bit patterns of coefficients into hash (multiplicative hashing).
+
+===============================================================================================================================
+*/
+uint64_t hash_coefficients(double a, double b, double c) {
+    uint64_t key[3] = {};
+    memcpy(&key[0], &a, sizeof(double));
+    memcpy(&key[1], &b, sizeof(double));
+    memcpy(&key[2], &c, sizeof(double));
+
+    uint64_t hash = key[0];
+    hash = (hash ^ (hash >> 29) ^ key[1]) * 0x9E3779B97F4A7C15;
+    hash = (hash ^ (hash >> 32) ^ key[2]) * 0xBF58476D1CE4E5B9;
+    return hash ^ (hash >> 31);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Checks if numbers are the same bit for bit (so 0 and -0 are different and NAN is equal to itself).
+
+===============================================================================================================================
+*/
+bool same_coefficients(double first, double second) {
+    return memcmp(&first, &second, sizeof(double)) == 0;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Copies results of unique equations to rows [begin, end) of scatter_job_t.
+
+===============================================================================================================================
+*/
+void scatter_chunk(size_t begin, size_t end, size_t worker, void *context) {
+    (void)worker;
+    scatter_job_t *job = (scatter_job_t *)context;
+    const dedup_batch_t *batch = job->batch;
+
+    for(size_t row = begin; row < end; row++) {
+        uint32_t unique = batch->unique_index[row];
+        job->x1[row]     = batch->x1[unique];
+        job->x2[row]     = batch->x2[unique];
+        job->number[row] = batch->number[unique];
+        if(job->invalid != NULL)
+            job->invalid[row] = batch->invalid[unique];
+    }
+}
@@ -0,0 +1,167 @@
+/**
+===============================================================================================================================
+    @file    quadratic_family.cpp
+    @brief   Solving of equations with the same a and b and terms of discriminant computed once.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <math.h>
+#include "quadratic_family.h"
+#include "quadratic_precise.h"
+#include "quadratic_simd.h"
+#include "utils.h"
+#include "custom_assert.h"
+
+static solving_state_t solve_family_scalar(const quadratic_family_t *family, const double *c, size_t n,
+                                           double *x1, double *x2, int8_t *number, uint8_t *invalid);
+
+void prepare_quadratic_family(double a, double b, quadratic_family_t *family) {
+    C_ASSERT(family != NULL, );
+
+    family->a         = a;
+    family->b         = b;
+    family->squared_b = b * b;
+    family->four_a    = 4 * a;
+    family->minus_b   = -b;
+    family->two_a     = 2 * a;
+    family->vertex    = 0;
+
+    if(!isfinite(a) || !isfinite(b))
+        family->kind = FAMILY_INVALID;
+    else if(!is_zero(a)) {
+        family->kind   = FAMILY_QUADRATIC;
+        family->vertex = family->minus_b / family->two_a + 0.0;
+    }
+    else if(!is_zero(b))
+        family->kind = FAMILY_LINEAR;
+    else
+        family->kind = FAMILY_DEGENERATE;
+}
+
+solving_state_t solve_quadratic_family(const quadratic_family_t *family, double c, double *x1, double *x2, roots_number_t *number) {
+    C_ASSERT(family != NULL, SOLVING_ERROR);
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    if(is_precise_solving())
+        return solve_quadratic_precise_roots(family->a, family->b, c, x1, x2, number);
+
+    if(!isfinite(c))
+        return INVALID_COEFFICIENTS;
+
+    switch(family->kind) {
+        case FAMILY_QUADRATIC: {
+            double discriminant = family->squared_b - family->four_a * c;
+
+            if(is_zero(discriminant)) {
+                *number = ONE_ROOT;
+                *x1 = *x2 = family->vertex;
+                return SOLVING_SUCCESS;
+            }
+
+            if(discriminant > 0) {
+                double discriminant_root = sqrt(discriminant);
+                *number = TWO_ROOTS;
+                *x1 = (family->minus_b - discriminant_root) / family->two_a + 0.0;
+                *x2 = (family->minus_b + discriminant_root) / family->two_a + 0.0;
+                return SOLVING_SUCCESS;
+            }
+
+            *number = NO_ROOTS;
+            return SOLVING_SUCCESS;
+        }
+        case FAMILY_LINEAR: {
+            *number = ONE_ROOT;
+            *x1 = *x2 = -c / family->b + 0.0;
+            return SOLVING_SUCCESS;
+        }
+        case FAMILY_DEGENERATE: {
+            *number = is_zero(c) ? INF_ROOTS : NO_ROOTS;
+            return SOLVING_SUCCESS;
+        }
+        case FAMILY_INVALID: {
+            return INVALID_COEFFICIENTS;
+        }
+        default: {
+            return SOLVING_ERROR;
+        }
+    }
+}
+
+solving_state_t solve_quadratic_family_batch(const quadratic_family_t *family, const double *c, size_t n,
+                                             double *x1, double *x2, int8_t *number, uint8_t *invalid) {
+    C_ASSERT(family != NULL, SOLVING_ERROR);
+    C_ASSERT(c      != NULL, SOLVING_ERROR);
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    bool has_invalid = false;
+    size_t solved = 0;
+
+    simd_family_kernel_t kernel = NULL;
+    if(family->kind == FAMILY_QUADRATIC && !is_precise_solving())
+        kernel = get_simd_family_kernel(get_simd_level());
+    if(kernel != NULL)
+        solved = kernel(family, c, n, x1, x2, number, invalid, &has_invalid);
+
+    //tail that does not fill a vector (or all equations of other families and of precise mode)
+    solving_state_t tail_state = solve_family_scalar(family, c + solved, n - solved, x1 + solved, x2 + solved,
+                                                     number + solved, invalid == NULL ? NULL : invalid + solved);
+    if(tail_state == SOLVING_ERROR)
+        return SOLVING_ERROR;
+
+    if(has_invalid || tail_state == INVALID_COEFFICIENTS)
+        return INVALID_COEFFICIENTS;
+
+    return SOLVING_SUCCESS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves equations of family one by one with solve_quadratic_family().
+
+    @details - Roots of equations without roots are zeros, as in solve_quadratic_batch().\n
+             - Arguments and return values are the same as in solve_quadratic_family_batch().
+
+===============================================================================================================================
+*/
+solving_state_t solve_family_scalar(const quadratic_family_t *family, const double *c, size_t n,
+                                    double *x1, double *x2, int8_t *number, uint8_t *invalid) {
+    solving_state_t batch_state = SOLVING_SUCCESS;
+
+    for(size_t i = 0; i < n; i++) {
+        roots_number_t roots_number = NOT_SOLVED;
+        x1[i] = x2[i] = 0;
+
+        switch(solve_quadratic_family(family, c[i], &x1[i], &x2[i], &roots_number)) {
+            case SOLVING_SUCCESS: {
+                if(invalid != NULL)
+                    invalid[i] = 0;
+                break;
+            }
+            case INVALID_COEFFICIENTS: {
+                if(invalid != NULL)
+                    invalid[i] = 1;
+                batch_state = INVALID_COEFFICIENTS;
+                break;
+            }
+            case SOLVING_ERROR: {
+                number[i] = (int8_t)NOT_SOLVED;
+                return SOLVING_ERROR;
+            }
+            default: {
+                number[i] = (int8_t)NOT_SOLVED;
+                return SOLVING_ERROR;
+            }
+        }
+        number[i] = (int8_t)roots_number;
+    }
+
+    return batch_state;
+}
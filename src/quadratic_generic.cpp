@@ -0,0 +1,53 @@
+/**
+===============================================================================================================================
+    @file    quadratic_generic.cpp
+    @brief   Instantiations and compile-time checks of solvers of quadratic equations in float, double and long double.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include "quadratic_generic.h"
+
+static_assert(!(solving_tolerance<double>() < EPSILON) && !(solving_tolerance<double>() > EPSILON),
+              "double solver must use the same tolerance as solve_quadratic()");
+
+//solver must give the same results, when it is evaluated by compiler
+static_assert(solved_equation(1, -3, 2).number == TWO_ROOTS &&
+              solved_equation(1, -3, 2).x1 < 1 + EPSILON && solved_equation(1, -3, 2).x1 > 1 - EPSILON &&
+              solved_equation(1, -3, 2).x2 < 2 + EPSILON && solved_equation(1, -3, 2).x2 > 2 - EPSILON,
+              "constexpr solver gives wrong roots of x^2 - 3x + 2");
+static_assert(solved_equation(1, 2, 1).number  == ONE_ROOT,  "constexpr solver gives wrong number of roots");
+static_assert(solved_equation(1, 0, 1).number  == NO_ROOTS,  "constexpr solver gives wrong number of roots");
+static_assert(solved_equation(0, 0, 0).number  == INF_ROOTS, "constexpr solver gives wrong number of roots");
+static_assert(solved_equation(0, 0, 1).number  == NO_ROOTS,  "constexpr solver gives wrong number of roots");
+static_assert(solved_equation(0, 2, -1).number == ONE_ROOT,  "constexpr solver gives wrong number of roots");
+static_assert(solved_equation(__builtin_inf(), 1, 1).number == NOT_SOLVED, "constexpr solver accepts infinite coefficients");
+static_assert(solved_equation_generic<float>(1, -3, 2).number == TWO_ROOTS &&
+              solved_equation_generic<long double>(1, -3, 2).number == TWO_ROOTS,
+              "constexpr float and long double solvers give wrong number of roots");
+
+static_assert(classify_quadratic_generic(1.0, -3.0, 2.0) == TWO_ROOTS && classify_quadratic_generic(1.0, 2.0, 1.0) == ONE_ROOT &&
+              classify_quadratic_generic(1.0, 0.0, 1.0) == NO_ROOTS  && classify_quadratic_generic(0.0, 0.0, 0.0) == INF_ROOTS &&
+              classify_quadratic_generic(0.0, 0.0, 1.0) == NO_ROOTS  && classify_quadratic_generic(0.0, 2.0, -1.0) == ONE_ROOT &&
+              classify_quadratic_generic(__builtin_inf(), 1.0, 1.0) == NOT_SOLVED,
+              "constexpr classifier gives wrong number of roots");
+
+template solving_state_t solve_quadratic_roots_generic<float>(float, float, float, float *, float *, roots_number_t *);
+template solving_state_t solve_quadratic_roots_generic<double>(double, double, double, double *, double *, roots_number_t *);
+template solving_state_t solve_quadratic_roots_generic<long double>(long double, long double, long double,
+                                                                    long double *, long double *, roots_number_t *);
+
+template solving_state_t solve_quadratic_generic<float>(quadratic_equation_generic_t<float> *);
+template solving_state_t solve_quadratic_generic<double>(quadratic_equation_generic_t<double> *);
+template solving_state_t solve_quadratic_generic<long double>(quadratic_equation_generic_t<long double> *);
+
+template roots_number_t classify_quadratic_generic<float>(float, float, float);
+template roots_number_t classify_quadratic_generic<double>(double, double, double);
+template roots_number_t classify_quadratic_generic<long double>(long double, long double, long double);
+
+template bool is_zero_generic<float>(float);
+template bool is_zero_generic<double>(double);
+template bool is_zero_generic<long double>(long double);
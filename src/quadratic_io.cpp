@@ -0,0 +1,235 @@
+/**
+===============================================================================================================================
+    @file    quadratic_io.cpp
+    @brief   Input of coefficients from user, output of roots and reading of tests files.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "colors.h"
+#include "custom_assert.h"
+#include "quadratic_io.h"
+
+enum scanning_result_t {
+    SCANNING_WITH_POSTFIX,
+    SCANNING_SUCCESS,
+    SCANNING_FAILURE
+};
+
+/**
+===============================================================================================================================
+    @brief   Maximum length of user input.
+
+===============================================================================================================================
+*/
+static const int MAX_INPUT_LENGTH = 32;
+
+static getting_coeffs_state_t get_number(char symbol, double *out);
+static void clear_buffer(void);
+static scanning_result_t try_get_double(double *out);
+static bool try_get_exit(void);
+
+static const int FILE_LINE_NUMBERS = 6;
+
+getting_coeffs_state_t get_coefficients(quadratic_equation_t *equation) {
+    C_ASSERT(equation != NULL, GETTING_ERROR);
+
+    equation->number = NOT_SOLVED;
+
+    equation->x1 = equation->x2 = 0;
+
+    color_printf(CYAN_TEXT, false, DEFAULT_BACKGROUND, "(\"exit\" to leave)\n");
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, "Type in coefficients for equation ");
+    color_printf(YELLOW_TEXT, false, DEFAULT_BACKGROUND, "ax^2 + bx + c == 0:\n");
+
+    if(get_number('a', &equation->a) == GETTING_EXIT)
+        return GETTING_EXIT;
+
+    if(get_number('b', &equation->b) == GETTING_EXIT)
+        return GETTING_EXIT;
+
+    if(get_number('c', &equation->c) == GETTING_EXIT)
+        return GETTING_EXIT;
+
+    return GETTING_SUCCESS;
+}
+
+void print_quadratic_result(const quadratic_equation_t *equation) {
+    C_ASSERT(equation != NULL, );
+
+    color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, "Equation ");
+    color_printf(YELLOW_TEXT, false, DEFAULT_BACKGROUND, "%lgx^2 + %lgx + %lg == 0:\n",
+        equation->a, equation->b, equation->c);
+    switch(equation->number) {
+        case NOT_SOLVED: {
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Not solved yet, try to run solve_equation(...)\n");
+            return ;
+        }
+        case NO_ROOTS: {
+            color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "Does not have real roots\n");
+            return ;
+        }
+        case ONE_ROOT: {
+            color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, "Has one root: ");
+            color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "x = %lg\n", equation->x1);
+            return ;
+        }
+        case TWO_ROOTS: {
+            color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, "Has two roots: ");
+            color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "x1 = %lg, x2 = %lg\n", equation->x1, equation->x2);
+            return ;
+        }
+        case INF_ROOTS: {
+            color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "Has infinitely many roots\n");
+            return ;
+        }
+        default: {
+            color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Something went wrong while trying to print out result\n");
+            return ;
+        }
+    }
+}
+
+reading_state_t read_expected_line(FILE *file, quadratic_equation_t *equation) {
+    C_ASSERT(file     != NULL, READING_ERROR);
+    C_ASSERT(equation != NULL, READING_ERROR);
+
+    if(file == NULL)
+        return READING_ERROR;
+
+    int read_state = fscanf(file, "%lg %lg %lg %lg %lg %d\n",
+                            &equation->a, &equation->b, &equation->c,
+                            &equation->x1, &equation->x2, (int*)&equation->number);
+
+    if(read_state == EOF)
+        return READING_END;
+    if(read_state != FILE_LINE_NUMBERS)
+        return READING_ERROR;
+    if(equation->number == NOT_SOLVED)
+        return READING_ERROR;
+
+    return READING_SUCCESS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Function tryes to get one number from user.
+
+    @details - Tries to get number until one of cases:\n
+                + User types in valid double value that can be understood by scanf.\n
+                + User types in word "exit".\n
+             - Function returns:\n
+                + GETTING_SUCCESS (in case of typing in number).\n
+                + GETTING_EXIT (in case of typing in "exit").\n
+                + GETTING_ERROR (unexpected error occured).\n
+                + There are no other return values.\n
+
+    @param   [in]  symbol Letter naming coefficient in quadratic equation('a' for x^2, b for x^1 and c for x^0).
+    @param   [out] out Pointer to double, which will contain user coefficient.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+getting_coeffs_state_t get_number(char symbol, double *out) {
+    C_ASSERT(out != NULL, GETTING_ERROR);
+
+    while(true) {
+        color_printf(CYAN_TEXT, false, DEFAULT_BACKGROUND, "%c = ", symbol);
+
+
+        switch(try_get_double(out)) {
+            case SCANNING_SUCCESS: {
+                return GETTING_SUCCESS;
+            }
+            case SCANNING_FAILURE: {
+                if(try_get_exit() == true)
+                    return GETTING_EXIT;
+            }
+            case SCANNING_WITH_POSTFIX: {
+                break ;
+            }
+            default: {
+                color_printf(RED_TEXT, false, DEFAULT_BACKGROUND, "Unexpected error\n");
+                return GETTING_ERROR;
+            }
+        }
+
+        color_printf(PURPLE_TEXT, false, DEFAULT_BACKGROUND, "Invalid input\n");
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Function moves pointer in console to last character.
+
+    @details - Moves pointer until meets:\n
+                + New line character.\n
+                + End Of File.\n
+
+===============================================================================================================================
+*/
+void clear_buffer(void) {
+    int c = getchar();
+    while(c != EOF && c != '\n') c = getchar();
+}
+
+/**
+===============================================================================================================================
+    @brief   - Tries to scanf number that user types in.
+
+    @details - Uses scanf() with '%lg' format.\n
+             - Function returns:\n
+                + SCANNING SUCCESS if successfully put user input in out.\n
+                + SCANNING_WITH_POSTFIX if user typed in something like '31fsd fd'.\n
+                + SCANNING_FAILURE if it was unable to scanf number.
+
+    @param   [out] out Pointer to double, which will contain user coefficient.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+scanning_result_t try_get_double(double *out) {
+    C_ASSERT(out != NULL, SCANNING_FAILURE);
+
+    color_flush();
+    if(scanf("%lg", out) != 1)
+        return SCANNING_FAILURE;
+
+    int c = getchar();
+    if(c != '\n' && c != EOF){
+        clear_buffer();
+        return SCANNING_WITH_POSTFIX;
+    }
+    return SCANNING_SUCCESS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Checks if user typed in word "exit"
+
+    @details - Scanf's input with '%s' format.\n
+             - After run moves pointer in console to last character.
+
+    @return  TRUE if there is word "exit" in console and FALSE if not.
+
+===============================================================================================================================
+*/
+bool try_get_exit(void) {
+    char string[MAX_INPUT_LENGTH] = {};
+    color_flush();
+    scanf("%s", string);
+
+    clear_buffer();
+
+    if(strcmp(string, "exit") == 0)
+        return true;
+    else
+        return false;
+}
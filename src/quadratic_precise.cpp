@@ -0,0 +1,248 @@
+/**
+===============================================================================================================================
+    @file    quadratic_precise.cpp
+    @brief   Solving quadratic equations with correctly classified discriminant.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <math.h>
+#include <float.h>
+#include "quadratic_precise.h"
+#include "quadratic_generic.h"
+#include "utils.h"
+#include "custom_assert.h"
+
+/**
+===============================================================================================================================
+    @brief   - Relative rounding error bound of discriminant computed as b * b - (4 * a) * c.
+
+    @details - Products and difference are rounded once each, so error is not bigger than
+               2u(|b * b| + |4a * c|) with u = DBL_EPSILON / 2, 3u leaves margin for rounding of bound itself.
+
+===============================================================================================================================
+*/
+static const double DISCRIMINANT_ERROR = 1.5 * DBL_EPSILON;
+
+/**
+===============================================================================================================================
+    @brief   - The biggest allowed ratio of error bound to discriminant in fast path.
+
+    @details - If error bound is not bigger than 9u|D| (|D| >= (|b * b| + |4a * c|) / 3 as in Kahan's algorithm),
+               discriminant and roots are accurate to few ulp, otherwise discriminant is recomputed.
+
+===============================================================================================================================
+*/
+static const double DISCRIMINANT_MAX_ERROR = 4.5 * DBL_EPSILON;
+
+/**
+===============================================================================================================================
+    @brief   - Absolute error of discriminant, that products can get in underflow.
+
+===============================================================================================================================
+*/
+static const double DISCRIMINANT_UNDERFLOW_ERROR = DBL_MIN;
+
+static bool precise_solving = false;
+
+static bool rounded_discriminant(double a, double b, double c, double *discriminant);
+static double exact_discriminant(double *a, double *b, double *c);
+static solving_state_t precise_roots(double a, double b, double c, double discriminant,
+                                     double *x1, double *x2, roots_number_t *number);
+
+solving_state_t solve_quadratic_precise_roots(double a, double b, double c, double *x1, double *x2, roots_number_t *number) {
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    //invalid coefficients and linear equations are handled as in usual solver
+    if(!isfinite(a) || !isfinite(b) || !isfinite(c) || is_zero(a))
+        return solve_quadratic_roots(a, b, c, x1, x2, number);
+
+    double discriminant = 0;
+    if(rounded_discriminant(a, b, c, &discriminant))
+        return precise_roots(a, b, c, discriminant, x1, x2, number);
+
+    discriminant = exact_discriminant(&a, &b, &c);
+    return precise_roots(a, b, c, discriminant, x1, x2, number);
+}
+
+roots_number_t classify_quadratic_precise(double a, double b, double c) {
+    if(!isfinite(a) || !isfinite(b) || !isfinite(c) || is_zero(a))
+        return classify_quadratic_generic<double>(a, b, c);
+
+    double discriminant = 0;
+    if(!rounded_discriminant(a, b, c, &discriminant))
+        discriminant = exact_discriminant(&a, &b, &c);
+
+    if(discriminant < 0)
+        return NO_ROOTS;
+    return discriminant > 0 ? TWO_ROOTS : ONE_ROOT;
+}
+
+solving_state_t solve_quadratic_batch_precise(const double *a, const double *b, const double *c, size_t n,
+                                              double *x1, double *x2, int8_t *number, uint8_t *invalid) {
+    C_ASSERT(a      != NULL, SOLVING_ERROR);
+    C_ASSERT(b      != NULL, SOLVING_ERROR);
+    C_ASSERT(c      != NULL, SOLVING_ERROR);
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    solving_state_t batch_state = SOLVING_SUCCESS;
+
+    for(size_t i = 0; i < n; i++) {
+        roots_number_t roots_number = NOT_SOLVED;
+        x1[i] = x2[i] = 0;
+
+        switch(solve_quadratic_precise_roots(a[i], b[i], c[i], &x1[i], &x2[i], &roots_number)) {
+            case SOLVING_SUCCESS: {
+                if(invalid != NULL)
+                    invalid[i] = 0;
+                break;
+            }
+            case INVALID_COEFFICIENTS: {
+                if(invalid != NULL)
+                    invalid[i] = 1;
+                batch_state = INVALID_COEFFICIENTS;
+                break;
+            }
+            case SOLVING_ERROR: {
+                number[i] = (int8_t)NOT_SOLVED;
+                return SOLVING_ERROR;
+            }
+            default: {
+                number[i] = (int8_t)NOT_SOLVED;
+                return SOLVING_ERROR;
+            }
+        }
+        number[i] = (int8_t)roots_number;
+    }
+
+    return batch_state;
+}
+
+void set_precise_solving(bool precise) {
+    precise_solving = precise;
+}
+
+bool is_precise_solving(void) {
+    return precise_solving;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Computes discriminant b * b - (4 * a) * c in double and checks if it can be used.
+
+    @details - Discriminant is used only if its sign is certain and cancellation did not make it inaccurate,
+               otherwise it must be recomputed with exact_discriminant().
+
+    @param   [in]  a, b, c            Coefficients.
+    @param   [out] discriminant       Pointer to rounded discriminant.
+
+    @return  True if rounded discriminant can be used.
+
+===============================================================================================================================
+*/
+bool rounded_discriminant(double a, double b, double c, double *discriminant) {
+    C_ASSERT(discriminant != NULL, false);
+
+    double square      = b * b;
+    double product     = 4 * a * c;
+    double error_bound = DISCRIMINANT_ERROR * (square + fabs(product)) + DISCRIMINANT_UNDERFLOW_ERROR;
+
+    *discriminant = square - product;
+    return isfinite(error_bound) && error_bound <= DISCRIMINANT_MAX_ERROR * fabs(*discriminant);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Computes discriminant with correct sign.
+
+    @details - Coefficients are scaled by the same power of two, so the biggest of them is in [1, 2),
+               products can not overflow and roots of equation do not change.\n
+             - Discriminant is computed with Kahan's algorithm: b * b and 4a * c are split into
+               rounded product and its exact error with fma(), their difference is exact near zero
+               (Sterbenz lemma), so result differs from exact discriminant by less than 2 ulp
+               and is zero only if exact discriminant is zero.
+
+    @param   [in,out] a, b, c         Pointers to coefficients, they are replaced with scaled coefficients.
+
+    @return  Discriminant of scaled coefficients.
+
+===============================================================================================================================
+*/
+double exact_discriminant(double *a, double *b, double *c) {
+    C_ASSERT(a != NULL, NAN);
+    C_ASSERT(b != NULL, NAN);
+    C_ASSERT(c != NULL, NAN);
+
+    double biggest = fmax(fabs(*a), fmax(fabs(*b), fabs(*c)));
+    int exponent = 0;
+    frexp(biggest, &exponent);
+
+    *a = ldexp(*a, 1 - exponent);
+    *b = ldexp(*b, 1 - exponent);
+    *c = ldexp(*c, 1 - exponent);
+
+    double four_a = 4 * *a;
+
+    double square       = *b * *b;
+    double square_error = fma(*b, *b, -square);
+
+    double product       = four_a * *c;
+    double product_error = fma(four_a, *c, -product);
+
+    return (square - product) + (square_error - product_error);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Finds roots of equation with known discriminant without cancellation.
+
+    @details - If b >= 0, q / a is x1 and c / q is x2, otherwise they are swapped,
+               so roots are ordered as in solve_quadratic().\n
+             - Negative zeros are replaced with zeros.
+
+    @param   [in]  a, b, c            Coefficients (a is not zero).
+    @param   [in]  discriminant       Discriminant with correct sign.
+    @param   [out] x1, x2             Pointers to roots.
+    @param   [out] number             Pointer to number of roots.
+
+    @return  SOLVING_SUCCESS.
+
+===============================================================================================================================
+*/
+solving_state_t precise_roots(double a, double b, double c, double discriminant,
+                              double *x1, double *x2, roots_number_t *number) {
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    if(discriminant < 0) {
+        *number = NO_ROOTS;
+        return SOLVING_SUCCESS;
+    }
+
+    if(!(discriminant > 0)) {
+        *number = ONE_ROOT;
+        *x1 = *x2 = -b / (2 * a) + 0.0;
+        return SOLVING_SUCCESS;
+    }
+
+    double q = -(b + copysign(sqrt(discriminant), b)) / 2;
+
+    *number = TWO_ROOTS;
+    if(signbit(b)) {
+        *x1 = c / q + 0.0;
+        *x2 = q / a + 0.0;
+    }
+    else {
+        *x1 = q / a + 0.0;
+        *x2 = c / q + 0.0;
+    }
+    return SOLVING_SUCCESS;
+}
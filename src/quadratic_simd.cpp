@@ -0,0 +1,944 @@
+/**
+===============================================================================================================================
+    @file    quadratic_simd.cpp
+    @brief   Vectorized kernels (SSE2, AVX2, AVX-512) for solving batches of quadratic equations.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details Kernels repeat solve_quadratic() (classify_quadratic() and solve_quadratic_family()) without branches:\n
+             - All cases (linear, two roots, one root, no roots, invalid) are computed for every lane
+               and chosen with masks.\n
+             - Operations are done in the same order as in scalar code, so results are the same bit for bit.\n
+             - -0.0 is changed to 0.0 by adding 0.0, which does not change any other value.
+
+===============================================================================================================================
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "utils.h"
+#include "quadratic_generic.h"
+#include "quadratic_simd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define QUADRATIC_X86
+#include <immintrin.h>
+#endif
+
+static void write_invalid_mask(unsigned finite_bits, size_t lanes, uint8_t *invalid, bool *has_invalid);
+
+static simd_level_t used_level = detect_simd_level();
+
+#ifdef QUADRATIC_X86
+
+__attribute__((target("sse2")))
+static size_t solve_batch_sse2(const double *a, const double *b, const double *c, size_t n,
+                               double *x1, double *x2, int8_t *number, uint8_t *invalid, bool *has_invalid) {
+    const __m128d sign      = _mm_set1_pd(-0.0);
+    const __m128d zero      = _mm_setzero_pd();
+    const __m128d epsilon   = _mm_set1_pd(EPSILON);
+    const __m128d infinity  = _mm_set1_pd(HUGE_VAL);
+    const __m128d two       = _mm_set1_pd(2.0);
+    const __m128d four      = _mm_set1_pd(4.0);
+    const __m128d n_two     = _mm_set1_pd(TWO_ROOTS);
+    const __m128d n_one     = _mm_set1_pd(ONE_ROOT);
+    const __m128d n_inf     = _mm_set1_pd(INF_ROOTS);
+    const __m128d n_invalid = _mm_set1_pd(NOT_SOLVED);
+
+    size_t i = 0;
+    for(; i + 2 <= n; i += 2) {
+        __m128d va = _mm_loadu_pd(a + i);
+        __m128d vb = _mm_loadu_pd(b + i);
+        __m128d vc = _mm_loadu_pd(c + i);
+
+        __m128d abs_a = _mm_andnot_pd(sign, va);
+        __m128d abs_b = _mm_andnot_pd(sign, vb);
+        __m128d abs_c = _mm_andnot_pd(sign, vc);
+
+        __m128d finite = _mm_and_pd(_mm_and_pd(_mm_cmplt_pd(abs_a, infinity),
+                                               _mm_cmplt_pd(abs_b, infinity)),
+                                               _mm_cmplt_pd(abs_c, infinity));
+        __m128d linear = _mm_cmplt_pd(abs_a, epsilon);
+        __m128d b_zero = _mm_cmplt_pd(abs_b, epsilon);
+        __m128d c_zero = _mm_cmplt_pd(abs_c, epsilon);
+
+        //quadratic lanes
+        __m128d discriminant = _mm_sub_pd(_mm_mul_pd(vb, vb), _mm_mul_pd(_mm_mul_pd(four, va), vc));
+        __m128d d_equals     = _mm_cmplt_pd(_mm_andnot_pd(sign, discriminant), epsilon);
+        __m128d d_bigger     = _mm_andnot_pd(d_equals, _mm_cmpgt_pd(discriminant, zero));
+
+        __m128d root    = _mm_sqrt_pd(discriminant);
+        __m128d minus_b = _mm_xor_pd(vb, sign);
+        __m128d two_a   = _mm_mul_pd(two, va);
+        __m128d q1      = _mm_div_pd(_mm_sub_pd(minus_b, root), two_a);
+        __m128d q2      = _mm_div_pd(_mm_add_pd(minus_b, root), two_a);
+        __m128d q0      = _mm_div_pd(minus_b, two_a);
+
+        __m128d quad_x1 = _mm_or_pd(_mm_and_pd(d_bigger, q1), _mm_and_pd(d_equals, q0));
+        __m128d quad_x2 = _mm_or_pd(_mm_and_pd(d_bigger, q2), _mm_and_pd(d_equals, q0));
+        __m128d quad_n  = _mm_or_pd(_mm_and_pd(d_bigger, n_two), _mm_and_pd(d_equals, n_one));
+
+        //linear lanes
+        __m128d lin_x = _mm_andnot_pd(b_zero, _mm_div_pd(_mm_xor_pd(vc, sign), vb));
+        __m128d lin_n = _mm_or_pd(_mm_andnot_pd(b_zero, n_one), _mm_and_pd(b_zero, _mm_and_pd(c_zero, n_inf)));
+
+        __m128d res_x1 = _mm_or_pd(_mm_and_pd(linear, lin_x), _mm_andnot_pd(linear, quad_x1));
+        __m128d res_x2 = _mm_or_pd(_mm_and_pd(linear, lin_x), _mm_andnot_pd(linear, quad_x2));
+        __m128d res_n  = _mm_or_pd(_mm_and_pd(linear, lin_n), _mm_andnot_pd(linear, quad_n));
+
+        res_x1 = _mm_add_pd(_mm_and_pd(finite, res_x1), zero);
+        res_x2 = _mm_add_pd(_mm_and_pd(finite, res_x2), zero);
+        res_n  = _mm_or_pd(_mm_and_pd(finite, res_n), _mm_andnot_pd(finite, n_invalid));
+
+        _mm_storeu_pd(x1 + i, res_x1);
+        _mm_storeu_pd(x2 + i, res_x2);
+
+        __m128i numbers = _mm_cvttpd_epi32(res_n);
+        numbers = _mm_packs_epi32(numbers, numbers);
+        numbers = _mm_packs_epi16(numbers, numbers);
+        int32_t packed = _mm_cvtsi128_si32(numbers);
+        memcpy(number + i, &packed, 2);
+
+        write_invalid_mask((unsigned)_mm_movemask_pd(finite), 2, invalid == NULL ? NULL : invalid + i, has_invalid);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t solve_batch_avx2(const double *a, const double *b, const double *c, size_t n,
+                               double *x1, double *x2, int8_t *number, uint8_t *invalid, bool *has_invalid) {
+    const __m256d sign      = _mm256_set1_pd(-0.0);
+    const __m256d zero      = _mm256_setzero_pd();
+    const __m256d epsilon   = _mm256_set1_pd(EPSILON);
+    const __m256d infinity  = _mm256_set1_pd(HUGE_VAL);
+    const __m256d two       = _mm256_set1_pd(2.0);
+    const __m256d four      = _mm256_set1_pd(4.0);
+    const __m256d n_two     = _mm256_set1_pd(TWO_ROOTS);
+    const __m256d n_one     = _mm256_set1_pd(ONE_ROOT);
+    const __m256d n_inf     = _mm256_set1_pd(INF_ROOTS);
+    const __m256d n_invalid = _mm256_set1_pd(NOT_SOLVED);
+
+    size_t i = 0;
+    for(; i + 4 <= n; i += 4) {
+        __m256d va = _mm256_loadu_pd(a + i);
+        __m256d vb = _mm256_loadu_pd(b + i);
+        __m256d vc = _mm256_loadu_pd(c + i);
+
+        __m256d abs_a = _mm256_andnot_pd(sign, va);
+        __m256d abs_b = _mm256_andnot_pd(sign, vb);
+        __m256d abs_c = _mm256_andnot_pd(sign, vc);
+
+        __m256d finite = _mm256_and_pd(_mm256_and_pd(_mm256_cmp_pd(abs_a, infinity, _CMP_LT_OQ),
+                                                     _mm256_cmp_pd(abs_b, infinity, _CMP_LT_OQ)),
+                                                     _mm256_cmp_pd(abs_c, infinity, _CMP_LT_OQ));
+        __m256d linear = _mm256_cmp_pd(abs_a, epsilon, _CMP_LT_OQ);
+        __m256d b_zero = _mm256_cmp_pd(abs_b, epsilon, _CMP_LT_OQ);
+        __m256d c_zero = _mm256_cmp_pd(abs_c, epsilon, _CMP_LT_OQ);
+
+        //quadratic lanes
+        __m256d discriminant = _mm256_sub_pd(_mm256_mul_pd(vb, vb), _mm256_mul_pd(_mm256_mul_pd(four, va), vc));
+        __m256d d_equals     = _mm256_cmp_pd(_mm256_andnot_pd(sign, discriminant), epsilon, _CMP_LT_OQ);
+        __m256d d_bigger     = _mm256_andnot_pd(d_equals, _mm256_cmp_pd(discriminant, zero, _CMP_GT_OQ));
+
+        __m256d root    = _mm256_sqrt_pd(discriminant);
+        __m256d minus_b = _mm256_xor_pd(vb, sign);
+        __m256d two_a   = _mm256_mul_pd(two, va);
+        __m256d q1      = _mm256_div_pd(_mm256_sub_pd(minus_b, root), two_a);
+        __m256d q2      = _mm256_div_pd(_mm256_add_pd(minus_b, root), two_a);
+        __m256d q0      = _mm256_div_pd(minus_b, two_a);
+
+        __m256d quad_x1 = _mm256_blendv_pd(_mm256_and_pd(d_equals, q0),    q1,    d_bigger);
+        __m256d quad_x2 = _mm256_blendv_pd(_mm256_and_pd(d_equals, q0),    q2,    d_bigger);
+        __m256d quad_n  = _mm256_blendv_pd(_mm256_and_pd(d_equals, n_one), n_two, d_bigger);
+
+        //linear lanes
+        __m256d lin_x = _mm256_andnot_pd(b_zero, _mm256_div_pd(_mm256_xor_pd(vc, sign), vb));
+        __m256d lin_n = _mm256_blendv_pd(n_one, _mm256_and_pd(c_zero, n_inf), b_zero);
+
+        __m256d res_x1 = _mm256_blendv_pd(quad_x1, lin_x, linear);
+        __m256d res_x2 = _mm256_blendv_pd(quad_x2, lin_x, linear);
+        __m256d res_n  = _mm256_blendv_pd(quad_n,  lin_n, linear);
+
+        res_x1 = _mm256_add_pd(_mm256_and_pd(finite, res_x1), zero);
+        res_x2 = _mm256_add_pd(_mm256_and_pd(finite, res_x2), zero);
+        res_n  = _mm256_blendv_pd(n_invalid, res_n, finite);
+
+        _mm256_storeu_pd(x1 + i, res_x1);
+        _mm256_storeu_pd(x2 + i, res_x2);
+
+        __m128i numbers = _mm256_cvttpd_epi32(res_n);
+        numbers = _mm_packs_epi32(numbers, numbers);
+        numbers = _mm_packs_epi16(numbers, numbers);
+        int32_t packed = _mm_cvtsi128_si32(numbers);
+        memcpy(number + i, &packed, 4);
+
+        write_invalid_mask((unsigned)_mm256_movemask_pd(finite), 4, invalid == NULL ? NULL : invalid + i, has_invalid);
+    }
+    return i;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves 8 equations as quadratic ones (a != 0) with AVX-512.
+
+    @details - Separated from solve_batch_avx512() to keep stack frames of both functions small.
+
+    @param   [in]  va, vb, vc         Coefficients of equations.
+    @param   [out] x1, x2             Roots (0 if there are no roots).
+    @param   [out] number             Numbers of roots.
+
+===============================================================================================================================
+*/
+__attribute__((target("avx512f")))
+static void solve_quadratic_avx512(__m512d va, __m512d vb, __m512d vc, __m512d *x1, __m512d *x2, __m512i *number) {
+    const __m512d epsilon = _mm512_set1_pd(EPSILON);
+
+    __m512d discriminant = _mm512_sub_pd(_mm512_mul_pd(vb, vb), _mm512_mul_pd(_mm512_mul_pd(_mm512_set1_pd(4.0), va), vc));
+    __mmask8 d_equals    = _mm512_cmp_pd_mask(_mm512_abs_pd(discriminant), epsilon, _CMP_LT_OQ);
+    __mmask8 d_bigger    = (__mmask8)(~d_equals & _mm512_cmp_pd_mask(discriminant, _mm512_setzero_pd(), _CMP_GT_OQ));
+
+    __m512d root    = _mm512_maskz_sqrt_pd((__mmask8)0xFF, discriminant);
+    __m512d minus_b = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(vb), _mm512_set1_epi64(INT64_MIN)));
+    __m512d two_a   = _mm512_mul_pd(_mm512_set1_pd(2.0), va);
+    __m512d q0      = _mm512_maskz_mov_pd(d_equals, _mm512_div_pd(minus_b, two_a));
+
+    *x1     = _mm512_mask_blend_pd(d_bigger, q0, _mm512_div_pd(_mm512_sub_pd(minus_b, root), two_a));
+    *x2     = _mm512_mask_blend_pd(d_bigger, q0, _mm512_div_pd(_mm512_add_pd(minus_b, root), two_a));
+    *number = _mm512_mask_blend_epi64(d_bigger,
+                                      _mm512_maskz_mov_epi64(d_equals, _mm512_set1_epi64(ONE_ROOT)),
+                                      _mm512_set1_epi64(TWO_ROOTS));
+}
+
+__attribute__((target("avx512f")))
+static size_t solve_batch_avx512(const double *a, const double *b, const double *c, size_t n,
+                                 double *x1, double *x2, int8_t *number, uint8_t *invalid, bool *has_invalid) {
+    const __m512d epsilon  = _mm512_set1_pd(EPSILON);
+    const __m512d infinity = _mm512_set1_pd(HUGE_VAL);
+
+    size_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        __m512d va = _mm512_loadu_pd(a + i);
+        __m512d vb = _mm512_loadu_pd(b + i);
+        __m512d vc = _mm512_loadu_pd(c + i);
+
+        __mmask8 finite = (__mmask8)(_mm512_cmp_pd_mask(_mm512_abs_pd(va), infinity, _CMP_LT_OQ) &
+                                     _mm512_cmp_pd_mask(_mm512_abs_pd(vb), infinity, _CMP_LT_OQ) &
+                                     _mm512_cmp_pd_mask(_mm512_abs_pd(vc), infinity, _CMP_LT_OQ));
+        __mmask8 linear = _mm512_cmp_pd_mask(_mm512_abs_pd(va), epsilon, _CMP_LT_OQ);
+        __mmask8 b_zero = _mm512_cmp_pd_mask(_mm512_abs_pd(vb), epsilon, _CMP_LT_OQ);
+        __mmask8 c_zero = _mm512_cmp_pd_mask(_mm512_abs_pd(vc), epsilon, _CMP_LT_OQ);
+
+        __m512d res_x1, res_x2;
+        __m512i res_n;
+        solve_quadratic_avx512(va, vb, vc, &res_x1, &res_x2, &res_n);
+
+        //linear lanes
+        __m512d minus_c = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(vc), _mm512_set1_epi64(INT64_MIN)));
+        __m512d lin_x   = _mm512_maskz_mov_pd((__mmask8)~b_zero, _mm512_div_pd(minus_c, vb));
+        __m512i lin_n   = _mm512_mask_blend_epi64(b_zero, _mm512_set1_epi64(ONE_ROOT),
+                                                  _mm512_maskz_mov_epi64(c_zero, _mm512_set1_epi64(INF_ROOTS)));
+
+        res_x1 = _mm512_add_pd(_mm512_maskz_mov_pd(finite, _mm512_mask_blend_pd(linear, res_x1, lin_x)), _mm512_setzero_pd());
+        res_x2 = _mm512_add_pd(_mm512_maskz_mov_pd(finite, _mm512_mask_blend_pd(linear, res_x2, lin_x)), _mm512_setzero_pd());
+        res_n  = _mm512_mask_blend_epi64(finite, _mm512_set1_epi64(NOT_SOLVED), _mm512_mask_blend_epi64(linear, res_n, lin_n));
+
+        _mm512_storeu_pd(x1 + i, res_x1);
+        _mm512_storeu_pd(x2 + i, res_x2);
+
+        int64_t packed = _mm_cvtsi128_si64(_mm512_maskz_cvtepi64_epi8((__mmask8)0xFF, res_n));
+        memcpy(number + i, &packed, 8);
+
+        write_invalid_mask((unsigned)finite, 8, invalid == NULL ? NULL : invalid + i, has_invalid);
+    }
+    return i;
+}
+
+__attribute__((target("sse2")))
+static size_t solve_batch_float_sse2(const float *a, const float *b, const float *c, size_t n,
+                                     float *x1, float *x2, int8_t *number, uint8_t *invalid, bool *has_invalid) {
+    const __m128 sign      = _mm_set1_ps(-0.0f);
+    const __m128 zero      = _mm_setzero_ps();
+    const __m128 epsilon   = _mm_set1_ps(solving_tolerance<float>());
+    const __m128 infinity  = _mm_set1_ps(HUGE_VALF);
+    const __m128 two       = _mm_set1_ps(2.0f);
+    const __m128 four      = _mm_set1_ps(4.0f);
+    const __m128 n_two     = _mm_set1_ps(TWO_ROOTS);
+    const __m128 n_one     = _mm_set1_ps(ONE_ROOT);
+    const __m128 n_inf     = _mm_set1_ps(INF_ROOTS);
+    const __m128 n_invalid = _mm_set1_ps(NOT_SOLVED);
+
+    size_t i = 0;
+    for(; i + 4 <= n; i += 4) {
+        __m128 va = _mm_loadu_ps(a + i);
+        __m128 vb = _mm_loadu_ps(b + i);
+        __m128 vc = _mm_loadu_ps(c + i);
+
+        __m128 abs_a = _mm_andnot_ps(sign, va);
+        __m128 abs_b = _mm_andnot_ps(sign, vb);
+        __m128 abs_c = _mm_andnot_ps(sign, vc);
+
+        __m128 finite = _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(abs_a, infinity),
+                                              _mm_cmplt_ps(abs_b, infinity)),
+                                              _mm_cmplt_ps(abs_c, infinity));
+        __m128 linear = _mm_cmplt_ps(abs_a, epsilon);
+        __m128 b_zero = _mm_cmplt_ps(abs_b, epsilon);
+        __m128 c_zero = _mm_cmplt_ps(abs_c, epsilon);
+
+        //quadratic lanes
+        __m128 discriminant = _mm_sub_ps(_mm_mul_ps(vb, vb), _mm_mul_ps(_mm_mul_ps(four, va), vc));
+        __m128 d_equals     = _mm_cmplt_ps(_mm_andnot_ps(sign, discriminant), epsilon);
+        __m128 d_bigger     = _mm_andnot_ps(d_equals, _mm_cmpgt_ps(discriminant, zero));
+
+        __m128 root    = _mm_sqrt_ps(discriminant);
+        __m128 minus_b = _mm_xor_ps(vb, sign);
+        __m128 two_a   = _mm_mul_ps(two, va);
+        __m128 q1      = _mm_div_ps(_mm_sub_ps(minus_b, root), two_a);
+        __m128 q2      = _mm_div_ps(_mm_add_ps(minus_b, root), two_a);
+        __m128 q0      = _mm_div_ps(minus_b, two_a);
+
+        __m128 quad_x1 = _mm_or_ps(_mm_and_ps(d_bigger, q1), _mm_and_ps(d_equals, q0));
+        __m128 quad_x2 = _mm_or_ps(_mm_and_ps(d_bigger, q2), _mm_and_ps(d_equals, q0));
+        __m128 quad_n  = _mm_or_ps(_mm_and_ps(d_bigger, n_two), _mm_and_ps(d_equals, n_one));
+
+        //linear lanes
+        __m128 lin_x = _mm_andnot_ps(b_zero, _mm_div_ps(_mm_xor_ps(vc, sign), vb));
+        __m128 lin_n = _mm_or_ps(_mm_andnot_ps(b_zero, n_one), _mm_and_ps(b_zero, _mm_and_ps(c_zero, n_inf)));
+
+        __m128 res_x1 = _mm_or_ps(_mm_and_ps(linear, lin_x), _mm_andnot_ps(linear, quad_x1));
+        __m128 res_x2 = _mm_or_ps(_mm_and_ps(linear, lin_x), _mm_andnot_ps(linear, quad_x2));
+        __m128 res_n  = _mm_or_ps(_mm_and_ps(linear, lin_n), _mm_andnot_ps(linear, quad_n));
+
+        res_x1 = _mm_add_ps(_mm_and_ps(finite, res_x1), zero);
+        res_x2 = _mm_add_ps(_mm_and_ps(finite, res_x2), zero);
+        res_n  = _mm_or_ps(_mm_and_ps(finite, res_n), _mm_andnot_ps(finite, n_invalid));
+
+        _mm_storeu_ps(x1 + i, res_x1);
+        _mm_storeu_ps(x2 + i, res_x2);
+
+        __m128i numbers = _mm_cvttps_epi32(res_n);
+        numbers = _mm_packs_epi32(numbers, numbers);
+        numbers = _mm_packs_epi16(numbers, numbers);
+        int32_t packed = _mm_cvtsi128_si32(numbers);
+        memcpy(number + i, &packed, 4);
+
+        write_invalid_mask((unsigned)_mm_movemask_ps(finite), 4, invalid == NULL ? NULL : invalid + i, has_invalid);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t solve_batch_float_avx2(const float *a, const float *b, const float *c, size_t n,
+                                     float *x1, float *x2, int8_t *number, uint8_t *invalid, bool *has_invalid) {
+    const __m256 sign      = _mm256_set1_ps(-0.0f);
+    const __m256 zero      = _mm256_setzero_ps();
+    const __m256 epsilon   = _mm256_set1_ps(solving_tolerance<float>());
+    const __m256 infinity  = _mm256_set1_ps(HUGE_VALF);
+    const __m256 two       = _mm256_set1_ps(2.0f);
+    const __m256 four      = _mm256_set1_ps(4.0f);
+    const __m256 n_two     = _mm256_set1_ps(TWO_ROOTS);
+    const __m256 n_one     = _mm256_set1_ps(ONE_ROOT);
+    const __m256 n_inf     = _mm256_set1_ps(INF_ROOTS);
+    const __m256 n_invalid = _mm256_set1_ps(NOT_SOLVED);
+
+    size_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        __m256 va = _mm256_loadu_ps(a + i);
+        __m256 vb = _mm256_loadu_ps(b + i);
+        __m256 vc = _mm256_loadu_ps(c + i);
+
+        __m256 abs_a = _mm256_andnot_ps(sign, va);
+        __m256 abs_b = _mm256_andnot_ps(sign, vb);
+        __m256 abs_c = _mm256_andnot_ps(sign, vc);
+
+        __m256 finite = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(abs_a, infinity, _CMP_LT_OQ),
+                                                    _mm256_cmp_ps(abs_b, infinity, _CMP_LT_OQ)),
+                                                    _mm256_cmp_ps(abs_c, infinity, _CMP_LT_OQ));
+        __m256 linear = _mm256_cmp_ps(abs_a, epsilon, _CMP_LT_OQ);
+        __m256 b_zero = _mm256_cmp_ps(abs_b, epsilon, _CMP_LT_OQ);
+        __m256 c_zero = _mm256_cmp_ps(abs_c, epsilon, _CMP_LT_OQ);
+
+        //quadratic lanes
+        __m256 discriminant = _mm256_sub_ps(_mm256_mul_ps(vb, vb), _mm256_mul_ps(_mm256_mul_ps(four, va), vc));
+        __m256 d_equals     = _mm256_cmp_ps(_mm256_andnot_ps(sign, discriminant), epsilon, _CMP_LT_OQ);
+        __m256 d_bigger     = _mm256_andnot_ps(d_equals, _mm256_cmp_ps(discriminant, zero, _CMP_GT_OQ));
+
+        __m256 root    = _mm256_sqrt_ps(discriminant);
+        __m256 minus_b = _mm256_xor_ps(vb, sign);
+        __m256 two_a   = _mm256_mul_ps(two, va);
+        __m256 q1      = _mm256_div_ps(_mm256_sub_ps(minus_b, root), two_a);
+        __m256 q2      = _mm256_div_ps(_mm256_add_ps(minus_b, root), two_a);
+        __m256 q0      = _mm256_div_ps(minus_b, two_a);
+
+        __m256 quad_x1 = _mm256_blendv_ps(_mm256_and_ps(d_equals, q0),    q1,    d_bigger);
+        __m256 quad_x2 = _mm256_blendv_ps(_mm256_and_ps(d_equals, q0),    q2,    d_bigger);
+        __m256 quad_n  = _mm256_blendv_ps(_mm256_and_ps(d_equals, n_one), n_two, d_bigger);
+
+        //linear lanes
+        __m256 lin_x = _mm256_andnot_ps(b_zero, _mm256_div_ps(_mm256_xor_ps(vc, sign), vb));
+        __m256 lin_n = _mm256_blendv_ps(n_one, _mm256_and_ps(c_zero, n_inf), b_zero);
+
+        __m256 res_x1 = _mm256_blendv_ps(quad_x1, lin_x, linear);
+        __m256 res_x2 = _mm256_blendv_ps(quad_x2, lin_x, linear);
+        __m256 res_n  = _mm256_blendv_ps(quad_n,  lin_n, linear);
+
+        res_x1 = _mm256_add_ps(_mm256_and_ps(finite, res_x1), zero);
+        res_x2 = _mm256_add_ps(_mm256_and_ps(finite, res_x2), zero);
+        res_n  = _mm256_blendv_ps(n_invalid, res_n, finite);
+
+        _mm256_storeu_ps(x1 + i, res_x1);
+        _mm256_storeu_ps(x2 + i, res_x2);
+
+        __m256i wide_numbers = _mm256_cvttps_epi32(res_n);
+        __m128i numbers = _mm_packs_epi32(_mm256_castsi256_si128(wide_numbers), _mm256_extracti128_si256(wide_numbers, 1));
+        numbers = _mm_packs_epi16(numbers, numbers);
+        int64_t packed = _mm_cvtsi128_si64(numbers);
+        memcpy(number + i, &packed, 8);
+
+        write_invalid_mask((unsigned)_mm256_movemask_ps(finite), 8, invalid == NULL ? NULL : invalid + i, has_invalid);
+    }
+    return i;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves 16 float equations as quadratic ones (a != 0) with AVX-512.
+
+    @details - Separated from solve_batch_float_avx512() to keep stack frames of both functions small.
+
+    @param   [in]  va, vb, vc         Coefficients of equations.
+    @param   [out] x1, x2             Roots (0 if there are no roots).
+    @param   [out] number             Numbers of roots.
+
+===============================================================================================================================
+*/
+__attribute__((target("avx512f")))
+static void solve_quadratic_float_avx512(__m512 va, __m512 vb, __m512 vc, __m512 *x1, __m512 *x2, __m512i *number) {
+    const __m512 epsilon = _mm512_set1_ps(solving_tolerance<float>());
+
+    __m512 discriminant = _mm512_sub_ps(_mm512_mul_ps(vb, vb), _mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(4.0f), va), vc));
+    __mmask16 d_equals  = _mm512_cmp_ps_mask(_mm512_abs_ps(discriminant), epsilon, _CMP_LT_OQ);
+    __mmask16 d_bigger  = (__mmask16)(~d_equals & _mm512_cmp_ps_mask(discriminant, _mm512_setzero_ps(), _CMP_GT_OQ));
+
+    __m512 root    = _mm512_maskz_sqrt_ps((__mmask16)0xFFFF, discriminant);
+    __m512 minus_b = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(vb), _mm512_set1_epi32(INT32_MIN)));
+    __m512 two_a   = _mm512_mul_ps(_mm512_set1_ps(2.0f), va);
+    __m512 q0      = _mm512_maskz_mov_ps(d_equals, _mm512_div_ps(minus_b, two_a));
+
+    *x1     = _mm512_mask_blend_ps(d_bigger, q0, _mm512_div_ps(_mm512_sub_ps(minus_b, root), two_a));
+    *x2     = _mm512_mask_blend_ps(d_bigger, q0, _mm512_div_ps(_mm512_add_ps(minus_b, root), two_a));
+    *number = _mm512_mask_blend_epi32(d_bigger,
+                                      _mm512_maskz_mov_epi32(d_equals, _mm512_set1_epi32(ONE_ROOT)),
+                                      _mm512_set1_epi32(TWO_ROOTS));
+}
+
+__attribute__((target("avx512f")))
+static size_t solve_batch_float_avx512(const float *a, const float *b, const float *c, size_t n,
+                                       float *x1, float *x2, int8_t *number, uint8_t *invalid, bool *has_invalid) {
+    const __m512 epsilon  = _mm512_set1_ps(solving_tolerance<float>());
+    const __m512 infinity = _mm512_set1_ps(HUGE_VALF);
+
+    size_t i = 0;
+    for(; i + 16 <= n; i += 16) {
+        __m512 va = _mm512_loadu_ps(a + i);
+        __m512 vb = _mm512_loadu_ps(b + i);
+        __m512 vc = _mm512_loadu_ps(c + i);
+
+        __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(_mm512_abs_ps(va), infinity, _CMP_LT_OQ) &
+                                       _mm512_cmp_ps_mask(_mm512_abs_ps(vb), infinity, _CMP_LT_OQ) &
+                                       _mm512_cmp_ps_mask(_mm512_abs_ps(vc), infinity, _CMP_LT_OQ));
+        __mmask16 linear = _mm512_cmp_ps_mask(_mm512_abs_ps(va), epsilon, _CMP_LT_OQ);
+        __mmask16 b_zero = _mm512_cmp_ps_mask(_mm512_abs_ps(vb), epsilon, _CMP_LT_OQ);
+        __mmask16 c_zero = _mm512_cmp_ps_mask(_mm512_abs_ps(vc), epsilon, _CMP_LT_OQ);
+
+        __m512 res_x1, res_x2;
+        __m512i res_n;
+        solve_quadratic_float_avx512(va, vb, vc, &res_x1, &res_x2, &res_n);
+
+        //linear lanes
+        __m512 minus_c = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(vc), _mm512_set1_epi32(INT32_MIN)));
+        __m512 lin_x   = _mm512_maskz_mov_ps((__mmask16)~b_zero, _mm512_div_ps(minus_c, vb));
+        __m512i lin_n  = _mm512_mask_blend_epi32(b_zero, _mm512_set1_epi32(ONE_ROOT),
+                                                 _mm512_maskz_mov_epi32(c_zero, _mm512_set1_epi32(INF_ROOTS)));
+
+        res_x1 = _mm512_add_ps(_mm512_maskz_mov_ps(finite, _mm512_mask_blend_ps(linear, res_x1, lin_x)), _mm512_setzero_ps());
+        res_x2 = _mm512_add_ps(_mm512_maskz_mov_ps(finite, _mm512_mask_blend_ps(linear, res_x2, lin_x)), _mm512_setzero_ps());
+        res_n  = _mm512_mask_blend_epi32(finite, _mm512_set1_epi32(NOT_SOLVED), _mm512_mask_blend_epi32(linear, res_n, lin_n));
+
+        _mm512_storeu_ps(x1 + i, res_x1);
+        _mm512_storeu_ps(x2 + i, res_x2);
+        _mm_storeu_si128((__m128i *)(number + i), _mm512_maskz_cvtepi32_epi8((__mmask16)0xFFFF, res_n));
+
+        write_invalid_mask((unsigned)finite, 16, invalid == NULL ? NULL : invalid + i, has_invalid);
+    }
+    return i;
+}
+
+__attribute__((target("sse2")))
+static size_t classify_batch_sse2(const double *a, const double *b, const double *c, size_t n,
+                                  int8_t *number, uint8_t *invalid, bool *has_invalid) {
+    const __m128d sign      = _mm_set1_pd(-0.0);
+    const __m128d zero      = _mm_setzero_pd();
+    const __m128d epsilon   = _mm_set1_pd(EPSILON);
+    const __m128d infinity  = _mm_set1_pd(HUGE_VAL);
+    const __m128d four      = _mm_set1_pd(4.0);
+    const __m128d n_two     = _mm_set1_pd(TWO_ROOTS);
+    const __m128d n_one     = _mm_set1_pd(ONE_ROOT);
+    const __m128d n_inf     = _mm_set1_pd(INF_ROOTS);
+    const __m128d n_invalid = _mm_set1_pd(NOT_SOLVED);
+
+    size_t i = 0;
+    for(; i + 2 <= n; i += 2) {
+        __m128d va = _mm_loadu_pd(a + i);
+        __m128d vb = _mm_loadu_pd(b + i);
+        __m128d vc = _mm_loadu_pd(c + i);
+
+        __m128d abs_a = _mm_andnot_pd(sign, va);
+        __m128d abs_b = _mm_andnot_pd(sign, vb);
+        __m128d abs_c = _mm_andnot_pd(sign, vc);
+
+        __m128d finite = _mm_and_pd(_mm_and_pd(_mm_cmplt_pd(abs_a, infinity),
+                                               _mm_cmplt_pd(abs_b, infinity)),
+                                               _mm_cmplt_pd(abs_c, infinity));
+        __m128d linear = _mm_cmplt_pd(abs_a, epsilon);
+        __m128d b_zero = _mm_cmplt_pd(abs_b, epsilon);
+        __m128d c_zero = _mm_cmplt_pd(abs_c, epsilon);
+
+        //quadratic lanes
+        __m128d discriminant = _mm_sub_pd(_mm_mul_pd(vb, vb), _mm_mul_pd(_mm_mul_pd(four, va), vc));
+        __m128d d_equals     = _mm_cmplt_pd(_mm_andnot_pd(sign, discriminant), epsilon);
+        __m128d d_bigger     = _mm_andnot_pd(d_equals, _mm_cmpgt_pd(discriminant, zero));
+        __m128d quad_n       = _mm_or_pd(_mm_and_pd(d_bigger, n_two), _mm_and_pd(d_equals, n_one));
+
+        //linear lanes
+        __m128d lin_n = _mm_or_pd(_mm_andnot_pd(b_zero, n_one), _mm_and_pd(b_zero, _mm_and_pd(c_zero, n_inf)));
+
+        __m128d res_n = _mm_or_pd(_mm_and_pd(linear, lin_n), _mm_andnot_pd(linear, quad_n));
+        res_n = _mm_or_pd(_mm_and_pd(finite, res_n), _mm_andnot_pd(finite, n_invalid));
+
+        __m128i numbers = _mm_cvttpd_epi32(res_n);
+        numbers = _mm_packs_epi32(numbers, numbers);
+        numbers = _mm_packs_epi16(numbers, numbers);
+        int32_t packed = _mm_cvtsi128_si32(numbers);
+        memcpy(number + i, &packed, 2);
+
+        write_invalid_mask((unsigned)_mm_movemask_pd(finite), 2, invalid == NULL ? NULL : invalid + i, has_invalid);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t classify_batch_avx2(const double *a, const double *b, const double *c, size_t n,
+                                  int8_t *number, uint8_t *invalid, bool *has_invalid) {
+    const __m256d sign      = _mm256_set1_pd(-0.0);
+    const __m256d zero      = _mm256_setzero_pd();
+    const __m256d epsilon   = _mm256_set1_pd(EPSILON);
+    const __m256d infinity  = _mm256_set1_pd(HUGE_VAL);
+    const __m256d four      = _mm256_set1_pd(4.0);
+    const __m256d n_two     = _mm256_set1_pd(TWO_ROOTS);
+    const __m256d n_one     = _mm256_set1_pd(ONE_ROOT);
+    const __m256d n_inf     = _mm256_set1_pd(INF_ROOTS);
+    const __m256d n_invalid = _mm256_set1_pd(NOT_SOLVED);
+
+    size_t i = 0;
+    for(; i + 4 <= n; i += 4) {
+        __m256d va = _mm256_loadu_pd(a + i);
+        __m256d vb = _mm256_loadu_pd(b + i);
+        __m256d vc = _mm256_loadu_pd(c + i);
+
+        __m256d abs_a = _mm256_andnot_pd(sign, va);
+        __m256d abs_b = _mm256_andnot_pd(sign, vb);
+        __m256d abs_c = _mm256_andnot_pd(sign, vc);
+
+        __m256d finite = _mm256_and_pd(_mm256_and_pd(_mm256_cmp_pd(abs_a, infinity, _CMP_LT_OQ),
+                                                     _mm256_cmp_pd(abs_b, infinity, _CMP_LT_OQ)),
+                                                     _mm256_cmp_pd(abs_c, infinity, _CMP_LT_OQ));
+        __m256d linear = _mm256_cmp_pd(abs_a, epsilon, _CMP_LT_OQ);
+        __m256d b_zero = _mm256_cmp_pd(abs_b, epsilon, _CMP_LT_OQ);
+        __m256d c_zero = _mm256_cmp_pd(abs_c, epsilon, _CMP_LT_OQ);
+
+        //quadratic lanes
+        __m256d discriminant = _mm256_sub_pd(_mm256_mul_pd(vb, vb), _mm256_mul_pd(_mm256_mul_pd(four, va), vc));
+        __m256d d_equals     = _mm256_cmp_pd(_mm256_andnot_pd(sign, discriminant), epsilon, _CMP_LT_OQ);
+        __m256d d_bigger     = _mm256_andnot_pd(d_equals, _mm256_cmp_pd(discriminant, zero, _CMP_GT_OQ));
+        __m256d quad_n       = _mm256_blendv_pd(_mm256_and_pd(d_equals, n_one), n_two, d_bigger);
+
+        //linear lanes
+        __m256d lin_n = _mm256_blendv_pd(n_one, _mm256_and_pd(c_zero, n_inf), b_zero);
+
+        __m256d res_n = _mm256_blendv_pd(quad_n, lin_n, linear);
+        res_n = _mm256_blendv_pd(n_invalid, res_n, finite);
+
+        __m128i numbers = _mm256_cvttpd_epi32(res_n);
+        numbers = _mm_packs_epi32(numbers, numbers);
+        numbers = _mm_packs_epi16(numbers, numbers);
+        int32_t packed = _mm_cvtsi128_si32(numbers);
+        memcpy(number + i, &packed, 4);
+
+        write_invalid_mask((unsigned)_mm256_movemask_pd(finite), 4, invalid == NULL ? NULL : invalid + i, has_invalid);
+    }
+    return i;
+}
+
+__attribute__((target("avx512f")))
+static size_t classify_batch_avx512(const double *a, const double *b, const double *c, size_t n,
+                                    int8_t *number, uint8_t *invalid, bool *has_invalid) {
+    const __m512d epsilon  = _mm512_set1_pd(EPSILON);
+    const __m512d infinity = _mm512_set1_pd(HUGE_VAL);
+    const __m512d four     = _mm512_set1_pd(4.0);
+
+    size_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        __m512d va = _mm512_loadu_pd(a + i);
+        __m512d vb = _mm512_loadu_pd(b + i);
+        __m512d vc = _mm512_loadu_pd(c + i);
+
+        __mmask8 finite = (__mmask8)(_mm512_cmp_pd_mask(_mm512_abs_pd(va), infinity, _CMP_LT_OQ) &
+                                     _mm512_cmp_pd_mask(_mm512_abs_pd(vb), infinity, _CMP_LT_OQ) &
+                                     _mm512_cmp_pd_mask(_mm512_abs_pd(vc), infinity, _CMP_LT_OQ));
+        __mmask8 linear = _mm512_cmp_pd_mask(_mm512_abs_pd(va), epsilon, _CMP_LT_OQ);
+        __mmask8 b_zero = _mm512_cmp_pd_mask(_mm512_abs_pd(vb), epsilon, _CMP_LT_OQ);
+        __mmask8 c_zero = _mm512_cmp_pd_mask(_mm512_abs_pd(vc), epsilon, _CMP_LT_OQ);
+
+        //quadratic lanes
+        __m512d discriminant = _mm512_sub_pd(_mm512_mul_pd(vb, vb), _mm512_mul_pd(_mm512_mul_pd(four, va), vc));
+        __mmask8 d_equals    = _mm512_cmp_pd_mask(_mm512_abs_pd(discriminant), epsilon, _CMP_LT_OQ);
+        __mmask8 d_bigger    = (__mmask8)(~d_equals & _mm512_cmp_pd_mask(discriminant, _mm512_setzero_pd(), _CMP_GT_OQ));
+        __m512i quad_n       = _mm512_mask_blend_epi64(d_bigger,
+                                                       _mm512_maskz_mov_epi64(d_equals, _mm512_set1_epi64(ONE_ROOT)),
+                                                       _mm512_set1_epi64(TWO_ROOTS));
+
+        //linear lanes
+        __m512i lin_n = _mm512_mask_blend_epi64(b_zero, _mm512_set1_epi64(ONE_ROOT),
+                                                _mm512_maskz_mov_epi64(c_zero, _mm512_set1_epi64(INF_ROOTS)));
+
+        __m512i res_n = _mm512_mask_blend_epi64(finite, _mm512_set1_epi64(NOT_SOLVED),
+                                                _mm512_mask_blend_epi64(linear, quad_n, lin_n));
+
+        int64_t packed = _mm_cvtsi128_si64(_mm512_maskz_cvtepi64_epi8((__mmask8)0xFF, res_n));
+        memcpy(number + i, &packed, 8);
+
+        write_invalid_mask((unsigned)finite, 8, invalid == NULL ? NULL : invalid + i, has_invalid);
+    }
+    return i;
+}
+
+__attribute__((target("sse2")))
+static size_t solve_family_sse2(const quadratic_family_t *family, const double *c, size_t n,
+                                double *x1, double *x2, int8_t *number, uint8_t *invalid, bool *has_invalid) {
+    const __m128d sign      = _mm_set1_pd(-0.0);
+    const __m128d zero      = _mm_setzero_pd();
+    const __m128d epsilon   = _mm_set1_pd(EPSILON);
+    const __m128d infinity  = _mm_set1_pd(HUGE_VAL);
+    const __m128d n_two     = _mm_set1_pd(TWO_ROOTS);
+    const __m128d n_one     = _mm_set1_pd(ONE_ROOT);
+    const __m128d n_invalid = _mm_set1_pd(NOT_SOLVED);
+    const __m128d squared_b = _mm_set1_pd(family->squared_b);
+    const __m128d four_a    = _mm_set1_pd(family->four_a);
+    const __m128d minus_b   = _mm_set1_pd(family->minus_b);
+    const __m128d two_a     = _mm_set1_pd(family->two_a);
+    const __m128d vertex    = _mm_set1_pd(family->vertex);
+
+    size_t i = 0;
+    for(; i + 2 <= n; i += 2) {
+        __m128d vc = _mm_loadu_pd(c + i);
+        __m128d finite = _mm_cmplt_pd(_mm_andnot_pd(sign, vc), infinity);
+
+        __m128d discriminant = _mm_sub_pd(squared_b, _mm_mul_pd(four_a, vc));
+        __m128d d_equals     = _mm_cmplt_pd(_mm_andnot_pd(sign, discriminant), epsilon);
+        __m128d d_bigger     = _mm_andnot_pd(d_equals, _mm_cmpgt_pd(discriminant, zero));
+
+        __m128d root = _mm_sqrt_pd(discriminant);
+        __m128d q1   = _mm_div_pd(_mm_sub_pd(minus_b, root), two_a);
+        __m128d q2   = _mm_div_pd(_mm_add_pd(minus_b, root), two_a);
+
+        __m128d res_x1 = _mm_or_pd(_mm_and_pd(d_bigger, q1), _mm_and_pd(d_equals, vertex));
+        __m128d res_x2 = _mm_or_pd(_mm_and_pd(d_bigger, q2), _mm_and_pd(d_equals, vertex));
+        __m128d res_n  = _mm_or_pd(_mm_and_pd(d_bigger, n_two), _mm_and_pd(d_equals, n_one));
+
+        res_x1 = _mm_add_pd(_mm_and_pd(finite, res_x1), zero);
+        res_x2 = _mm_add_pd(_mm_and_pd(finite, res_x2), zero);
+        res_n  = _mm_or_pd(_mm_and_pd(finite, res_n), _mm_andnot_pd(finite, n_invalid));
+
+        _mm_storeu_pd(x1 + i, res_x1);
+        _mm_storeu_pd(x2 + i, res_x2);
+
+        __m128i numbers = _mm_cvttpd_epi32(res_n);
+        numbers = _mm_packs_epi32(numbers, numbers);
+        numbers = _mm_packs_epi16(numbers, numbers);
+        int32_t packed = _mm_cvtsi128_si32(numbers);
+        memcpy(number + i, &packed, 2);
+
+        write_invalid_mask((unsigned)_mm_movemask_pd(finite), 2, invalid == NULL ? NULL : invalid + i, has_invalid);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t solve_family_avx2(const quadratic_family_t *family, const double *c, size_t n,
+                                double *x1, double *x2, int8_t *number, uint8_t *invalid, bool *has_invalid) {
+    const __m256d sign      = _mm256_set1_pd(-0.0);
+    const __m256d zero      = _mm256_setzero_pd();
+    const __m256d epsilon   = _mm256_set1_pd(EPSILON);
+    const __m256d infinity  = _mm256_set1_pd(HUGE_VAL);
+    const __m256d n_two     = _mm256_set1_pd(TWO_ROOTS);
+    const __m256d n_one     = _mm256_set1_pd(ONE_ROOT);
+    const __m256d n_invalid = _mm256_set1_pd(NOT_SOLVED);
+    const __m256d squared_b = _mm256_set1_pd(family->squared_b);
+    const __m256d four_a    = _mm256_set1_pd(family->four_a);
+    const __m256d minus_b   = _mm256_set1_pd(family->minus_b);
+    const __m256d two_a     = _mm256_set1_pd(family->two_a);
+    const __m256d vertex    = _mm256_set1_pd(family->vertex);
+
+    size_t i = 0;
+    for(; i + 4 <= n; i += 4) {
+        __m256d vc = _mm256_loadu_pd(c + i);
+        __m256d finite = _mm256_cmp_pd(_mm256_andnot_pd(sign, vc), infinity, _CMP_LT_OQ);
+
+        __m256d discriminant = _mm256_sub_pd(squared_b, _mm256_mul_pd(four_a, vc));
+        __m256d d_equals     = _mm256_cmp_pd(_mm256_andnot_pd(sign, discriminant), epsilon, _CMP_LT_OQ);
+        __m256d d_bigger     = _mm256_andnot_pd(d_equals, _mm256_cmp_pd(discriminant, zero, _CMP_GT_OQ));
+
+        __m256d root = _mm256_sqrt_pd(discriminant);
+        __m256d q1   = _mm256_div_pd(_mm256_sub_pd(minus_b, root), two_a);
+        __m256d q2   = _mm256_div_pd(_mm256_add_pd(minus_b, root), two_a);
+
+        __m256d res_x1 = _mm256_blendv_pd(_mm256_and_pd(d_equals, vertex), q1,    d_bigger);
+        __m256d res_x2 = _mm256_blendv_pd(_mm256_and_pd(d_equals, vertex), q2,    d_bigger);
+        __m256d res_n  = _mm256_blendv_pd(_mm256_and_pd(d_equals, n_one),  n_two, d_bigger);
+
+        res_x1 = _mm256_add_pd(_mm256_and_pd(finite, res_x1), zero);
+        res_x2 = _mm256_add_pd(_mm256_and_pd(finite, res_x2), zero);
+        res_n  = _mm256_blendv_pd(n_invalid, res_n, finite);
+
+        _mm256_storeu_pd(x1 + i, res_x1);
+        _mm256_storeu_pd(x2 + i, res_x2);
+
+        __m128i numbers = _mm256_cvttpd_epi32(res_n);
+        numbers = _mm_packs_epi32(numbers, numbers);
+        numbers = _mm_packs_epi16(numbers, numbers);
+        int32_t packed = _mm_cvtsi128_si32(numbers);
+        memcpy(number + i, &packed, 4);
+
+        write_invalid_mask((unsigned)_mm256_movemask_pd(finite), 4, invalid == NULL ? NULL : invalid + i, has_invalid);
+    }
+    return i;
+}
+
+__attribute__((target("avx512f")))
+static size_t solve_family_avx512(const quadratic_family_t *family, const double *c, size_t n,
+                                  double *x1, double *x2, int8_t *number, uint8_t *invalid, bool *has_invalid) {
+    const __m512d epsilon   = _mm512_set1_pd(EPSILON);
+    const __m512d infinity  = _mm512_set1_pd(HUGE_VAL);
+    const __m512d squared_b = _mm512_set1_pd(family->squared_b);
+    const __m512d four_a    = _mm512_set1_pd(family->four_a);
+    const __m512d minus_b   = _mm512_set1_pd(family->minus_b);
+    const __m512d two_a     = _mm512_set1_pd(family->two_a);
+    const __m512d vertex    = _mm512_set1_pd(family->vertex);
+
+    size_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        __m512d vc = _mm512_loadu_pd(c + i);
+        __mmask8 finite = _mm512_cmp_pd_mask(_mm512_abs_pd(vc), infinity, _CMP_LT_OQ);
+
+        __m512d discriminant = _mm512_sub_pd(squared_b, _mm512_mul_pd(four_a, vc));
+        __mmask8 d_equals    = _mm512_cmp_pd_mask(_mm512_abs_pd(discriminant), epsilon, _CMP_LT_OQ);
+        __mmask8 d_bigger    = (__mmask8)(~d_equals & _mm512_cmp_pd_mask(discriminant, _mm512_setzero_pd(), _CMP_GT_OQ));
+
+        __m512d root = _mm512_maskz_sqrt_pd((__mmask8)0xFF, discriminant);
+        __m512d q0   = _mm512_maskz_mov_pd(d_equals, vertex);
+
+        __m512d res_x1 = _mm512_mask_blend_pd(d_bigger, q0, _mm512_div_pd(_mm512_sub_pd(minus_b, root), two_a));
+        __m512d res_x2 = _mm512_mask_blend_pd(d_bigger, q0, _mm512_div_pd(_mm512_add_pd(minus_b, root), two_a));
+        __m512i res_n  = _mm512_mask_blend_epi64(d_bigger,
+                                                 _mm512_maskz_mov_epi64(d_equals, _mm512_set1_epi64(ONE_ROOT)),
+                                                 _mm512_set1_epi64(TWO_ROOTS));
+
+        res_x1 = _mm512_add_pd(_mm512_maskz_mov_pd(finite, res_x1), _mm512_setzero_pd());
+        res_x2 = _mm512_add_pd(_mm512_maskz_mov_pd(finite, res_x2), _mm512_setzero_pd());
+        res_n  = _mm512_mask_blend_epi64(finite, _mm512_set1_epi64(NOT_SOLVED), res_n);
+
+        _mm512_storeu_pd(x1 + i, res_x1);
+        _mm512_storeu_pd(x2 + i, res_x2);
+
+        int64_t packed = _mm_cvtsi128_si64(_mm512_maskz_cvtepi64_epi8((__mmask8)0xFF, res_n));
+        memcpy(number + i, &packed, 8);
+
+        write_invalid_mask((unsigned)finite, 8, invalid == NULL ? NULL : invalid + i, has_invalid);
+    }
+    return i;
+}
+
+#endif
+
+simd_level_t detect_simd_level(void) {
+#ifdef QUADRATIC_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f"))
+        return SIMD_AVX512;
+    if(__builtin_cpu_supports("avx2"))
+        return SIMD_AVX2;
+    if(__builtin_cpu_supports("sse2"))
+        return SIMD_SSE2;
+#endif
+    return SIMD_NONE;
+}
+
+simd_level_t get_simd_level(void) {
+    return used_level;
+}
+
+simd_level_t set_simd_level(simd_level_t level) {
+    simd_level_t supported = detect_simd_level();
+    used_level = level < supported ? level : supported;
+    return used_level;
+}
+
+simd_kernel_t get_simd_kernel(simd_level_t level) {
+    switch(level) {
+#ifdef QUADRATIC_X86
+        case SIMD_SSE2: {
+            return solve_batch_sse2;
+        }
+        case SIMD_AVX2: {
+            return solve_batch_avx2;
+        }
+        case SIMD_AVX512: {
+            return solve_batch_avx512;
+        }
+#else
+        case SIMD_SSE2:
+        case SIMD_AVX2:
+        case SIMD_AVX512:
+#endif
+        case SIMD_NONE: {
+            return NULL;
+        }
+        default: {
+            return NULL;
+        }
+    }
+}
+
+simd_float_kernel_t get_simd_float_kernel(simd_level_t level) {
+    switch(level) {
+#ifdef QUADRATIC_X86
+        case SIMD_SSE2: {
+            return solve_batch_float_sse2;
+        }
+        case SIMD_AVX2: {
+            return solve_batch_float_avx2;
+        }
+        case SIMD_AVX512: {
+            return solve_batch_float_avx512;
+        }
+#else
+        case SIMD_SSE2:
+        case SIMD_AVX2:
+        case SIMD_AVX512:
+#endif
+        case SIMD_NONE: {
+            return NULL;
+        }
+        default: {
+            return NULL;
+        }
+    }
+}
+
+simd_classify_kernel_t get_simd_classify_kernel(simd_level_t level) {
+    switch(level) {
+#ifdef QUADRATIC_X86
+        case SIMD_SSE2: {
+            return classify_batch_sse2;
+        }
+        case SIMD_AVX2: {
+            return classify_batch_avx2;
+        }
+        case SIMD_AVX512: {
+            return classify_batch_avx512;
+        }
+#else
+        case SIMD_SSE2:
+        case SIMD_AVX2:
+        case SIMD_AVX512:
+#endif
+        case SIMD_NONE: {
+            return NULL;
+        }
+        default: {
+            return NULL;
+        }
+    }
+}
+
+simd_family_kernel_t get_simd_family_kernel(simd_level_t level) {
+    switch(level) {
+#ifdef QUADRATIC_X86
+        case SIMD_SSE2: {
+            return solve_family_sse2;
+        }
+        case SIMD_AVX2: {
+            return solve_family_avx2;
+        }
+        case SIMD_AVX512: {
+            return solve_family_avx512;
+        }
+#else
+        case SIMD_SSE2:
+        case SIMD_AVX2:
+        case SIMD_AVX512:
+#endif
+        case SIMD_NONE: {
+            return NULL;
+        }
+        default: {
+            return NULL;
+        }
+    }
+}
+
+const char *simd_level_name(simd_level_t level) {
+    switch(level) {
+        case SIMD_NONE: {
+            return "none";
+        }
+        case SIMD_SSE2: {
+            return "sse2";
+        }
+        case SIMD_AVX2: {
+            return "avx2";
+        }
+        case SIMD_AVX512: {
+            return "avx512";
+        }
+        default: {
+            return "unknown";
+        }
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Writes mask of invalid equations from bits of finite lanes.
+
+    @param   [in]  finite_bits        Bit i is set if lane i has finite coefficients.
+    @param   [in]  lanes              Number of lanes.
+    @param   [out] invalid            Mask to write (can be NULL).
+    @param   [out] has_invalid        Set to true if one of lanes is invalid.
+
+===============================================================================================================================
+*/
+void write_invalid_mask(unsigned finite_bits, size_t lanes, uint8_t *invalid, bool *has_invalid) {
+    unsigned all_lanes = (1u << lanes) - 1;
+    if(finite_bits != all_lanes)
+        *has_invalid = true;
+
+    if(invalid == NULL)
+        return ;
+
+    for(size_t lane = 0; lane < lanes; lane++)
+        invalid[lane] = (uint8_t)(((finite_bits >> lane) & 1u) ^ 1u);
+}
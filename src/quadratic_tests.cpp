@@ -11,11 +11,22 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
 #include "quadratic_tests.h"
+#include "quadratic_batch.h"
+#include "quadratic_dedup.h"
+#include "quadratic_simd.h"
+#include "mapped_file.h"
+#include "qbin.h"
+#include "thread_pool.h"
 #include "quadratic.h"
+#include "quadratic_generic.h"
+#include "golden_tests.h"
 #include "utils.h"
 #include "colors.h"
 #include "custom_assert.h"
+#include "solve_stats.h"
 
 /**
 ===============================================================================================================================
@@ -25,6 +36,54 @@
 */
 static const int MAX_ROOTS_NUMBER_LENGTH = 32;
 
+/**
+===============================================================================================================================
+    @brief   - Number of random equations that are added to equations from file in test_batch_solving(...).
+
+===============================================================================================================================
+*/
+static const size_t RANDOM_BATCH_TESTS_NUMBER = 1 << 16;
+
+/**
+===============================================================================================================================
+    @brief   - Columns of equations for batch tests.
+
+===============================================================================================================================
+*/
+struct batch_columns_t {
+    double *a, *b, *c;
+    size_t size;
+    size_t capacity;
+};
+
+/**
+===============================================================================================================================
+    @brief   - Float columns of equations and results for batch tests.
+
+===============================================================================================================================
+*/
+struct batch_float_columns_t {
+    float *a, *b, *c;
+    float *x1, *x2;
+    int8_t *number;
+};
+
+/**
+===============================================================================================================================
+    @brief   - Size of text, that is tested by one task of parallel test runner (chunk ends on the end of line).
+
+===============================================================================================================================
+*/
+static const size_t TEST_CHUNK_BYTES = 1 << 20;
+
+/**
+===============================================================================================================================
+    @brief   - Number of chunks per thread, that are tested before results are printed.
+
+===============================================================================================================================
+*/
+static const size_t TEST_CHUNKS_PER_THREAD = 4;
+
 enum test_result_t {
     OK,
     UNEXPECTED_SOLVING_ERROR,
@@ -33,28 +92,233 @@ enum test_result_t {
     TEST_FAILURE
 };
 
+/**
+===============================================================================================================================
+    @brief   - Result of one test, kept until it is printed.
+
+===============================================================================================================================
+*/
+struct test_record_t {
+    quadratic_equation_t expected;
+    quadratic_equation_t actual;
+    test_result_t result;
+};
+
+/**
+===============================================================================================================================
+    @brief   - Chunk of tests file, tested by one task of parallel test runner.
+
+    @details - stop_position is position after the last record that was read, stop_line is its line number
+               counting from the beginning of chunk.\n
+             - state is READING_END if all records of chunk were read.
+
+===============================================================================================================================
+*/
+struct test_chunk_t {
+    const char *begin;
+    const char *end;
+    test_record_t *records;
+    size_t size;
+    size_t capacity;
+    reading_state_t state;
+    const char *stop_position;
+    size_t stop_line;
+    bool memory_error;
+};
+
 static test_result_t run_test(const quadratic_equation_t *expected, quadratic_equation_t *actual);
+static reading_state_t read_test_record(text_reader_t *reader, quadratic_equation_t *expected);
 static void print_test_result(test_result_t test_result, const quadratic_equation_t *expected, const quadratic_equation_t *actual);
-static bool compare_roots(const quadratic_equation_t *first, const quadratic_equation_t *second);
 static void print_different_amount(const quadratic_equation_t *expected, const quadratic_equation_t *actual);
 static void print_different_roots(const quadratic_equation_t *expected, const quadratic_equation_t *actual);
 static void roots_number_to_string(char *out, roots_number_t number);
+static test_state_t test_solving_text(const mapped_file_t *tests, int *tests_number, int *errors_number, size_t *error_line);
+static test_state_t run_tests_serial(text_reader_t *reader, int *tests_number, int *errors_number, size_t *error_line);
+static size_t split_test_chunks(test_chunk_t *chunks, size_t chunks_number, const char *position, const char *end);
+static void run_test_chunks(size_t begin, size_t end, size_t worker, void *context);
+static void run_test_chunk(test_chunk_t *chunk);
+static test_state_t test_solving_qbin(int *tests_number, int *errors_number, const char *filename, size_t *error_line);
+static bool push_batch_equation(batch_columns_t *columns, double a, double b, double c);
+static void free_batch_columns(batch_columns_t *columns);
+static double random_coefficient(uint64_t *state);
+static size_t count_batch_mismatches(const batch_columns_t *columns, const double *x1, const double *x2, const int8_t *number);
+static bool make_batch_float_columns(const batch_columns_t *columns, batch_float_columns_t *float_columns);
+static void free_batch_float_columns(batch_float_columns_t *float_columns);
+static size_t count_batch_float_mismatches(const batch_float_columns_t *float_columns, size_t size);
+static void print_golden_number(FILE *output, double number);
+static const char *roots_number_name(roots_number_t number);
+
+#ifdef EMBED_GOLDEN_TESTS
+/**
+===============================================================================================================================
+    @brief   - Counts tests from golden_tests.h, that solver does not pass, when it is evaluated by compiler.
+
+    @details - Roots are compared in the same way as in compare_roots().
 
-test_state_t test_solving_quadratic(int *tests_number, int *errors_number, const char *filename) {
+===============================================================================================================================
+*/
+static constexpr size_t count_failed_golden_tests(void) {
+    size_t failed = 0;
+
+    for(size_t test = 0; test < GOLDEN_TESTS_NUMBER; test++) {
+        const quadratic_equation_t *expected = &GOLDEN_TESTS[test];
+        quadratic_equation_t actual = solved_equation(expected->a, expected->b, expected->c);
+
+        bool same_roots = true;
+        if(expected->number == ONE_ROOT)
+            same_roots = is_zero_generic(expected->x1 - actual.x1);
+        if(expected->number == TWO_ROOTS)
+            same_roots = (is_zero_generic(expected->x1 - actual.x1) && is_zero_generic(expected->x2 - actual.x2)) ||
+                         (is_zero_generic(expected->x1 - actual.x2) && is_zero_generic(expected->x2 - actual.x1));
+
+        if(expected->number != actual.number || !same_roots)
+            failed++;
+    }
+
+    return failed;
+}
+
+static_assert(count_failed_golden_tests() == 0, "solver does not pass tests embedded in golden_tests.h");
+#endif
+
+test_state_t test_solving_quadratic(int *tests_number, int *errors_number, const char *filename, size_t *error_line) {
     C_ASSERT(tests_number  != NULL, TEST_ERROR);
     C_ASSERT(errors_number != NULL, TEST_ERROR);
     C_ASSERT(filename      != NULL, TEST_ERROR);
+    C_ASSERT(error_line    != NULL, TEST_ERROR);
 
     *errors_number = 0;
     *tests_number = 0;
+    *error_line = 0;
 
-    FILE *tests = fopen(filename, "r");
+    if(is_qbin_file(filename))
+        return test_solving_qbin(tests_number, errors_number, filename, error_line);
 
-    if(tests == NULL)
-        return NO_SUCH_FILE;
+    mapped_file_t tests = {};
+    switch(map_file(filename, &tests)) {
+        case MAPPING_SUCCESS: {
+            break;
+        }
+        case MAPPING_NO_FILE: {
+            return NO_SUCH_FILE;
+        }
+        case MAPPING_ERROR: {
+            return TEST_ERROR;
+        }
+        default: {
+            return TEST_ERROR;
+        }
+    }
+
+    test_state_t state = test_solving_text(&tests, tests_number, errors_number, error_line);
+
+    unmap_file(&tests);
+    return state;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Runs tests from text file mapped to memory.
+
+    @details - Text is split into chunks, that end on the ends of lines.\n
+             - Windows of chunks are read and tested in parallel, every chunk keeps results of its tests.\n
+             - Then results are printed in the order of file, so output is the same as output of serial runner.\n
+             - If chunk could not be read to its end (invalid line or record that continues in the next chunk),
+               the rest of file is tested by run_tests_serial(...) starting from the last record that was read,
+               so totals and number of invalid line are the same as in serial runner.
+
+    @param   [in]  tests              Mapped tests file.
+    @param   [out] tests_number       Pointer to total number of tests.
+    @param   [out] errors_number      Pointer to total number of errors.
+    @param   [out] error_line         Pointer to number of invalid line.
+
+    @return  Error (or success) code.
+
+===============================================================================================================================
+*/
+test_state_t test_solving_text(const mapped_file_t *tests, int *tests_number, int *errors_number, size_t *error_line) {
+    C_ASSERT(tests         != NULL, TEST_ERROR);
+    C_ASSERT(tests_number  != NULL, TEST_ERROR);
+    C_ASSERT(errors_number != NULL, TEST_ERROR);
+    C_ASSERT(error_line    != NULL, TEST_ERROR);
+
+    size_t chunks_number = get_threads_number() * TEST_CHUNKS_PER_THREAD;
+    test_chunk_t *chunks = (test_chunk_t *)calloc(chunks_number, sizeof(test_chunk_t));
+    if(chunks == NULL)
+        return TEST_ERROR;
+
+    const char *position = tests->data;
+    const char *end      = tests->data + tests->size;
+    size_t line          = 1;
+    test_state_t state   = SUCCESS_TEST;
+    bool stopped         = false;
+
+    while(position != end && !stopped) {
+        size_t window = split_test_chunks(chunks, chunks_number, position, end);
+        parallel_for(window, 1, run_test_chunks, chunks);
+
+        for(size_t index = 0; index < window; index++) {
+            test_chunk_t *chunk = &chunks[index];
+            if(chunk->memory_error) {
+                state = TEST_ERROR;
+                stopped = true;
+                break;
+            }
+
+            for(size_t record = 0; record < chunk->size; record++) {
+                if(chunk->records[record].result != OK)
+                    *errors_number += 1;
+
+                print_test_result(chunk->records[record].result,
+                                  &chunk->records[record].expected,
+                                  &chunk->records[record].actual);
+                *tests_number += 1;
+            }
+
+            if(chunk->state != READING_END) {
+                text_reader_t reader = {};
+                init_text_reader(&reader, chunk->stop_position, (size_t)(end - chunk->stop_position));
+                reader.line = line + chunk->stop_line - 1;
+
+                state = run_tests_serial(&reader, tests_number, errors_number, error_line);
+                stopped = true;
+                break;
+            }
+
+            line += chunk->stop_line - 1;
+        }
+
+        position = chunks[window - 1].end;
+    }
+
+    for(size_t index = 0; index < chunks_number; index++)
+        free(chunks[index].records);
+    free(chunks);
+
+    return state;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Reads, runs and prints tests one by one until the end of text.
+
+    @param   [in]  reader             Pointer to reader of tests text.
+    @param   [out] tests_number       Pointer to total number of tests (is increased).
+    @param   [out] errors_number      Pointer to total number of errors (is increased).
+    @param   [out] error_line         Pointer to number of invalid line.
+
+    @return  INVALID_LINES or SUCCESS_TEST.
+
+===============================================================================================================================
+*/
+test_state_t run_tests_serial(text_reader_t *reader, int *tests_number, int *errors_number, size_t *error_line) {
+    C_ASSERT(reader        != NULL, TEST_ERROR);
+    C_ASSERT(tests_number  != NULL, TEST_ERROR);
+    C_ASSERT(errors_number != NULL, TEST_ERROR);
+    C_ASSERT(error_line    != NULL, TEST_ERROR);
 
     quadratic_equation_t expected = {};
-    reading_state_t reading_state = read_expected_line(tests, &expected);
+    reading_state_t reading_state = read_test_record(reader, &expected);
 
     while(reading_state == READING_SUCCESS) {
         quadratic_equation_t actual = {};
@@ -64,13 +328,412 @@ test_state_t test_solving_quadratic(int *tests_number, int *errors_number, const
             *errors_number += 1;
 
         print_test_result(test_result, &expected, &actual);
-        reading_state = read_expected_line(tests, &expected);
+        reading_state = read_test_record(reader, &expected);
+        *tests_number += 1;
+    }
+
+    if(reading_state == READING_ERROR) {
+        *error_line = reader->error_line;
+        return INVALID_LINES;
+    }
+
+    return SUCCESS_TEST;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Splits text starting from position to chunks, that end on the ends of lines.
+
+    @param   [out] chunks             Array of chunks.
+    @param   [in]  chunks_number      Size of array.
+    @param   [in]  position           Beginning of text.
+    @param   [in]  end                End of text.
+
+    @return  Number of chunks (at least one if text is not empty).
+
+===============================================================================================================================
+*/
+size_t split_test_chunks(test_chunk_t *chunks, size_t chunks_number, const char *position, const char *end) {
+    C_ASSERT(chunks   != NULL, 0);
+    C_ASSERT(position != NULL, 0);
+    C_ASSERT(end      != NULL, 0);
+
+    size_t window = 0;
+    while(window < chunks_number && position != end) {
+        const char *chunk_end = end;
+        if((size_t)(end - position) > TEST_CHUNK_BYTES) {
+            const char *new_line = (const char *)memchr(position + TEST_CHUNK_BYTES, '\n',
+                                                        (size_t)(end - position) - TEST_CHUNK_BYTES);
+            if(new_line != NULL)
+                chunk_end = new_line + 1;
+        }
+
+        chunks[window].begin = position;
+        chunks[window].end   = chunk_end;
+        position = chunk_end;
+        window++;
+    }
+    return window;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Task of thread pool, tests chunks [begin, end).
+
+    @param   [in]  context            Array of chunks.
+
+===============================================================================================================================
+*/
+void run_test_chunks(size_t begin, size_t end, size_t worker, void *context) {
+    C_ASSERT(context != NULL, );
+    (void)worker;
+
+    test_chunk_t *chunks = (test_chunk_t *)context;
+    for(size_t index = begin; index < end; index++)
+        run_test_chunk(&chunks[index]);
+
+    flush_solve_stats();
+}
+
+/**
+===============================================================================================================================
+    @brief   - Reads and runs tests of one chunk and keeps their results.
+
+    @details - Reading stops on the first record that could not be read,
+               the rest of file is then tested by run_tests_serial(...).
+
+    @param   [out] chunk              Pointer to chunk.
+
+===============================================================================================================================
+*/
+void run_test_chunk(test_chunk_t *chunk) {
+    C_ASSERT(chunk != NULL, );
+
+    text_reader_t reader = {};
+    init_text_reader(&reader, chunk->begin, (size_t)(chunk->end - chunk->begin));
+
+    chunk->size          = 0;
+    chunk->memory_error  = false;
+    chunk->stop_position = chunk->begin;
+    chunk->stop_line     = 1;
+
+    quadratic_equation_t expected = {};
+    chunk->state = read_test_record(&reader, &expected);
+
+    while(chunk->state == READING_SUCCESS) {
+        if(chunk->size == chunk->capacity) {
+            size_t capacity = chunk->capacity == 0 ? 1024 : chunk->capacity * 2;
+            test_record_t *records = (test_record_t *)realloc(chunk->records, capacity * sizeof(test_record_t));
+            if(records == NULL) {
+                chunk->memory_error = true;
+                return ;
+            }
+            chunk->records  = records;
+            chunk->capacity = capacity;
+        }
+
+        test_record_t *record = &chunk->records[chunk->size++];
+        record->expected = expected;
+        record->actual   = {};
+        record->result   = run_test(&record->expected, &record->actual);
+
+        chunk->stop_position = reader.position;
+        chunk->stop_line     = reader.line;
+        chunk->state = read_test_record(&reader, &expected);
+    }
+
+    if(chunk->state == READING_END) {
+        chunk->stop_position = reader.position;
+        chunk->stop_line     = reader.line;
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Runs tests from .qbin file with results.
+
+    @details - Coefficients columns of mapped file are solved with solve_quadratic_batch_parallel() without copying.\n
+             - Results are checked and printed in the same way as in test_solving_quadratic(...).\n
+             - Row with NOT_SOLVED expected roots number is invalid, its number (counting from 1) is put to error_line.
+
+===============================================================================================================================
+*/
+test_state_t test_solving_qbin(int *tests_number, int *errors_number, const char *filename, size_t *error_line) {
+    qbin_view_t view = {};
+    switch(open_qbin(filename, &view, true)) {
+        case QBIN_SUCCESS: {
+            break;
+        }
+        case QBIN_NO_FILE: {
+            return NO_SUCH_FILE;
+        }
+        case QBIN_INVALID_FILE:
+        case QBIN_WRONG_ENDIANNESS:
+        case QBIN_CHECKSUM_ERROR:
+        case QBIN_WRITING_ERROR:
+        case QBIN_MEMORY_ERROR: {
+            return INVALID_LINES;
+        }
+        default: {
+            return TEST_ERROR;
+        }
+    }
+
+    if(view.number == NULL) {
+        close_qbin(&view);
+        return INVALID_LINES;
+    }
+
+    double *x1     = (double *)calloc(view.count + 1, sizeof(double));
+    double *x2     = (double *)calloc(view.count + 1, sizeof(double));
+    int8_t *number = (int8_t *)calloc(view.count + 1, sizeof(int8_t));
+    if(x1 == NULL || x2 == NULL || number == NULL) {
+        free(x1);
+        free(x2);
+        free(number);
+        close_qbin(&view);
+        return TEST_ERROR;
+    }
+
+    if(is_batch_dedup())
+        solve_quadratic_batch_dedup(view.a, view.b, view.c, view.count, x1, x2, number, NULL);
+    else
+        solve_quadratic_batch_parallel(view.a, view.b, view.c, view.count, x1, x2, number, NULL);
+
+    test_state_t state = SUCCESS_TEST;
+    for(size_t i = 0; i < view.count; i++) {
+        if(view.number[i] == NOT_SOLVED) {
+            *error_line = i + 1;
+            state = INVALID_LINES;
+            break;
+        }
+
+        quadratic_equation_t expected = {.a = view.a[i], .b = view.b[i], .c = view.c[i],
+                                         .x1 = view.x1[i], .x2 = view.x2[i], .number = (roots_number_t)view.number[i]};
+        quadratic_equation_t actual   = {.a = view.a[i], .b = view.b[i], .c = view.c[i],
+                                         .x1 = x1[i], .x2 = x2[i], .number = (roots_number_t)number[i]};
+
+        test_result_t test_result = OK;
+        if(actual.number == NOT_SOLVED)
+            test_result = UNEXPECTED_SOLVING_ERROR;
+        else if(expected.number != actual.number)
+            test_result = DIFFERENT_AMOUNT_OF_ROOTS;
+        else if(compare_roots(&expected, &actual) != true)
+            test_result = DIFFERENT_ROOTS;
+
+        if(test_result != OK)
+            *errors_number += 1;
+
+        print_test_result(test_result, &expected, &actual);
+        *tests_number += 1;
+    }
+
+    free(x1);
+    free(x2);
+    free(number);
+    close_qbin(&view);
+    return state;
+}
+
+test_state_t test_batch_solving(int *tests_number, int *errors_number, const char *filename) {
+    C_ASSERT(tests_number  != NULL, TEST_ERROR);
+    C_ASSERT(errors_number != NULL, TEST_ERROR);
+    C_ASSERT(filename      != NULL, TEST_ERROR);
+
+    *errors_number = 0;
+    *tests_number = 0;
+
+    mapped_file_t tests = {};
+    mapping_state_t mapping_state = map_file(filename, &tests);
+    if(mapping_state == MAPPING_NO_FILE)
+        return NO_SUCH_FILE;
+    if(mapping_state != MAPPING_SUCCESS)
+        return TEST_ERROR;
+
+    text_reader_t reader = {};
+    init_text_reader(&reader, tests.data, tests.size);
+
+    batch_columns_t columns = {};
+    quadratic_equation_t expected = {};
+    reading_state_t reading_state = read_expected_text(&reader, &expected);
+    while(reading_state == READING_SUCCESS) {
+        if(!push_batch_equation(&columns, expected.a, expected.b, expected.c)) {
+            unmap_file(&tests);
+            free_batch_columns(&columns);
+            return TEST_ERROR;
+        }
+        reading_state = read_expected_text(&reader, &expected);
+    }
+    unmap_file(&tests);
+
+    if(reading_state == READING_ERROR) {
+        free_batch_columns(&columns);
+        return INVALID_LINES;
+    }
+
+    uint64_t random_state = 0x9E3779B97F4A7C15ULL;
+    for(size_t i = 0; i < RANDOM_BATCH_TESTS_NUMBER; i++) {
+        double a = random_coefficient(&random_state);
+        double b = random_coefficient(&random_state);
+        double c = random_coefficient(&random_state);
+        if(!push_batch_equation(&columns, a, b, c)) {
+            free_batch_columns(&columns);
+            return TEST_ERROR;
+        }
+    }
+
+    double *x1     = (double *)calloc(columns.size, sizeof(double));
+    double *x2     = (double *)calloc(columns.size, sizeof(double));
+    int8_t *number = (int8_t *)calloc(columns.size, sizeof(int8_t));
+    batch_float_columns_t float_columns = {};
+    if(x1 == NULL || x2 == NULL || number == NULL || !make_batch_float_columns(&columns, &float_columns)) {
+        free(x1);
+        free(x2);
+        free(number);
+        free_batch_float_columns(&float_columns);
+        free_batch_columns(&columns);
+        return TEST_ERROR;
+    }
+
+    simd_level_t used_level = get_simd_level();
+    simd_level_t supported  = detect_simd_level();
+    for(int level = SIMD_NONE; level <= (int)supported; level++) {
+        set_simd_level((simd_level_t)level);
+        solve_quadratic_batch(columns.a, columns.b, columns.c, columns.size, x1, x2, number, NULL);
+
+        size_t mismatches = count_batch_mismatches(&columns, x1, x2, number);
+        *tests_number  += (int)columns.size;
+        *errors_number += (int)mismatches;
+
+        color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, "Kernel ");
+        color_printf(YELLOW_TEXT, false, DEFAULT_BACKGROUND, "%s", simd_level_name((simd_level_t)level));
+        color_printf(mismatches == 0 ? GREEN_TEXT : RED_TEXT, false, DEFAULT_BACKGROUND,
+                     ": %zu equations, %zu differ from solve_quadratic()\n", columns.size, mismatches);
+
+        solve_quadratic_batch_float(float_columns.a, float_columns.b, float_columns.c, columns.size,
+                                    float_columns.x1, float_columns.x2, float_columns.number, NULL);
+
+        mismatches = count_batch_float_mismatches(&float_columns, columns.size);
+        *tests_number  += (int)columns.size;
+        *errors_number += (int)mismatches;
+
+        color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, "Float kernel ");
+        color_printf(YELLOW_TEXT, false, DEFAULT_BACKGROUND, "%s", simd_level_name((simd_level_t)level));
+        color_printf(mismatches == 0 ? GREEN_TEXT : RED_TEXT, false, DEFAULT_BACKGROUND,
+                     ": %zu equations, %zu differ from solve_quadratic_roots_generic<float>()\n", columns.size, mismatches);
+    }
+    set_simd_level(used_level);
+
+    free(x1);
+    free(x2);
+    free(number);
+    free_batch_float_columns(&float_columns);
+    free_batch_columns(&columns);
+    return SUCCESS_TEST;
+}
+
+test_state_t embed_golden_tests(const char *filename, FILE *output, size_t *tests_number, size_t *error_line) {
+    C_ASSERT(filename     != NULL, TEST_ERROR);
+    C_ASSERT(output       != NULL, TEST_ERROR);
+    C_ASSERT(tests_number != NULL, TEST_ERROR);
+    C_ASSERT(error_line   != NULL, TEST_ERROR);
+
+    *tests_number = 0;
+    *error_line = 0;
+
+    mapped_file_t tests = {};
+    switch(map_file(filename, &tests)) {
+        case MAPPING_SUCCESS: {
+            break;
+        }
+        case MAPPING_NO_FILE: {
+            return NO_SUCH_FILE;
+        }
+        case MAPPING_ERROR: {
+            return TEST_ERROR;
+        }
+        default: {
+            return TEST_ERROR;
+        }
+    }
+
+    fprintf(output,
+            "/**\n"
+            "===============================================================================================================================\n"
+            "    @file    golden_tests.h\n"
+            "    @brief   Tests from \"%s\" as constant table.\n"
+            "\n"
+            "    @details - File is generated with '--embed-tests', do not edit it.\n"
+            "             - Numbers are written in hexadecimal form, so they are the same as numbers read from tests file.\n"
+            "\n"
+            "===============================================================================================================================\n"
+            "*/\n"
+            "\n"
+            "#ifndef GOLDEN_TESTS_H\n"
+            "#define GOLDEN_TESTS_H\n"
+            "\n"
+            "#include <stddef.h>\n"
+            "#include \"quadratic.h\"\n"
+            "\n"
+            "static constexpr quadratic_equation_t GOLDEN_TESTS[] = {\n", filename);
+
+    text_reader_t reader = {};
+    init_text_reader(&reader, tests.data, tests.size);
+
+    quadratic_equation_t expected = {};
+    reading_state_t reading_state = read_expected_text(&reader, &expected);
+
+    while(reading_state == READING_SUCCESS) {
+        fprintf(output, "    {");
+        print_golden_number(output, expected.a);
+        print_golden_number(output, expected.b);
+        print_golden_number(output, expected.c);
+        print_golden_number(output, expected.x1);
+        print_golden_number(output, expected.x2);
+        fprintf(output, "%s},\n", roots_number_name(expected.number));
+
+        reading_state = read_expected_text(&reader, &expected);
         *tests_number += 1;
     }
 
-    if(reading_state == READING_ERROR)
+    unmap_file(&tests);
+
+    if(reading_state == READING_ERROR) {
+        *error_line = reader.error_line;
+        return INVALID_LINES;
+    }
+
+    //empty table can not be compiled
+    if(*tests_number == 0)
         return INVALID_LINES;
 
+    fprintf(output,
+            "};\n"
+            "\n"
+            "static const size_t GOLDEN_TESTS_NUMBER = sizeof(GOLDEN_TESTS) / sizeof(GOLDEN_TESTS[0]);\n"
+            "\n"
+            "#endif\n");
+    return SUCCESS_TEST;
+}
+
+test_state_t test_golden_solving(int *tests_number, int *errors_number) {
+    C_ASSERT(tests_number  != NULL, TEST_ERROR);
+    C_ASSERT(errors_number != NULL, TEST_ERROR);
+
+    *tests_number = 0;
+    *errors_number = 0;
+
+    for(size_t test = 0; test < GOLDEN_TESTS_NUMBER; test++) {
+        quadratic_equation_t actual = {};
+        test_result_t test_result = run_test(&GOLDEN_TESTS[test], &actual);
+
+        if(test_result != OK) {
+            *errors_number += 1;
+            print_test_result(test_result, &GOLDEN_TESTS[test], &actual);
+        }
+        *tests_number += 1;
+    }
+
     return SUCCESS_TEST;
 }
 
@@ -108,16 +771,45 @@ test_result_t run_test(const quadratic_equation_t *expected, quadratic_equation_
     actual->b      = expected->b;
     actual->c      = expected->c;
 
-    if(solve_quadratic(actual) != SOLVING_SUCCESS)
+    uint64_t start = start_stats_stage();
+    solving_state_t solving_state = solve_quadratic(actual);
+    finish_stats_stage(STATS_STAGE_SOLVE, start);
+    count_solving_result(solving_state, actual->number);
+
+    if(solving_state != SOLVING_SUCCESS)
         return UNEXPECTED_SOLVING_ERROR;
 
+    start = start_stats_stage();
+    test_result_t test_result = OK;
     if(expected->number != actual->number)
-        return DIFFERENT_AMOUNT_OF_ROOTS;
+        test_result = DIFFERENT_AMOUNT_OF_ROOTS;
+    else if(compare_roots(expected, actual) != true)
+        test_result = DIFFERENT_ROOTS;
+    finish_stats_stage(STATS_STAGE_COMPARE, start);
 
-    if(compare_roots(expected, actual) != true)
-        return DIFFERENT_ROOTS;
+    return test_result;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Reads record of tests text with read_expected_text() and measures time of reading.
+
+    @param   [out] reader             Pointer to reader of tests text.
+    @param   [out] expected           Pointer to structure where record is put.
+
+    @return  Result of read_expected_text().
 
-    return OK;
+===============================================================================================================================
+*/
+reading_state_t read_test_record(text_reader_t *reader, quadratic_equation_t *expected) {
+    C_ASSERT(reader   != NULL, READING_ERROR);
+    C_ASSERT(expected != NULL, READING_ERROR);
+
+    uint64_t start = start_stats_stage();
+    reading_state_t reading_state = read_expected_text(reader, expected);
+    finish_stats_stage(STATS_STAGE_READ, start);
+
+    return reading_state;
 }
 
 /**
@@ -137,6 +829,7 @@ void print_test_result(test_result_t test_result,
     C_ASSERT(expected != NULL, );
     C_ASSERT(actual   != NULL, );
 
+    uint64_t start = start_stats_stage();
     color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, "For equation ");
     color_printf(YELLOW_TEXT, false, DEFAULT_BACKGROUND, "%lgx^2 + %lgx + %lg",
                  expected->a, expected->b, expected->c);
@@ -168,24 +861,10 @@ void print_test_result(test_result_t test_result,
         }
     }
     color_printf(DEFAULT_TEXT, false, DEFAULT_BACKGROUND, "------------------------\n");
+    color_flush();
+    finish_stats_stage(STATS_STAGE_OUTPUT, start);
 }
 
-/**
-===============================================================================================================================
-    @brief   - Compares roots depending on their amount.
-
-    @details - If amounts of roots are different roots are NOT the same.\n
-             - If there is zero or infinitely many roots they are the same.\n
-             - Checks only x1 if there is one root.\n
-             - Checks x1 and x2 if there is two roots.\n
-
-    @param   [in]  first              Pointer to first equation structure to be compared.
-    @param   [in]  second             Pointer to second equation structure to be compared.
-
-    @return  True if roots are the same and false if not.
-
-===============================================================================================================================
-*/
 bool compare_roots(const quadratic_equation_t *first, const quadratic_equation_t *second) {
     C_ASSERT(first  != NULL, false);
     C_ASSERT(second != NULL, false);
@@ -330,3 +1009,286 @@ void roots_number_to_string(char *out, roots_number_t number) {
         }
     }
 }
+
+/**
+===============================================================================================================================
+    @brief   - Adds equation to the end of columns, reallocating them if needed.
+
+    @param   [out] columns            Pointer to columns structure.
+    @param   [in]  a, b, c            Coefficients of equation.
+
+    @return  True if equation was added and false if memory could not be allocated.
+
+===============================================================================================================================
+*/
+bool push_batch_equation(batch_columns_t *columns, double a, double b, double c) {
+    C_ASSERT(columns != NULL, false);
+
+    if(columns->size == columns->capacity) {
+        size_t new_capacity = columns->capacity == 0 ? 1024 : columns->capacity * 2;
+        double *new_a = (double *)realloc(columns->a, new_capacity * sizeof(double));
+        if(new_a == NULL)
+            return false;
+        columns->a = new_a;
+        double *new_b = (double *)realloc(columns->b, new_capacity * sizeof(double));
+        if(new_b == NULL)
+            return false;
+        columns->b = new_b;
+        double *new_c = (double *)realloc(columns->c, new_capacity * sizeof(double));
+        if(new_c == NULL)
+            return false;
+        columns->c = new_c;
+        columns->capacity = new_capacity;
+    }
+
+    columns->a[columns->size] = a;
+    columns->b[columns->size] = b;
+    columns->c[columns->size] = c;
+    columns->size++;
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Frees memory of columns.
+
+    @param   [out] columns            Pointer to columns structure.
+
+===============================================================================================================================
+*/
+void free_batch_columns(batch_columns_t *columns) {
+    C_ASSERT(columns != NULL, );
+
+    free(columns->a);
+    free(columns->b);
+    free(columns->c);
+    memset(columns, 0, sizeof(batch_columns_t));
+}
+
+/**
+===============================================================================================================================
+    @brief   - Generates coefficient for batch tests.
+
+    @details - Uses xorshift64* generator.\n
+             - Coefficients are mixed from:\n
+                + Small integers (to get zero discriminants).\n
+                + Numbers near EPSILON (to check comparisons with zero).\n
+                + Ordinary numbers and huge numbers (to get overflows).\n
+                + Zeros, infinities and NAN.
+
+    @param   [out] state              State of generator.
+
+    @return  Coefficient.
+
+===============================================================================================================================
+*/
+double random_coefficient(uint64_t *state) {
+    C_ASSERT(state != NULL, 0);
+
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    uint64_t bits = *state * 0x2545F4914F6CDD1DULL;
+
+    double sign = (bits & 1) ? -1.0 : 1.0;
+    double unit = (double)(bits >> 11) / (double)(1ULL << 53);
+
+    switch((bits >> 1) % 10) {
+        case 0:
+        case 1:
+        case 2: {
+            return sign * (double)((bits >> 5) % 6);
+        }
+        case 3: {
+            //near tolerance of double or float solver
+            double tolerance = ((bits >> 5) & 1) ? EPSILON : (double)solving_tolerance<float>();
+            return sign * 2 * tolerance * unit;
+        }
+        case 4:
+        case 5:
+        case 6: {
+            return sign * 1000 * unit;
+        }
+        case 7: {
+            return sign * 1e200 * unit;
+        }
+        case 8: {
+            return sign * 0.0;
+        }
+        default: {
+            switch((bits >> 5) % 3) {
+                case 0:
+                    return sign * HUGE_VAL;
+                case 1:
+                    return NAN;
+                default:
+                    return sign * 1e-300 * unit;
+            }
+        }
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Counts equations for which batch results differ from solve_quadratic().
+
+    @details - Roots are compared bit by bit.\n
+             - Equations with invalid coefficients are expected to have NOT_SOLVED roots number and zero roots.
+
+    @param   [in]  columns            Coefficients of equations.
+    @param   [in]  x1, x2, number     Results of batch solver.
+
+    @return  Number of different results.
+
+===============================================================================================================================
+*/
+size_t count_batch_mismatches(const batch_columns_t *columns, const double *x1, const double *x2, const int8_t *number) {
+    C_ASSERT(columns != NULL, 0);
+    C_ASSERT(x1      != NULL, 0);
+    C_ASSERT(x2      != NULL, 0);
+    C_ASSERT(number  != NULL, 0);
+
+    size_t mismatches = 0;
+    for(size_t i = 0; i < columns->size; i++) {
+        quadratic_equation_t expected = {.a = columns->a[i], .b = columns->b[i], .c = columns->c[i],
+                                         .x1 = 0, .x2 = 0, .number = NOT_SOLVED};
+        if(solve_quadratic(&expected) != SOLVING_SUCCESS)
+            expected.number = NOT_SOLVED;
+
+        if(number[i] != (int8_t)expected.number ||
+           memcmp(&x1[i], &expected.x1, sizeof(double)) != 0 ||
+           memcmp(&x2[i], &expected.x2, sizeof(double)) != 0)
+            mismatches++;
+    }
+    return mismatches;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Makes float copies of columns and allocates float results.
+
+    @param   [in]  columns            Columns of equations.
+    @param   [out] float_columns      Float columns (must be freed with free_batch_float_columns()).
+
+    @return  True if memory was allocated and false if not.
+
+===============================================================================================================================
+*/
+bool make_batch_float_columns(const batch_columns_t *columns, batch_float_columns_t *float_columns) {
+    C_ASSERT(columns       != NULL, false);
+    C_ASSERT(float_columns != NULL, false);
+
+    float_columns->a      = (float *)calloc(columns->size + 1, sizeof(float));
+    float_columns->b      = (float *)calloc(columns->size + 1, sizeof(float));
+    float_columns->c      = (float *)calloc(columns->size + 1, sizeof(float));
+    float_columns->x1     = (float *)calloc(columns->size + 1, sizeof(float));
+    float_columns->x2     = (float *)calloc(columns->size + 1, sizeof(float));
+    float_columns->number = (int8_t *)calloc(columns->size + 1, sizeof(int8_t));
+    if(float_columns->a  == NULL || float_columns->b  == NULL || float_columns->c      == NULL ||
+       float_columns->x1 == NULL || float_columns->x2 == NULL || float_columns->number == NULL)
+        return false;
+
+    for(size_t i = 0; i < columns->size; i++) {
+        float_columns->a[i] = (float)columns->a[i];
+        float_columns->b[i] = (float)columns->b[i];
+        float_columns->c[i] = (float)columns->c[i];
+    }
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Frees memory of float columns.
+
+===============================================================================================================================
+*/
+void free_batch_float_columns(batch_float_columns_t *float_columns) {
+    C_ASSERT(float_columns != NULL, );
+
+    free(float_columns->a);
+    free(float_columns->b);
+    free(float_columns->c);
+    free(float_columns->x1);
+    free(float_columns->x2);
+    free(float_columns->number);
+    *float_columns = {};
+}
+
+/**
+===============================================================================================================================
+    @brief   - Counts float equations for which batch results differ from solve_quadratic_roots_generic<float>().
+
+    @details - Roots are compared bit by bit, roots of equations without roots must be 0.
+
+===============================================================================================================================
+*/
+size_t count_batch_float_mismatches(const batch_float_columns_t *float_columns, size_t size) {
+    C_ASSERT(float_columns != NULL, 0);
+
+    size_t mismatches = 0;
+    for(size_t i = 0; i < size; i++) {
+        float x1 = 0, x2 = 0;
+        roots_number_t number = NOT_SOLVED;
+        if(solve_quadratic_roots_generic<float>(float_columns->a[i], float_columns->b[i], float_columns->c[i],
+                                                &x1, &x2, &number) != SOLVING_SUCCESS)
+            number = NOT_SOLVED;
+
+        if(float_columns->number[i] != (int8_t)number ||
+           memcmp(&float_columns->x1[i], &x1, sizeof(float)) != 0 ||
+           memcmp(&float_columns->x2[i], &x2, sizeof(float)) != 0)
+            mismatches++;
+    }
+    return mismatches;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Prints number as C++ literal followed by comma.
+
+    @details - Finite numbers are printed in hexadecimal form, so they are read back exactly,
+               infinities and NAN are printed as GCC builtins, that can be used in constant expressions.
+
+    @param   [in]  output             File to print to.
+    @param   [in]  number             Number to print.
+
+===============================================================================================================================
+*/
+void print_golden_number(FILE *output, double number) {
+    C_ASSERT(output != NULL, );
+
+    if(isnan(number))
+        fprintf(output, "__builtin_nan(\"\"), ");
+    else if(isinf(number))
+        fprintf(output, "%s__builtin_inf(), ", number < 0 ? "-" : "");
+    else
+        fprintf(output, "%a, ", number);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns name of roots_number_t constant.
+
+===============================================================================================================================
+*/
+const char *roots_number_name(roots_number_t number) {
+    switch(number) {
+        case NOT_SOLVED: {
+            return "NOT_SOLVED";
+        }
+        case NO_ROOTS: {
+            return "NO_ROOTS";
+        }
+        case ONE_ROOT: {
+            return "ONE_ROOT";
+        }
+        case TWO_ROOTS: {
+            return "TWO_ROOTS";
+        }
+        case INF_ROOTS: {
+            return "INF_ROOTS";
+        }
+        default: {
+            return "NOT_SOLVED";
+        }
+    }
+}
@@ -0,0 +1,779 @@
+/**
+===============================================================================================================================
+    @file    shm_ring.cpp
+    @brief   Solving equations of processes on the same host through shared memory.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "shm_ring.h"
+#include "quadratic_batch.h"
+#include "custom_assert.h"
+
+#if defined(__linux__)
+#define QUADRATIC_FUTEX
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+#ifdef QUADRATIC_FUTEX
+/**
+===============================================================================================================================
+    @brief   - Marks shared memory object, that is created by this program and is ready.
+
+===============================================================================================================================
+*/
+static const uint32_t SHM_MAGIC = 0x51524E47;
+static const uint32_t SHM_VERSION = 1;
+
+/**
+===============================================================================================================================
+    @brief   - Maximum number of requests, that server solves together.
+
+===============================================================================================================================
+*/
+static const size_t SHM_BATCH_SIZE = 256;
+
+/**
+===============================================================================================================================
+    @brief   - Time of one futex wait, after it server checks signals and client checks if server is alive.
+
+===============================================================================================================================
+*/
+static const int SHM_SLEEP_MILLISECONDS = 100;
+
+static const size_t SHM_NAME_SIZE = 256;
+
+/**
+===============================================================================================================================
+    @brief   - Phases of slot, state of slot is (lap << SLOT_PHASE_BITS) | phase.
+
+    @details - Slot of request k is free for it if its state is (k / SHM_SLOTS_NUMBER << SLOT_PHASE_BITS) | SLOT_FREE.
+
+===============================================================================================================================
+*/
+enum slot_phase_t {
+    SLOT_FREE    = 0,
+    SLOT_WRITING = 1,
+    SLOT_REQUEST = 2,
+    SLOT_DONE    = 3
+};
+
+static const unsigned SLOT_PHASE_BITS = 2;
+
+enum slot_taking_t {
+    SLOT_TAKEN,
+    SLOT_SKIPPED,
+    SLOT_NO_SERVER
+};
+
+/**
+===============================================================================================================================
+    @brief   Beginning of shared memory object.
+
+    @details - tail is the next ticket.\n
+             - Client increments wake_sequence after it writes request and wakes server if server_sleeping is set.
+
+===============================================================================================================================
+*/
+struct shm_header_t {
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    uint32_t slots_number;
+    int32_t server_pid;
+    std::atomic<uint32_t> server_running;
+    alignas(64) std::atomic<uint64_t> tail;
+    alignas(64) std::atomic<uint32_t> wake_sequence;
+    std::atomic<uint32_t> server_sleeping;
+};
+
+/**
+===============================================================================================================================
+    @brief   Slot of ring, one cache line.
+
+    @details - owner is pid of client, that wrote request (0 if slot is free).\n
+             - Server wakes client after it writes roots if client_sleeping is set.
+
+===============================================================================================================================
+*/
+struct alignas(64) shm_slot_t {
+    std::atomic<uint32_t> state;
+    std::atomic<uint32_t> client_sleeping;
+    std::atomic<int32_t> owner;
+    int8_t number;
+    double a, b, c;
+    double x1, x2;
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free &&
+              std::atomic<int32_t>::is_always_lock_free, "shared memory needs address-free atomics");
+static_assert(sizeof(shm_slot_t) == 64, "slot must take one cache line");
+static_assert((SHM_SLOTS_NUMBER & (SHM_SLOTS_NUMBER - 1)) == 0, "SHM_SLOTS_NUMBER must be power of two");
+
+/**
+===============================================================================================================================
+    @brief   Requests, that server solves together.
+
+===============================================================================================================================
+*/
+struct shm_batch_t {
+    double a[SHM_BATCH_SIZE], b[SHM_BATCH_SIZE], c[SHM_BATCH_SIZE];
+    double x1[SHM_BATCH_SIZE], x2[SHM_BATCH_SIZE];
+    int8_t number[SHM_BATCH_SIZE];
+};
+
+/**
+===============================================================================================================================
+    @brief   State of server.
+
+    @details - head is ticket of the next request, that server waits for.
+
+===============================================================================================================================
+*/
+struct shm_server_t {
+    shm_header_t *header;
+    shm_slot_t *slots;
+    uint64_t head;
+    shm_batch_t *batch;
+    shm_server_stats_t *stats;
+};
+
+static bool make_shm_name(const char *name, char *shm_name);
+static size_t shm_region_size(void);
+static shm_slot_t *shm_slots(void *region);
+static uint32_t slot_state(uint64_t ticket, slot_phase_t phase);
+static void serve_shm(shm_server_t *server);
+static size_t collect_requests(shm_server_t *server);
+static void answer_requests(shm_server_t *server, size_t size);
+static bool reclaim_slot(shm_server_t *server);
+static void sleep_server(shm_server_t *server);
+static slot_taking_t take_slot(const shm_header_t *header, shm_slot_t *slot, uint64_t ticket, int pid);
+static bool wait_for_roots(shm_header_t *header, shm_slot_t *slot, uint64_t ticket);
+static bool is_server_alive(const shm_header_t *header);
+static bool is_process_alive(int pid);
+static void futex_wait(std::atomic<uint32_t> *word, uint32_t expected);
+static void futex_wake(std::atomic<uint32_t> *word);
+static void stop_shm_server(int signal_number);
+
+static volatile sig_atomic_t shm_server_stopped = 0;
+#endif
+
+static uint64_t now_nanoseconds(void);
+
+shm_state_t run_shm_server(const char *name, shm_server_stats_t *stats) {
+    C_ASSERT(name  != NULL, SHM_NAME_ERROR);
+    C_ASSERT(stats != NULL, SHM_NAME_ERROR);
+
+    *stats = {};
+
+#ifdef QUADRATIC_FUTEX
+    char shm_name[SHM_NAME_SIZE] = {};
+    if(!make_shm_name(name, shm_name))
+        return SHM_NAME_ERROR;
+
+    shm_unlink(shm_name);
+    int descriptor = shm_open(shm_name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if(descriptor < 0)
+        return SHM_MAPPING_ERROR;
+
+    size_t size = shm_region_size();
+    void *region = MAP_FAILED;
+    if(ftruncate(descriptor, (off_t)size) == 0)
+        region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    if(region == MAP_FAILED) {
+        shm_unlink(shm_name);
+        return SHM_MAPPING_ERROR;
+    }
+
+    shm_server_t server = {.header = (shm_header_t *)region, .slots = shm_slots(region), .head = 0,
+                           .batch = (shm_batch_t *)calloc(1, sizeof(shm_batch_t)), .stats = stats};
+    if(server.batch == NULL) {
+        munmap(region, size);
+        shm_unlink(shm_name);
+        return SHM_MEMORY_ERROR;
+    }
+
+    server.header->version = SHM_VERSION;
+    server.header->slots_number = (uint32_t)SHM_SLOTS_NUMBER;
+    server.header->server_pid = (int32_t)getpid();
+    server.header->server_running.store(1);
+    server.header->magic.store(SHM_MAGIC, std::memory_order_release);
+
+    struct sigaction action = {}, old_interrupt = {}, old_terminate = {};
+    action.sa_handler = stop_shm_server;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, &old_interrupt);
+    sigaction(SIGTERM, &action, &old_terminate);
+
+    shm_server_stopped = 0;
+    serve_shm(&server);
+
+    sigaction(SIGINT, &old_interrupt, NULL);
+    sigaction(SIGTERM, &old_terminate, NULL);
+
+    //waking clients, so they see that server stopped
+    server.header->server_running.store(0);
+    for(size_t slot = 0; slot < SHM_SLOTS_NUMBER; slot++) {
+        if(server.slots[slot].client_sleeping.load() != 0)
+            futex_wake(&server.slots[slot].state);
+    }
+
+    free(server.batch);
+    munmap(region, size);
+    shm_unlink(shm_name);
+    return SHM_SUCCESS;
+#else
+    return SHM_UNSUPPORTED;
+#endif
+}
+
+shm_state_t open_shm_client(const char *name, shm_client_t *client) {
+    C_ASSERT(name   != NULL, SHM_NAME_ERROR);
+    C_ASSERT(client != NULL, SHM_NAME_ERROR);
+
+    *client = {};
+
+#ifdef QUADRATIC_FUTEX
+    char shm_name[SHM_NAME_SIZE] = {};
+    if(!make_shm_name(name, shm_name))
+        return SHM_NAME_ERROR;
+
+    int descriptor = shm_open(shm_name, O_RDWR, 0);
+    if(descriptor < 0)
+        return SHM_NO_SERVER;
+
+    size_t size = shm_region_size();
+    struct stat object_stat = {};
+    void *region = MAP_FAILED;
+    if(fstat(descriptor, &object_stat) == 0 && (size_t)object_stat.st_size == size)
+        region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    if(region == MAP_FAILED)
+        return SHM_MAPPING_ERROR;
+
+    const shm_header_t *header = (const shm_header_t *)region;
+    if(header->magic.load(std::memory_order_acquire) != SHM_MAGIC || header->version != SHM_VERSION ||
+       header->slots_number != SHM_SLOTS_NUMBER || !is_server_alive(header)) {
+        munmap(region, size);
+        return SHM_NO_SERVER;
+    }
+
+    client->region = region;
+    client->size = size;
+    client->pid = (int)getpid();
+    return SHM_SUCCESS;
+#else
+    return SHM_UNSUPPORTED;
+#endif
+}
+
+void close_shm_client(shm_client_t *client) {
+    C_ASSERT(client != NULL, );
+
+#ifdef QUADRATIC_FUTEX
+    if(client->region != NULL)
+        munmap(client->region, client->size);
+#endif
+    *client = {};
+}
+
+shm_state_t solve_quadratic_shm(shm_client_t *client, double a, double b, double c,
+                                double *x1, double *x2, roots_number_t *number) {
+    C_ASSERT(client         != NULL, SHM_NO_SERVER);
+    C_ASSERT(client->region != NULL, SHM_NO_SERVER);
+    C_ASSERT(x1             != NULL, SHM_NO_SERVER);
+    C_ASSERT(x2             != NULL, SHM_NO_SERVER);
+    C_ASSERT(number         != NULL, SHM_NO_SERVER);
+
+#ifdef QUADRATIC_FUTEX
+    shm_header_t *header = (shm_header_t *)client->region;
+    shm_slot_t *slots = shm_slots(client->region);
+
+    while(true) {
+        uint64_t ticket = header->tail.fetch_add(1);
+        shm_slot_t *slot = &slots[ticket & (SHM_SLOTS_NUMBER - 1)];
+
+        switch(take_slot(header, slot, ticket, client->pid)) {
+            case SLOT_TAKEN: {
+                break;
+            }
+            case SLOT_SKIPPED: {
+                continue;
+            }
+            case SLOT_NO_SERVER: {
+                return SHM_NO_SERVER;
+            }
+            default: {
+                return SHM_NO_SERVER;
+            }
+        }
+
+        slot->a = a;
+        slot->b = b;
+        slot->c = c;
+
+        uint32_t writing = slot_state(ticket, SLOT_WRITING);
+        if(!slot->state.compare_exchange_strong(writing, slot_state(ticket, SLOT_REQUEST)))
+            continue;
+
+        header->wake_sequence.fetch_add(1);
+        if(header->server_sleeping.load() != 0)
+            futex_wake(&header->wake_sequence);
+
+        if(!wait_for_roots(header, slot, ticket))
+            return SHM_NO_SERVER;
+
+        *x1 = slot->x1;
+        *x2 = slot->x2;
+        *number = (roots_number_t)slot->number;
+
+        slot->owner.store(0, std::memory_order_relaxed);
+        slot->state.store(slot_state(ticket + SHM_SLOTS_NUMBER, SLOT_FREE), std::memory_order_release);
+        return SHM_SUCCESS;
+    }
+#else
+    (void)a;
+    (void)b;
+    (void)c;
+    return SHM_UNSUPPORTED;
+#endif
+}
+
+shm_state_t run_shm_ping(const char *name, size_t requests, shm_ping_stats_t *stats) {
+    C_ASSERT(name  != NULL, SHM_NAME_ERROR);
+    C_ASSERT(stats != NULL, SHM_NAME_ERROR);
+
+    *stats = {};
+
+    shm_client_t client = {};
+    shm_state_t state = open_shm_client(name, &client);
+    if(state != SHM_SUCCESS)
+        return state;
+
+    uint64_t start = now_nanoseconds();
+    for(size_t request = 0; request < requests; request++) {
+        double a = (double)(request % 32)       / 2.0 - 8.0;
+        double b = (double)(request / 32 % 32)  / 2.0 - 8.0;
+        double c = (double)(request / 1024 % 32) / 2.0 - 8.0;
+
+        double x1 = 0, x2 = 0;
+        roots_number_t number = NOT_SOLVED;
+        uint64_t sent = now_nanoseconds();
+        state = solve_quadratic_shm(&client, a, b, c, &x1, &x2, &number);
+        add_latency(&stats->latency, now_nanoseconds() - sent);
+        if(state != SHM_SUCCESS)
+            break;
+
+        double expected_x1 = 0, expected_x2 = 0;
+        int8_t expected_number = 0;
+        solve_quadratic_batch(&a, &b, &c, 1, &expected_x1, &expected_x2, &expected_number, NULL);
+        if(memcmp(&x1, &expected_x1, sizeof(double)) != 0 || memcmp(&x2, &expected_x2, sizeof(double)) != 0 ||
+           (int8_t)number != expected_number)
+            stats->mismatches++;
+        stats->requests++;
+    }
+    stats->seconds = (double)(now_nanoseconds() - start) / 1e9;
+
+    close_shm_client(&client);
+    return state;
+}
+
+#ifdef QUADRATIC_FUTEX
+/**
+===============================================================================================================================
+    @brief   - Makes POSIX name of shared memory object ('/' and name).
+
+    @return  False if name is empty, too long or has '/' not at the beginning.
+
+===============================================================================================================================
+*/
+bool make_shm_name(const char *name, char *shm_name) {
+    C_ASSERT(name     != NULL, false);
+    C_ASSERT(shm_name != NULL, false);
+
+    if(name[0] == '/')
+        name++;
+    if(name[0] == '\0' || strchr(name, '/') != NULL)
+        return false;
+
+    int printed = snprintf(shm_name, SHM_NAME_SIZE, "/%s", name);
+    return printed > 0 && (size_t)printed < SHM_NAME_SIZE;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns size of shared memory object (header and slots).
+
+===============================================================================================================================
+*/
+size_t shm_region_size(void) {
+    return sizeof(shm_header_t) + SHM_SLOTS_NUMBER * sizeof(shm_slot_t);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns slots of shared memory object, they are after header.
+
+===============================================================================================================================
+*/
+shm_slot_t *shm_slots(void *region) {
+    C_ASSERT(region != NULL, NULL);
+
+    return (shm_slot_t *)((char *)region + sizeof(shm_header_t));
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns state of slot of ticket in given phase.
+
+    @details - Lap is cut to 30 bits, it is enough to tell the current lap from the previous and the next ones.
+
+===============================================================================================================================
+*/
+uint32_t slot_state(uint64_t ticket, slot_phase_t phase) {
+    return (uint32_t)((ticket / SHM_SLOTS_NUMBER) << SLOT_PHASE_BITS) | (uint32_t)phase;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves requests in order of tickets until server is stopped.
+
+    @details - Requests, that are written, are solved together (up to SHM_BATCH_SIZE).\n
+             - If client took ticket, but does not write request for SHM_ABANDON_MILLISECONDS,
+               server checks slot with reclaim_slot().\n
+             - If there are no tickets, server polls SHM_SPINS times and then sleeps.
+
+===============================================================================================================================
+*/
+void serve_shm(shm_server_t *server) {
+    C_ASSERT(server != NULL, );
+
+    size_t spins = 0;
+    uint64_t stalled_since = 0;
+
+    while(!shm_server_stopped) {
+        size_t size = collect_requests(server);
+        if(size != 0) {
+            answer_requests(server, size);
+            spins = 0;
+            stalled_since = 0;
+            continue;
+        }
+
+        if(server->head != server->header->tail.load(std::memory_order_acquire)) {
+            uint64_t now = now_nanoseconds();
+            if(stalled_since == 0)
+                stalled_since = now;
+            else if(now - stalled_since > (uint64_t)SHM_ABANDON_MILLISECONDS * 1000000) {
+                if(reclaim_slot(server))
+                    server->stats->reclaimed++;
+                stalled_since = 0;
+            }
+
+            if(spins < SHM_SPINS)
+                spins++;
+            else
+                std::this_thread::yield();
+            continue;
+        }
+
+        stalled_since = 0;
+        if(spins < SHM_SPINS) {
+            spins++;
+            continue;
+        }
+
+        sleep_server(server);
+        spins = 0;
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Copies coefficients of written requests with consecutive tickets from head to batch.
+
+    @return  Number of requests.
+
+===============================================================================================================================
+*/
+size_t collect_requests(shm_server_t *server) {
+    C_ASSERT(server != NULL, 0);
+
+    shm_batch_t *batch = server->batch;
+    size_t size = 0;
+    for(; size < SHM_BATCH_SIZE; size++) {
+        uint64_t ticket = server->head + size;
+        const shm_slot_t *slot = &server->slots[ticket & (SHM_SLOTS_NUMBER - 1)];
+        if(slot->state.load(std::memory_order_acquire) != slot_state(ticket, SLOT_REQUEST))
+            break;
+
+        batch->a[size] = slot->a;
+        batch->b[size] = slot->b;
+        batch->c[size] = slot->c;
+    }
+
+    return size;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves batch, writes roots to slots and wakes clients, that sleep.
+
+===============================================================================================================================
+*/
+void answer_requests(shm_server_t *server, size_t size) {
+    C_ASSERT(server != NULL, );
+
+    shm_batch_t *batch = server->batch;
+    solve_quadratic_batch(batch->a, batch->b, batch->c, size, batch->x1, batch->x2, batch->number, NULL);
+
+    for(size_t request = 0; request < size; request++) {
+        uint64_t ticket = server->head + request;
+        shm_slot_t *slot = &server->slots[ticket & (SHM_SLOTS_NUMBER - 1)];
+
+        slot->x1 = batch->x1[request];
+        slot->x2 = batch->x2[request];
+        slot->number = batch->number[request];
+        slot->state.store(slot_state(ticket, SLOT_DONE));
+        if(slot->client_sleeping.load() != 0)
+            futex_wake(&slot->state);
+    }
+
+    server->head += size;
+
+    shm_server_stats_t *stats = server->stats;
+    stats->requests += size;
+    stats->batches++;
+    if(size > stats->max_batch)
+        stats->max_batch = size;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns slot of head ticket to ring if its client crashed.
+
+    @details - Slot is checked in three cases:\n
+                + Slot is free for head ticket: client of ticket crashed before writing, ticket is skipped.\n
+                + Slot is being written: ticket is skipped if owner is not alive.\n
+                + Slot is done on the previous lap: client of the previous lap crashed before it read roots,
+                  slot is made free for head ticket if owner is not alive.\n
+             - Slot is changed with compare and swap, so client that is alive after all gets SLOT_SKIPPED
+               and takes new ticket.
+
+    @return  True if slot was returned to ring.
+
+===============================================================================================================================
+*/
+bool reclaim_slot(shm_server_t *server) {
+    C_ASSERT(server != NULL, false);
+
+    uint64_t ticket = server->head;
+    shm_slot_t *slot = &server->slots[ticket & (SHM_SLOTS_NUMBER - 1)];
+    uint32_t state = slot->state.load();
+    int owner = (int)slot->owner.load();
+
+    if(state == slot_state(ticket, SLOT_FREE) ||
+       (state == slot_state(ticket, SLOT_WRITING) && (owner == 0 || !is_process_alive(owner)))) {
+        if(!slot->state.compare_exchange_strong(state, slot_state(ticket + SHM_SLOTS_NUMBER, SLOT_FREE)))
+            return false;
+
+        slot->owner.store(0);
+        server->head++;
+        return true;
+    }
+
+    if(ticket >= SHM_SLOTS_NUMBER && state == slot_state(ticket - SHM_SLOTS_NUMBER, SLOT_DONE) && !is_process_alive(owner)) {
+        slot->owner.store(0);
+        return slot->state.compare_exchange_strong(state, slot_state(ticket, SLOT_FREE));
+    }
+
+    return false;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Sleeps on futex until client writes request or SHM_SLEEP_MILLISECONDS pass.
+
+    @details - server_sleeping is set before tail is checked again, so client that took ticket
+               either is seen here or sees server_sleeping and wakes server.
+
+===============================================================================================================================
+*/
+void sleep_server(shm_server_t *server) {
+    C_ASSERT(server != NULL, );
+
+    shm_header_t *header = server->header;
+    uint32_t sequence = header->wake_sequence.load();
+    header->server_sleeping.store(1);
+
+    if(header->tail.load() == server->head) {
+        futex_wait(&header->wake_sequence, sequence);
+        server->stats->sleeps++;
+    }
+
+    header->server_sleeping.store(0);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Waits until slot is free for ticket and marks it as being written by client.
+
+    @return  SLOT_SKIPPED if server skipped ticket, SLOT_NO_SERVER if server stopped.
+
+===============================================================================================================================
+*/
+slot_taking_t take_slot(const shm_header_t *header, shm_slot_t *slot, uint64_t ticket, int pid) {
+    C_ASSERT(header != NULL, SLOT_NO_SERVER);
+    C_ASSERT(slot   != NULL, SLOT_NO_SERVER);
+
+    uint32_t skipped_lap = slot_state(ticket + SHM_SLOTS_NUMBER, SLOT_FREE) >> SLOT_PHASE_BITS;
+
+    for(size_t spins = 0; ; spins++) {
+        uint32_t state = slot->state.load(std::memory_order_acquire);
+        if(state == slot_state(ticket, SLOT_FREE)) {
+            if(slot->state.compare_exchange_weak(state, slot_state(ticket, SLOT_WRITING), std::memory_order_acquire)) {
+                slot->owner.store((int32_t)pid, std::memory_order_relaxed);
+                return SLOT_TAKEN;
+            }
+            continue;
+        }
+
+        if(state >> SLOT_PHASE_BITS == skipped_lap)
+            return SLOT_SKIPPED;
+
+        //ring is full, slot is used by the previous lap
+        if(spins >= SHM_SPINS) {
+            if(!is_server_alive(header))
+                return SLOT_NO_SERVER;
+            std::this_thread::yield();
+            spins = 0;
+        }
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Waits until server writes roots to slot, polls SHM_SPINS times and then sleeps on futex.
+
+    @return  False if server stopped.
+
+===============================================================================================================================
+*/
+bool wait_for_roots(shm_header_t *header, shm_slot_t *slot, uint64_t ticket) {
+    C_ASSERT(header != NULL, false);
+    C_ASSERT(slot   != NULL, false);
+
+    uint32_t request = slot_state(ticket, SLOT_REQUEST);
+    uint32_t done    = slot_state(ticket, SLOT_DONE);
+
+    for(size_t spins = 0; ; spins++) {
+        if(slot->state.load(std::memory_order_acquire) == done)
+            return true;
+
+        if(spins < SHM_SPINS)
+            continue;
+
+        slot->client_sleeping.store(1);
+        if(slot->state.load() == request)
+            futex_wait(&slot->state, request);
+        slot->client_sleeping.store(0);
+
+        if(slot->state.load(std::memory_order_acquire) == done)
+            return true;
+        if(!is_server_alive(header))
+            return false;
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Checks that server did not stop and its process exists.
+
+===============================================================================================================================
+*/
+bool is_server_alive(const shm_header_t *header) {
+    C_ASSERT(header != NULL, false);
+
+    return header->server_running.load() != 0 && is_process_alive((int)header->server_pid);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Checks that process exists.
+
+===============================================================================================================================
+*/
+bool is_process_alive(int pid) {
+    if(pid <= 0)
+        return false;
+
+    return kill(pid, 0) == 0 || errno == EPERM;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Sleeps while word is equal to expected, but not longer than SHM_SLEEP_MILLISECONDS.
+
+    @details - Futex is not private, because word is in memory shared between processes.
+
+===============================================================================================================================
+*/
+void futex_wait(std::atomic<uint32_t> *word, uint32_t expected) {
+    C_ASSERT(word != NULL, );
+
+    timespec timeout = {.tv_sec = SHM_SLEEP_MILLISECONDS / 1000, .tv_nsec = (long)(SHM_SLEEP_MILLISECONDS % 1000) * 1000000};
+    syscall(SYS_futex, (void *)word, FUTEX_WAIT, expected, &timeout, NULL, 0);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Wakes all processes, that sleep on word.
+
+===============================================================================================================================
+*/
+void futex_wake(std::atomic<uint32_t> *word) {
+    C_ASSERT(word != NULL, );
+
+    syscall(SYS_futex, (void *)word, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Handles SIGINT and SIGTERM.
+
+===============================================================================================================================
+*/
+void stop_shm_server(int signal_number) {
+    (void)signal_number;
+    shm_server_stopped = 1;
+}
+#endif
+
+/**
+===============================================================================================================================
+    @brief   - Returns time of monotonic clock in nanoseconds.
+
+===============================================================================================================================
+*/
+uint64_t now_nanoseconds(void) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now().time_since_epoch()).count();
+}
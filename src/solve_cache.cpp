@@ -0,0 +1,437 @@
+/**
+===============================================================================================================================
+    @file    solve_cache.cpp
+    @brief   Reusing roots of repeated equations.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include "solve_cache.h"
+#include "quadratic.h"
+#include "quadratic_precise.h"
+#include "custom_assert.h"
+
+/**
+===============================================================================================================================
+    @brief   - Index, that means absence of entry in lists and slots.
+
+===============================================================================================================================
+*/
+static const uint32_t NO_ENTRY = UINT32_MAX;
+
+/**
+===============================================================================================================================
+    @brief   Solved equation kept in cache.
+
+    @details - previous and next link entries in order of use, from the most recently used to the least one.
+
+===============================================================================================================================
+*/
+struct solve_cache_entry_t {
+    uint64_t key[3];
+    uint64_t hash;
+    double x1, x2;
+    roots_number_t number;
+    uint32_t previous;
+    uint32_t next;
+};
+
+/**
+===============================================================================================================================
+    @brief   Cache of one thread, counters are added to totals when thread exits.
+
+    @details - slots store indices of entries, number of slots is power of two, at least twice bigger than capacity,
+               so probe sequences stay short.\n
+             - capacity and precise are values of settings, that cache was built for.
+
+===============================================================================================================================
+*/
+struct solve_cache_t {
+    solve_cache_entry_t *entries;
+    uint32_t *slots;
+    size_t slots_mask;
+    size_t capacity;
+    size_t size;
+    uint32_t head;
+    uint32_t tail;
+    bool precise;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+
+    ~solve_cache_t();
+};
+
+static bool reset_cache(solve_cache_t *cache, size_t capacity, bool precise);
+static void free_cache(solve_cache_t *cache);
+static void flush_cache_stats(solve_cache_t *cache);
+static uint64_t hash_key(const uint64_t *key);
+static size_t find_slot(const solve_cache_t *cache, const uint64_t *key, uint64_t hash);
+static void remove_slot(solve_cache_t *cache, size_t slot);
+static void unlink_entry(solve_cache_t *cache, uint32_t index);
+static void push_front(solve_cache_t *cache, uint32_t index);
+static solving_state_t solve_uncached(double a, double b, double c, double *x1, double *x2, roots_number_t *number);
+
+static size_t cache_capacity = 0;
+
+static std::atomic<uint64_t> total_hits(0);
+static std::atomic<uint64_t> total_misses(0);
+static std::atomic<uint64_t> total_evictions(0);
+
+static thread_local solve_cache_t thread_cache = {};
+
+bool set_solve_cache_capacity(size_t capacity) {
+    if(capacity > MAX_SOLVE_CACHE_CAPACITY)
+        return false;
+
+    cache_capacity = capacity;
+    return true;
+}
+
+size_t get_solve_cache_capacity(void) {
+    return cache_capacity;
+}
+
+solving_state_t solve_quadratic_cached(double a, double b, double c, double *x1, double *x2, roots_number_t *number) {
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    bool precise = is_precise_solving();
+    if(thread_cache.capacity != cache_capacity || thread_cache.precise != precise) {
+        if(!reset_cache(&thread_cache, cache_capacity, precise))
+            return solve_uncached(a, b, c, x1, x2, number);
+    }
+    if(thread_cache.entries == NULL)
+        return solve_uncached(a, b, c, x1, x2, number);
+
+    uint64_t key[3] = {};
+    memcpy(&key[0], &a, sizeof(double));
+    memcpy(&key[1], &b, sizeof(double));
+    memcpy(&key[2], &c, sizeof(double));
+
+    uint64_t hash = hash_key(key);
+    size_t slot = find_slot(&thread_cache, key, hash);
+
+    if(thread_cache.slots[slot] != NO_ENTRY) {
+        uint32_t index = thread_cache.slots[slot];
+        solve_cache_entry_t *entry = &thread_cache.entries[index];
+
+        *number = entry->number;
+        if(entry->number == ONE_ROOT || entry->number == TWO_ROOTS) {
+            *x1 = entry->x1;
+            *x2 = entry->x2;
+        }
+
+        if(thread_cache.head != index) {
+            unlink_entry(&thread_cache, index);
+            push_front(&thread_cache, index);
+        }
+        thread_cache.hits++;
+        return SOLVING_SUCCESS;
+    }
+
+    thread_cache.misses++;
+
+    double root1 = 0, root2 = 0;
+    roots_number_t roots_number = NOT_SOLVED;
+    solving_state_t state = solve_uncached(a, b, c, &root1, &root2, &roots_number);
+    if(state != SOLVING_SUCCESS)
+        return state;
+
+    *number = roots_number;
+    if(roots_number == ONE_ROOT || roots_number == TWO_ROOTS) {
+        *x1 = root1;
+        *x2 = root2;
+    }
+
+    uint32_t index = 0;
+    if(thread_cache.size < thread_cache.capacity)
+        index = (uint32_t)thread_cache.size++;
+    else {
+        //the least recently used equation is replaced, removing it can move other slots
+        index = thread_cache.tail;
+        remove_slot(&thread_cache, find_slot(&thread_cache, thread_cache.entries[index].key, thread_cache.entries[index].hash));
+        unlink_entry(&thread_cache, index);
+        slot = find_slot(&thread_cache, key, hash);
+        thread_cache.evictions++;
+    }
+
+    solve_cache_entry_t *entry = &thread_cache.entries[index];
+    memcpy(entry->key, key, sizeof(key));
+    entry->hash   = hash;
+    entry->x1     = root1;
+    entry->x2     = root2;
+    entry->number = roots_number;
+
+    thread_cache.slots[slot] = index;
+    push_front(&thread_cache, index);
+    return SOLVING_SUCCESS;
+}
+
+solving_state_t solve_quadratic_batch_cached(const double *a, const double *b, const double *c, size_t n,
+                                             double *x1, double *x2, int8_t *number, uint8_t *invalid) {
+    C_ASSERT(a      != NULL, SOLVING_ERROR);
+    C_ASSERT(b      != NULL, SOLVING_ERROR);
+    C_ASSERT(c      != NULL, SOLVING_ERROR);
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    solving_state_t batch_state = SOLVING_SUCCESS;
+
+    for(size_t i = 0; i < n; i++) {
+        roots_number_t roots_number = NOT_SOLVED;
+        x1[i] = x2[i] = 0;
+
+        switch(solve_quadratic_cached(a[i], b[i], c[i], &x1[i], &x2[i], &roots_number)) {
+            case SOLVING_SUCCESS: {
+                if(invalid != NULL)
+                    invalid[i] = 0;
+                break;
+            }
+            case INVALID_COEFFICIENTS: {
+                if(invalid != NULL)
+                    invalid[i] = 1;
+                batch_state = INVALID_COEFFICIENTS;
+                break;
+            }
+            case SOLVING_ERROR: {
+                number[i] = (int8_t)NOT_SOLVED;
+                flush_cache_stats(&thread_cache);
+                return SOLVING_ERROR;
+            }
+            default: {
+                number[i] = (int8_t)NOT_SOLVED;
+                flush_cache_stats(&thread_cache);
+                return SOLVING_ERROR;
+            }
+        }
+        number[i] = (int8_t)roots_number;
+    }
+
+    flush_cache_stats(&thread_cache);
+    return batch_state;
+}
+
+void get_solve_cache_stats(solve_cache_stats_t *stats) {
+    C_ASSERT(stats != NULL, );
+
+    flush_cache_stats(&thread_cache);
+
+    stats->hits      = total_hits.load();
+    stats->misses    = total_misses.load();
+    stats->evictions = total_evictions.load();
+}
+
+solve_cache_t::~solve_cache_t() {
+    flush_cache_stats(this);
+    free_cache(this);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Frees cache and allocates empty cache for given settings.
+
+    @details - If memory could not be allocated, cache stays empty and equations are solved without it.
+
+    @param   [out] cache              Pointer to cache.
+    @param   [in]  capacity           Number of equations (0 means that cache is off).
+    @param   [in]  precise            Mode of solver, that results are computed with.
+
+    @return  False if memory could not be allocated.
+
+===============================================================================================================================
+*/
+bool reset_cache(solve_cache_t *cache, size_t capacity, bool precise) {
+    C_ASSERT(cache != NULL, false);
+
+    free_cache(cache);
+    cache->capacity = capacity;
+    cache->precise  = precise;
+    if(capacity == 0)
+        return true;
+
+    size_t slots_number = 1;
+    while(slots_number < 2 * capacity)
+        slots_number *= 2;
+
+    cache->entries = (solve_cache_entry_t *)calloc(capacity, sizeof(solve_cache_entry_t));
+    cache->slots   = (uint32_t *)malloc(slots_number * sizeof(uint32_t));
+    if(cache->entries == NULL || cache->slots == NULL) {
+        free_cache(cache);
+        return false;
+    }
+
+    memset(cache->slots, 0xFF, slots_number * sizeof(uint32_t));
+    cache->slots_mask = slots_number - 1;
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Frees memory of cache and makes it empty (settings and counters are not changed).
+
+===============================================================================================================================
+*/
+void free_cache(solve_cache_t *cache) {
+    C_ASSERT(cache != NULL, );
+
+    free(cache->entries);
+    free(cache->slots);
+    cache->entries    = NULL;
+    cache->slots      = NULL;
+    cache->slots_mask = 0;
+    cache->size       = 0;
+    cache->head       = NO_ENTRY;
+    cache->tail       = NO_ENTRY;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Adds counters of cache to totals and zeroes them.
+
+===============================================================================================================================
+*/
+void flush_cache_stats(solve_cache_t *cache) {
+    C_ASSERT(cache != NULL, );
+
+    if(cache->hits != 0)
+        total_hits.fetch_add(cache->hits, std::memory_order_relaxed);
+    if(cache->misses != 0)
+        total_misses.fetch_add(cache->misses, std::memory_order_relaxed);
+    if(cache->evictions != 0)
+        total_evictions.fetch_add(cache->evictions, std::memory_order_relaxed);
+
+    cache->hits = cache->misses = cache->evictions = 0;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Mixes bit patterns of coefficients into hash (multiplicative hashing).
+
+===============================================================================================================================
+*/
+uint64_t hash_key(const uint64_t *key) {
+    C_ASSERT(key != NULL, 0);
+
+    uint64_t hash = key[0];
+    hash = (hash ^ (hash >> 29) ^ key[1]) * 0x9E3779B97F4A7C15;
+    hash = (hash ^ (hash >> 32) ^ key[2]) * 0xBF58476D1CE4E5B9;
+    return hash ^ (hash >> 31);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns slot of equation with key or the first empty slot, where it can be put.
+
+===============================================================================================================================
+*/
+size_t find_slot(const solve_cache_t *cache, const uint64_t *key, uint64_t hash) {
+    C_ASSERT(cache != NULL, 0);
+    C_ASSERT(key   != NULL, 0);
+
+    size_t slot = (size_t)hash & cache->slots_mask;
+    while(cache->slots[slot] != NO_ENTRY) {
+        const solve_cache_entry_t *entry = &cache->entries[cache->slots[slot]];
+        if(entry->hash == hash && memcmp(entry->key, key, sizeof(entry->key)) == 0)
+            return slot;
+
+        slot = (slot + 1) & cache->slots_mask;
+    }
+    return slot;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Empties slot without tombstones.
+
+    @details - Following slots of probe sequence are moved back to the hole,
+               if hole is between their home slot and their position, so every entry stays reachable.
+
+===============================================================================================================================
+*/
+void remove_slot(solve_cache_t *cache, size_t slot) {
+    C_ASSERT(cache != NULL, );
+
+    size_t hole = slot;
+    size_t next = (slot + 1) & cache->slots_mask;
+
+    while(cache->slots[next] != NO_ENTRY) {
+        size_t home = (size_t)cache->entries[cache->slots[next]].hash & cache->slots_mask;
+
+        if(((next - home) & cache->slots_mask) >= ((next - hole) & cache->slots_mask)) {
+            cache->slots[hole] = cache->slots[next];
+            hole = next;
+        }
+        next = (next + 1) & cache->slots_mask;
+    }
+
+    cache->slots[hole] = NO_ENTRY;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Removes entry from list of use.
+
+===============================================================================================================================
+*/
+void unlink_entry(solve_cache_t *cache, uint32_t index) {
+    C_ASSERT(cache != NULL, );
+
+    solve_cache_entry_t *entry = &cache->entries[index];
+
+    if(entry->previous != NO_ENTRY)
+        cache->entries[entry->previous].next = entry->next;
+    else
+        cache->head = entry->next;
+
+    if(entry->next != NO_ENTRY)
+        cache->entries[entry->next].previous = entry->previous;
+    else
+        cache->tail = entry->previous;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Puts entry to the beginning of list of use (entry becomes the most recently used).
+
+===============================================================================================================================
+*/
+void push_front(solve_cache_t *cache, uint32_t index) {
+    C_ASSERT(cache != NULL, );
+
+    solve_cache_entry_t *entry = &cache->entries[index];
+    entry->previous = NO_ENTRY;
+    entry->next     = cache->head;
+
+    if(cache->head != NO_ENTRY)
+        cache->entries[cache->head].previous = index;
+    else
+        cache->tail = index;
+
+    cache->head = index;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves equation with solver of current mode.
+
+===============================================================================================================================
+*/
+solving_state_t solve_uncached(double a, double b, double c, double *x1, double *x2, roots_number_t *number) {
+    C_ASSERT(x1     != NULL, SOLVING_ERROR);
+    C_ASSERT(x2     != NULL, SOLVING_ERROR);
+    C_ASSERT(number != NULL, SOLVING_ERROR);
+
+    if(is_precise_solving())
+        return solve_quadratic_precise_roots(a, b, c, x1, x2, number);
+
+    return solve_quadratic_roots(a, b, c, x1, x2, number);
+}
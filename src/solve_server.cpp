@@ -0,0 +1,772 @@
+/**
+===============================================================================================================================
+    @file    solve_server.cpp
+    @brief   Solving equations sent by other processes through local socket.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "solve_server.h"
+#include "quadratic.h"
+#include "quadratic_batch.h"
+#include "quadratic_dedup.h"
+#include "utils.h"
+#include "custom_assert.h"
+
+#if defined(__linux__)
+#define QUADRATIC_EPOLL
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#endif
+
+#ifdef QUADRATIC_EPOLL
+/**
+===============================================================================================================================
+    @brief   - Size of input buffer of connection, requests must be shorter.
+
+===============================================================================================================================
+*/
+static const size_t SERVER_INPUT_SIZE = 1 << 16;
+
+/**
+===============================================================================================================================
+    @brief   - Number of unsent bytes of replies, after which requests of connection are not read
+               until client reads replies (backpressure).
+
+===============================================================================================================================
+*/
+static const size_t SERVER_OUTPUT_LIMIT = 1 << 20;
+
+/**
+===============================================================================================================================
+    @brief   - Maximum length of reply line (5 numbers with 17 digits, roots number and separators).
+
+===============================================================================================================================
+*/
+static const size_t MAX_REPLY_LENGTH = 5 * 32 + 8;
+
+static const int SERVER_EVENTS_NUMBER = 256;
+static const int SERVER_BACKLOG = 128;
+static const unsigned long MAX_PORT = 65535;
+
+/**
+===============================================================================================================================
+    @brief   Connection with client.
+
+    @details - events is set of epoll events, that connection is registered with.\n
+             - index is position of connection in server_t::connections.
+
+===============================================================================================================================
+*/
+struct server_connection_t {
+    int descriptor;
+    size_t index;
+    char *input;
+    size_t input_size;
+    char *output;
+    size_t output_size;
+    size_t output_sent;
+    size_t output_capacity;
+    uint32_t events;
+    bool peer_closed;
+    bool failed;
+};
+
+/**
+===============================================================================================================================
+    @brief   Requests, that are solved together.
+
+    @details - Invalid requests get coefficients 0 0 0, their results are replaced with "ERROR".\n
+             - received is time (in nanoseconds), when request was read.
+
+===============================================================================================================================
+*/
+struct server_batch_t {
+    double *a, *b, *c;
+    double *x1, *x2;
+    int8_t *number;
+    bool *invalid;
+    server_connection_t **owner;
+    uint64_t *received;
+    size_t size;
+};
+
+/**
+===============================================================================================================================
+    @brief   State of server.
+
+    @details - Listener is registered in epoll with NULL pointer, connections are registered with pointers to them.
+
+===============================================================================================================================
+*/
+struct server_t {
+    int listener;
+    int epoll;
+    server_connection_t **connections;
+    size_t connections_number;
+    size_t connections_capacity;
+    server_batch_t batch;
+    server_stats_t *stats;
+};
+
+static bool make_address(const char *address, sockaddr_storage *storage, socklen_t *length);
+static server_state_t open_listener(server_t *server, const sockaddr_storage *storage, socklen_t length);
+static server_state_t serve(server_t *server);
+static void stop_server(int signal_number);
+static bool allocate_server_batch(server_batch_t *batch);
+static void free_server_batch(server_batch_t *batch);
+static void accept_connections(server_t *server);
+static void close_connection(server_t *server, server_connection_t *connection);
+static void read_requests(server_t *server, server_connection_t *connection);
+static void parse_requests(server_t *server, server_connection_t *connection, uint64_t received, bool is_end);
+static void add_request(server_t *server, server_connection_t *connection, const char *line, const char *end, uint64_t received);
+static void solve_batch(server_t *server);
+static void add_reply(server_connection_t *connection, const server_batch_t *batch, size_t request);
+static void send_replies(server_connection_t *connection);
+static void finish_iteration(server_t *server, server_connection_t *connection);
+static uint64_t now_nanoseconds(void);
+
+static volatile sig_atomic_t server_stopped = 0;
+#endif
+
+server_state_t run_server(const char *address, server_stats_t *stats) {
+    C_ASSERT(address != NULL, SERVER_ADDRESS_ERROR);
+    C_ASSERT(stats   != NULL, SERVER_ADDRESS_ERROR);
+
+    *stats = {};
+
+#ifdef QUADRATIC_EPOLL
+    sockaddr_storage storage = {};
+    socklen_t length = 0;
+    if(!make_address(address, &storage, &length))
+        return SERVER_ADDRESS_ERROR;
+
+    server_t server = {.listener = -1, .epoll = -1, .stats = stats};
+    server_state_t state = SERVER_MEMORY_ERROR;
+    if(allocate_server_batch(&server.batch))
+        state = open_listener(&server, &storage, length);
+
+    if(state == SERVER_SUCCESS) {
+        struct sigaction action = {}, old_interrupt = {}, old_terminate = {}, old_pipe = {};
+        action.sa_handler = stop_server;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGINT, &action, &old_interrupt);
+        sigaction(SIGTERM, &action, &old_terminate);
+        action.sa_handler = SIG_IGN;
+        sigaction(SIGPIPE, &action, &old_pipe);
+
+        server_stopped = 0;
+        state = serve(&server);
+
+        sigaction(SIGINT, &old_interrupt, NULL);
+        sigaction(SIGTERM, &old_terminate, NULL);
+        sigaction(SIGPIPE, &old_pipe, NULL);
+    }
+
+    while(server.connections_number != 0)
+        close_connection(&server, server.connections[server.connections_number - 1]);
+    free(server.connections);
+    free_server_batch(&server.batch);
+
+    if(server.epoll >= 0)
+        close(server.epoll);
+    if(server.listener >= 0) {
+        close(server.listener);
+        if(storage.ss_family == AF_UNIX)
+            unlink(((sockaddr_un *)&storage)->sun_path);
+    }
+    return state;
+#else
+    return SERVER_UNSUPPORTED;
+#endif
+}
+
+int connect_to_server(const char *address) {
+    C_ASSERT(address != NULL, -1);
+
+#ifdef QUADRATIC_EPOLL
+    sockaddr_storage storage = {};
+    socklen_t length = 0;
+    if(!make_address(address, &storage, &length))
+        return -1;
+
+    int descriptor = socket(storage.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if(descriptor < 0)
+        return -1;
+
+    if(connect(descriptor, (const sockaddr *)&storage, length) != 0) {
+        close(descriptor);
+        return -1;
+    }
+
+    if(storage.ss_family == AF_INET) {
+        int enabled = 1;
+        setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+    }
+    return descriptor;
+#else
+    return -1;
+#endif
+}
+
+#ifdef QUADRATIC_EPOLL
+/**
+===============================================================================================================================
+    @brief   - Converts address to socket address.
+
+    @details - Address of digits is port on 127.0.0.1, other addresses are paths of unix sockets.
+
+    @return  False if port is invalid or path is too long.
+
+===============================================================================================================================
+*/
+bool make_address(const char *address, sockaddr_storage *storage, socklen_t *length) {
+    C_ASSERT(address != NULL, false);
+    C_ASSERT(storage != NULL, false);
+    C_ASSERT(length  != NULL, false);
+
+    if(address[0] == '\0')
+        return false;
+
+    if(strspn(address, "0123456789") == strlen(address)) {
+        unsigned long port = strtoul(address, NULL, 10);
+        if(port == 0 || port > MAX_PORT)
+            return false;
+
+        sockaddr_in *inet = (sockaddr_in *)storage;
+        inet->sin_family = AF_INET;
+        inet->sin_port = htons((uint16_t)port);
+        inet->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        *length = sizeof(sockaddr_in);
+        return true;
+    }
+
+    sockaddr_un *local = (sockaddr_un *)storage;
+    if(strlen(address) >= sizeof(local->sun_path))
+        return false;
+
+    local->sun_family = AF_UNIX;
+    strcpy(local->sun_path, address);
+    *length = sizeof(sockaddr_un);
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Creates listening socket and epoll.
+
+    @details - Old unix socket file with the same path is removed (but other files are not).
+
+===============================================================================================================================
+*/
+server_state_t open_listener(server_t *server, const sockaddr_storage *storage, socklen_t length) {
+    C_ASSERT(server  != NULL, SERVER_SOCKET_ERROR);
+    C_ASSERT(storage != NULL, SERVER_SOCKET_ERROR);
+
+    server->listener = socket(storage->ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if(server->listener < 0)
+        return SERVER_SOCKET_ERROR;
+
+    if(storage->ss_family == AF_INET) {
+        int enabled = 1;
+        setsockopt(server->listener, SOL_SOCKET, SO_REUSEADDR, &enabled, sizeof(enabled));
+    }
+    else {
+        struct stat file_stat = {};
+        const char *path = ((const sockaddr_un *)storage)->sun_path;
+        if(stat(path, &file_stat) == 0 && S_ISSOCK(file_stat.st_mode))
+            unlink(path);
+    }
+
+    if(bind(server->listener, (const sockaddr *)storage, length) != 0) {
+        close(server->listener);
+        server->listener = -1;
+        return SERVER_SOCKET_ERROR;
+    }
+
+    server->epoll = epoll_create1(EPOLL_CLOEXEC);
+    if(listen(server->listener, SERVER_BACKLOG) != 0 || server->epoll < 0)
+        return SERVER_SOCKET_ERROR;
+
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.ptr = NULL;
+    if(epoll_ctl(server->epoll, EPOLL_CTL_ADD, server->listener, &event) != 0)
+        return SERVER_SOCKET_ERROR;
+
+    return SERVER_SUCCESS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Runs epoll loop until server is stopped by signal.
+
+    @details - In every iteration requests are read from all ready connections, then they are solved as one batch,
+               then connections, that are finished, are closed.
+
+===============================================================================================================================
+*/
+server_state_t serve(server_t *server) {
+    C_ASSERT(server != NULL, SERVER_SOCKET_ERROR);
+
+    epoll_event events[SERVER_EVENTS_NUMBER] = {};
+
+    while(!server_stopped) {
+        int ready = epoll_wait(server->epoll, events, SERVER_EVENTS_NUMBER, -1);
+        if(ready < 0) {
+            if(errno == EINTR)
+                continue;
+            return SERVER_SOCKET_ERROR;
+        }
+
+        for(int event = 0; event < ready; event++) {
+            server_connection_t *connection = (server_connection_t *)events[event].data.ptr;
+            if(connection == NULL) {
+                accept_connections(server);
+                continue;
+            }
+
+            if(events[event].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+                read_requests(server, connection);
+            if(events[event].events & EPOLLOUT)
+                send_replies(connection);
+        }
+
+        solve_batch(server);
+
+        for(int event = 0; event < ready; event++) {
+            if(events[event].data.ptr != NULL)
+                finish_iteration(server, (server_connection_t *)events[event].data.ptr);
+        }
+    }
+
+    return SERVER_SUCCESS;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Handles SIGINT and SIGTERM.
+
+===============================================================================================================================
+*/
+void stop_server(int signal_number) {
+    (void)signal_number;
+    server_stopped = 1;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Allocates columns of batch.
+
+    @return  True if memory was allocated and false if not.
+
+===============================================================================================================================
+*/
+bool allocate_server_batch(server_batch_t *batch) {
+    C_ASSERT(batch != NULL, false);
+
+    batch->a        = (double *)calloc(SERVER_BATCH_SIZE, sizeof(double));
+    batch->b        = (double *)calloc(SERVER_BATCH_SIZE, sizeof(double));
+    batch->c        = (double *)calloc(SERVER_BATCH_SIZE, sizeof(double));
+    batch->x1       = (double *)calloc(SERVER_BATCH_SIZE, sizeof(double));
+    batch->x2       = (double *)calloc(SERVER_BATCH_SIZE, sizeof(double));
+    batch->number   = (int8_t *)calloc(SERVER_BATCH_SIZE, sizeof(int8_t));
+    batch->invalid  = (bool *)calloc(SERVER_BATCH_SIZE, sizeof(bool));
+    batch->owner    = (server_connection_t **)calloc(SERVER_BATCH_SIZE, sizeof(server_connection_t *));
+    batch->received = (uint64_t *)calloc(SERVER_BATCH_SIZE, sizeof(uint64_t));
+    batch->size = 0;
+
+    return batch->a  != NULL && batch->b  != NULL && batch->c      != NULL && batch->x1    != NULL &&
+           batch->x2 != NULL && batch->number != NULL && batch->invalid != NULL && batch->owner != NULL &&
+           batch->received != NULL;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Frees columns of batch.
+
+===============================================================================================================================
+*/
+void free_server_batch(server_batch_t *batch) {
+    C_ASSERT(batch != NULL, );
+
+    free(batch->a);
+    free(batch->b);
+    free(batch->c);
+    free(batch->x1);
+    free(batch->x2);
+    free(batch->number);
+    free(batch->invalid);
+    free(batch->owner);
+    free(batch->received);
+    *batch = {};
+}
+
+/**
+===============================================================================================================================
+    @brief   - Accepts all waiting connections and registers them in epoll.
+
+    @details - Connection is closed at once if memory for it could not be allocated.
+
+===============================================================================================================================
+*/
+void accept_connections(server_t *server) {
+    C_ASSERT(server != NULL, );
+
+    while(true) {
+        int descriptor = accept4(server->listener, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if(descriptor < 0)
+            return ;
+
+        int enabled = 1;
+        setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+
+        if(server->connections_number == server->connections_capacity) {
+            size_t capacity = server->connections_capacity == 0 ? 16 : 2 * server->connections_capacity;
+            server_connection_t **connections = (server_connection_t **)realloc(server->connections,
+                                                                                capacity * sizeof(server_connection_t *));
+            if(connections == NULL) {
+                close(descriptor);
+                continue;
+            }
+            server->connections = connections;
+            server->connections_capacity = capacity;
+        }
+
+        server_connection_t *connection = (server_connection_t *)calloc(1, sizeof(server_connection_t));
+        char *input = (char *)malloc(SERVER_INPUT_SIZE);
+        if(connection == NULL || input == NULL) {
+            free(connection);
+            free(input);
+            close(descriptor);
+            continue;
+        }
+
+        connection->descriptor = descriptor;
+        connection->input = input;
+        connection->events = EPOLLIN;
+
+        epoll_event event = {};
+        event.events = connection->events;
+        event.data.ptr = connection;
+        if(epoll_ctl(server->epoll, EPOLL_CTL_ADD, descriptor, &event) != 0) {
+            free(connection);
+            free(input);
+            close(descriptor);
+            continue;
+        }
+
+        connection->index = server->connections_number;
+        server->connections[server->connections_number++] = connection;
+        server->stats->connections++;
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Closes connection and frees its memory.
+
+===============================================================================================================================
+*/
+void close_connection(server_t *server, server_connection_t *connection) {
+    C_ASSERT(server     != NULL, );
+    C_ASSERT(connection != NULL, );
+
+    epoll_ctl(server->epoll, EPOLL_CTL_DEL, connection->descriptor, NULL);
+    close(connection->descriptor);
+
+    server_connection_t *last = server->connections[--server->connections_number];
+    server->connections[connection->index] = last;
+    last->index = connection->index;
+
+    free(connection->input);
+    free(connection->output);
+    free(connection);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Reads requests of connection and adds them to batch.
+
+    @details - When client closes connection, the last line without '\n' is request too.
+
+===============================================================================================================================
+*/
+void read_requests(server_t *server, server_connection_t *connection) {
+    C_ASSERT(server     != NULL, );
+    C_ASSERT(connection != NULL, );
+
+    if(connection->peer_closed || connection->failed)
+        return ;
+
+    ssize_t received = recv(connection->descriptor, connection->input + connection->input_size,
+                            SERVER_INPUT_SIZE - connection->input_size, 0);
+    if(received < 0) {
+        if(errno != EAGAIN && errno != EINTR)
+            connection->failed = true;
+        return ;
+    }
+
+    if(received == 0) {
+        connection->peer_closed = true;
+        parse_requests(server, connection, now_nanoseconds(), true);
+        return ;
+    }
+
+    connection->input_size += (size_t)received;
+    parse_requests(server, connection, now_nanoseconds(), false);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Adds all complete lines of input of connection to batch and moves the rest to the beginning of input.
+
+    @details - Connection fails if its input is full, but there is no '\n' in it.
+
+===============================================================================================================================
+*/
+void parse_requests(server_t *server, server_connection_t *connection, uint64_t received, bool is_end) {
+    C_ASSERT(server     != NULL, );
+    C_ASSERT(connection != NULL, );
+
+    const char *line = connection->input;
+    const char *end  = connection->input + connection->input_size;
+
+    while(line != end) {
+        const char *newline = (const char *)memchr(line, '\n', (size_t)(end - line));
+        if(newline == NULL) {
+            if(!is_end)
+                break;
+            newline = end;
+        }
+
+        add_request(server, connection, line, newline, received);
+        line = newline == end ? end : newline + 1;
+    }
+
+    connection->input_size = (size_t)(end - line);
+    memmove(connection->input, line, connection->input_size);
+
+    if(connection->input_size == SERVER_INPUT_SIZE)
+        connection->failed = true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Adds request [line, end) to batch, full batch is solved first.
+
+    @details - Empty lines are skipped.
+
+===============================================================================================================================
+*/
+void add_request(server_t *server, server_connection_t *connection, const char *line, const char *end, uint64_t received) {
+    C_ASSERT(server     != NULL, );
+    C_ASSERT(connection != NULL, );
+    C_ASSERT(line       != NULL, );
+    C_ASSERT(end        != NULL, );
+
+    text_reader_t reader = {};
+    init_text_reader(&reader, line, (size_t)(end - line));
+
+    double a = 0, b = 0, c = 0;
+    reading_state_t state = read_coefficients_text(&reader, &a, &b, &c);
+    if(state == READING_END)
+        return ;
+
+    if(server->batch.size == SERVER_BATCH_SIZE)
+        solve_batch(server);
+
+    server_batch_t *batch = &server->batch;
+    bool invalid = state != READING_SUCCESS;
+    batch->a[batch->size] = invalid ? 0 : a;
+    batch->b[batch->size] = invalid ? 0 : b;
+    batch->c[batch->size] = invalid ? 0 : c;
+    batch->invalid[batch->size] = invalid;
+    batch->owner[batch->size] = connection;
+    batch->received[batch->size] = received;
+    batch->size++;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Solves batch, adds replies to connections and sends them.
+
+    @details - Batch is solved with solve_quadratic_batch_parallel() (or solve_quadratic_batch_dedup()
+               if deduplication is on), so it is split between threads if it is big.\n
+             - Latency of every request is added to statistics after replies are sent.
+
+===============================================================================================================================
+*/
+void solve_batch(server_t *server) {
+    C_ASSERT(server != NULL, );
+
+    server_batch_t *batch = &server->batch;
+    if(batch->size == 0)
+        return ;
+
+    if(is_batch_dedup())
+        solve_quadratic_batch_dedup(batch->a, batch->b, batch->c, batch->size, batch->x1, batch->x2, batch->number, NULL);
+    else
+        solve_quadratic_batch_parallel(batch->a, batch->b, batch->c, batch->size, batch->x1, batch->x2, batch->number, NULL);
+
+    for(size_t request = 0; request < batch->size; request++)
+        add_reply(batch->owner[request], batch, request);
+
+    for(size_t request = 0; request < batch->size; request++)
+        send_replies(batch->owner[request]);
+
+    server_stats_t *stats = server->stats;
+    uint64_t now = now_nanoseconds();
+    for(size_t request = 0; request < batch->size; request++) {
+        add_latency(&stats->latency, now - batch->received[request]);
+        if(batch->invalid[request])
+            stats->invalid_requests++;
+    }
+
+    stats->requests += batch->size;
+    stats->batches++;
+    if(batch->size > stats->max_batch)
+        stats->max_batch = batch->size;
+
+    batch->size = 0;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Adds reply to request of batch to output of connection.
+
+    @details - Connection fails if output could not be allocated.
+
+===============================================================================================================================
+*/
+void add_reply(server_connection_t *connection, const server_batch_t *batch, size_t request) {
+    C_ASSERT(connection != NULL, );
+    C_ASSERT(batch      != NULL, );
+
+    if(connection->failed)
+        return ;
+
+    if(connection->output_capacity - connection->output_size < MAX_REPLY_LENGTH) {
+        memmove(connection->output, connection->output + connection->output_sent,
+                connection->output_size - connection->output_sent);
+        connection->output_size -= connection->output_sent;
+        connection->output_sent = 0;
+    }
+
+    if(connection->output_capacity - connection->output_size < MAX_REPLY_LENGTH) {
+        size_t capacity = connection->output_capacity == 0 ? 16 * MAX_REPLY_LENGTH : 2 * connection->output_capacity;
+        char *output = (char *)realloc(connection->output, capacity);
+        if(output == NULL) {
+            connection->failed = true;
+            return ;
+        }
+        connection->output = output;
+        connection->output_capacity = capacity;
+    }
+
+    char *position = connection->output + connection->output_size;
+    int printed = 0;
+    if(batch->invalid[request])
+        printed = snprintf(position, MAX_REPLY_LENGTH, "ERROR\n");
+    else
+        printed = snprintf(position, MAX_REPLY_LENGTH, "%.17lg %.17lg %.17lg %.17lg %.17lg %d\n",
+                           batch->a[request], batch->b[request], batch->c[request],
+                           batch->x1[request], batch->x2[request], batch->number[request]);
+
+    if(printed < 0 || (size_t)printed >= MAX_REPLY_LENGTH) {
+        connection->failed = true;
+        return ;
+    }
+    connection->output_size += (size_t)printed;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Sends as many replies of connection as socket accepts.
+
+===============================================================================================================================
+*/
+void send_replies(server_connection_t *connection) {
+    C_ASSERT(connection != NULL, );
+
+    while(!connection->failed && connection->output_sent < connection->output_size) {
+        ssize_t sent = send(connection->descriptor, connection->output + connection->output_sent,
+                            connection->output_size - connection->output_sent, MSG_NOSIGNAL);
+        if(sent < 0) {
+            if(errno == EINTR)
+                continue;
+            if(errno != EAGAIN)
+                connection->failed = true;
+            return ;
+        }
+        connection->output_sent += (size_t)sent;
+    }
+
+    if(connection->output_sent == connection->output_size)
+        connection->output_sent = connection->output_size = 0;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Closes connection if it failed or client closed it and all replies are sent,
+               in other cases updates epoll events of connection.
+
+    @details - Connection waits for EPOLLOUT while it has unsent replies,
+               it does not wait for EPOLLIN while it has more than SERVER_OUTPUT_LIMIT unsent bytes.
+
+===============================================================================================================================
+*/
+void finish_iteration(server_t *server, server_connection_t *connection) {
+    C_ASSERT(server     != NULL, );
+    C_ASSERT(connection != NULL, );
+
+    size_t unsent = connection->output_size - connection->output_sent;
+    if(connection->failed || (connection->peer_closed && unsent == 0)) {
+        close_connection(server, connection);
+        return ;
+    }
+
+    uint32_t events = 0;
+    if(!connection->peer_closed && unsent <= SERVER_OUTPUT_LIMIT)
+        events |= EPOLLIN;
+    if(unsent != 0)
+        events |= EPOLLOUT;
+
+    if(events != connection->events) {
+        epoll_event event = {};
+        event.events = events;
+        event.data.ptr = connection;
+        if(epoll_ctl(server->epoll, EPOLL_CTL_MOD, connection->descriptor, &event) != 0) {
+            close_connection(server, connection);
+            return ;
+        }
+        connection->events = events;
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns time of monotonic clock in nanoseconds.
+
+===============================================================================================================================
+*/
+uint64_t now_nanoseconds(void) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
@@ -0,0 +1,154 @@
+/**
+===============================================================================================================================
+    @file    solve_stats.cpp
+    @brief   Counters of results of solve_quadratic() and histograms of time of stages of tests.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <string.h>
+#include <chrono>
+#include <mutex>
+#include "solve_stats.h"
+#include "custom_assert.h"
+
+/**
+===============================================================================================================================
+    @brief   Statistics of one thread, that are not added to totals yet.
+
+===============================================================================================================================
+*/
+struct stats_block_t {
+    solve_stats_t stats;
+    bool dirty;
+
+    ~stats_block_t();
+};
+
+static void add_stats(solve_stats_t *stats, const solve_stats_t *other);
+static void flush_stats_block(stats_block_t *block);
+
+bool solve_stats_enabled = false;
+
+static std::mutex totals_mutex;
+static solve_stats_t totals = {};
+
+static thread_local stats_block_t thread_block = {};
+
+void set_solve_stats_enabled(bool enabled) {
+    solve_stats_enabled = enabled;
+}
+
+uint64_t get_stats_time(void) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void add_stage_time(stats_stage_t stage, uint64_t nanoseconds) {
+    C_ASSERT(stage < STATS_STAGES_NUMBER, );
+
+    add_latency(&thread_block.stats.stages[stage], nanoseconds);
+    thread_block.dirty = true;
+}
+
+void add_solving_result(solving_state_t state, roots_number_t number) {
+    C_ASSERT((size_t)state < STATS_SOLVING_STATES, );
+
+    thread_block.stats.solving_states[state]++;
+    if(state == SOLVING_SUCCESS && number >= INF_ROOTS && number <= TWO_ROOTS)
+        thread_block.stats.roots_numbers[number - INF_ROOTS]++;
+    thread_block.dirty = true;
+}
+
+void flush_solve_stats(void) {
+    flush_stats_block(&thread_block);
+}
+
+void get_solve_stats(solve_stats_t *stats) {
+    C_ASSERT(stats != NULL, );
+
+    flush_stats_block(&thread_block);
+
+    std::lock_guard<std::mutex> lock(totals_mutex);
+    memcpy(stats, &totals, sizeof(solve_stats_t));
+}
+
+const char *stats_stage_name(stats_stage_t stage) {
+    switch(stage) {
+        case STATS_STAGE_READ:    return "read";
+        case STATS_STAGE_SOLVE:   return "solve";
+        case STATS_STAGE_COMPARE: return "compare";
+        case STATS_STAGE_OUTPUT:  return "output";
+        case STATS_STAGES_NUMBER: return "unknown";
+        default:                  return "unknown";
+    }
+}
+
+const char *stats_roots_name(roots_number_t number) {
+    switch(number) {
+        case INF_ROOTS:  return "inf_roots";
+        case NOT_SOLVED: return "not_solved";
+        case NO_ROOTS:   return "no_roots";
+        case ONE_ROOT:   return "one_root";
+        case TWO_ROOTS:  return "two_roots";
+        default:         return "unknown";
+    }
+}
+
+const char *stats_solving_state_name(solving_state_t state) {
+    switch(state) {
+        case SOLVING_SUCCESS:      return "success";
+        case SOLVING_ERROR:        return "error";
+        case INVALID_COEFFICIENTS: return "invalid_coefficients";
+        default:                   return "unknown";
+    }
+}
+
+stats_block_t::~stats_block_t() {
+    flush_stats_block(this);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Adds counters and histograms of one statistics to another.
+
+===============================================================================================================================
+*/
+void add_stats(solve_stats_t *stats, const solve_stats_t *other) {
+    C_ASSERT(stats != NULL, );
+    C_ASSERT(other != NULL, );
+
+    for(size_t number = 0; number < STATS_ROOTS_NUMBERS; number++)
+        stats->roots_numbers[number] += other->roots_numbers[number];
+    for(size_t state = 0; state < STATS_SOLVING_STATES; state++)
+        stats->solving_states[state] += other->solving_states[state];
+    for(size_t stage = 0; stage < STATS_STAGES_NUMBER; stage++)
+        if(other->stages[stage].samples != 0)
+            merge_latency_histograms(&stats->stages[stage], &other->stages[stage]);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Adds statistics of thread to totals and zeroes them.
+
+    @details - Does nothing if nothing was collected since the last flush, so flushing after every task is cheap.
+
+===============================================================================================================================
+*/
+void flush_stats_block(stats_block_t *block) {
+    C_ASSERT(block != NULL, );
+
+    if(!block->dirty)
+        return ;
+
+    {
+        std::lock_guard<std::mutex> lock(totals_mutex);
+        add_stats(&totals, &block->stats);
+    }
+
+    memset(&block->stats, 0, sizeof(solve_stats_t));
+    block->dirty = false;
+}
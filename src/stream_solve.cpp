@@ -0,0 +1,670 @@
+/**
+===============================================================================================================================
+    @file    stream_solve.cpp
+    @brief   Solving streams of quadratic equations without user interaction.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "stream_solve.h"
+#include "quadratic.h"
+#include "quadratic_batch.h"
+#include "quadratic_dedup.h"
+#include "thread_pool.h"
+#include "utils.h"
+#include "custom_assert.h"
+
+/**
+===============================================================================================================================
+    @brief   - Number of equations in one block.
+
+===============================================================================================================================
+*/
+static const size_t STREAM_BLOCK_SIZE = 1 << 12;
+
+/**
+===============================================================================================================================
+    @brief   - Maximum length of input line.
+
+===============================================================================================================================
+*/
+static const int MAX_STREAM_LINE_LENGTH = 256;
+
+/**
+===============================================================================================================================
+    @brief   - Maximum length of output line (5 numbers with 17 digits, roots number and separators).
+
+===============================================================================================================================
+*/
+static const size_t MAX_RESULT_LINE_LENGTH = 5 * 32 + 8;
+
+/**
+===============================================================================================================================
+    @brief   - Number of blocks in ring between reader and solver or between solver and writer (power of two).
+
+===============================================================================================================================
+*/
+static const size_t PIPELINE_RING_SIZE = 4;
+
+/**
+===============================================================================================================================
+    @brief   - Number of blocks per solver thread, they are shared by all stages.
+
+===============================================================================================================================
+*/
+static const size_t PIPELINE_BLOCKS_PER_SOLVER = 3;
+
+/**
+===============================================================================================================================
+    @brief   - Number of yields of waiting thread, after which it sleeps for PIPELINE_SLEEP_MICROSECONDS.
+
+===============================================================================================================================
+*/
+static const size_t PIPELINE_SPINS_BEFORE_SLEEP = 64;
+static const int PIPELINE_SLEEP_MICROSECONDS = 50;
+
+/**
+===============================================================================================================================
+    @brief   Block of equations that is passed from reader to solver and from solver to writer.
+
+    @details - text is filled by solver, so writer only writes it.
+
+===============================================================================================================================
+*/
+struct stream_block_t {
+    double *a, *b, *c;
+    double *x1, *x2;
+    int8_t *number;
+    char *text;
+    size_t size;
+    size_t text_size;
+    bool format_error;
+    reading_state_t state;
+    size_t error_line;
+};
+
+/**
+===============================================================================================================================
+    @brief   Lock-free bounded ring of blocks with one producer and one consumer.
+
+    @details - Indices grow without wrapping, ring is full if tail - head == capacity.\n
+             - Producer and consumer counters are on separate cache lines, so they are not shared.\n
+             - NULL block is pushed as the end of stream.
+
+===============================================================================================================================
+*/
+struct alignas(64) spsc_ring_t {
+    stream_block_t **items;
+    size_t mask;
+    alignas(64) std::atomic<size_t> head;
+    alignas(64) std::atomic<size_t> tail;
+    alignas(64) uint64_t pushes;
+    uint64_t full_stalls;
+    uint64_t depth_sum;
+    size_t max_depth;
+    alignas(64) uint64_t empty_stalls;
+};
+
+/**
+===============================================================================================================================
+    @brief   State shared by reader, solvers and writer.
+
+    @details - Block k is passed to solver k % solvers_number, writer takes blocks from solvers in the same order,
+               so results are written in order of input.\n
+             - Writer returns blocks to reader through free_ring.
+
+===============================================================================================================================
+*/
+struct stream_t {
+    FILE *input;
+    text_reader_t *mapped;
+    size_t solvers_number;
+    size_t blocks_number;
+    stream_block_t *blocks;
+    spsc_ring_t *parsed_rings;
+    spsc_ring_t *solved_rings;
+    spsc_ring_t *free_ring;
+    std::atomic<bool> stopped;
+};
+
+static bool allocate_stream(stream_t *stream);
+static void free_stream(stream_t *stream);
+static bool allocate_block(stream_block_t *block);
+static void free_block(stream_block_t *block);
+static bool allocate_ring(spsc_ring_t *ring, size_t capacity);
+static void ring_push(spsc_ring_t *ring, stream_block_t *block);
+static stream_block_t *ring_pop(spsc_ring_t *ring);
+static void wait_briefly(size_t *spins);
+static void add_ring_stats(pipeline_queue_stats_t *stats, const spsc_ring_t *ring);
+static void read_blocks(stream_t *stream);
+static void solve_blocks(stream_t *stream, size_t solver);
+static reading_state_t fill_block(FILE *input, stream_block_t *block, size_t *line_number);
+static reading_state_t fill_block_mapped(text_reader_t *reader, stream_block_t *block);
+static stream_state_t run_stream(stream_t *stream, FILE *output, size_t *equations_number, size_t *error_line);
+static void format_block(stream_block_t *block);
+
+static pipeline_stats_t last_pipeline_stats = {};
+
+stream_state_t solve_stream(FILE *input, FILE *output, size_t *equations_number, size_t *error_line) {
+    C_ASSERT(input            != NULL, STREAM_READING_ERROR);
+    C_ASSERT(output           != NULL, STREAM_WRITING_ERROR);
+    C_ASSERT(equations_number != NULL, STREAM_READING_ERROR);
+    C_ASSERT(error_line       != NULL, STREAM_READING_ERROR);
+
+    setvbuf(input, NULL, _IOFBF, STREAM_BUFFER_SIZE);
+
+    stream_t stream = {.input = input, .mapped = NULL};
+    return run_stream(&stream, output, equations_number, error_line);
+}
+
+stream_state_t solve_stream_mapped(const mapped_file_t *input, FILE *output, size_t *equations_number, size_t *error_line) {
+    C_ASSERT(input            != NULL, STREAM_READING_ERROR);
+    C_ASSERT(output           != NULL, STREAM_WRITING_ERROR);
+    C_ASSERT(equations_number != NULL, STREAM_READING_ERROR);
+    C_ASSERT(error_line       != NULL, STREAM_READING_ERROR);
+
+    text_reader_t reader = {};
+    init_text_reader(&reader, input->data, input->size);
+
+    stream_t stream = {.input = NULL, .mapped = &reader};
+    return run_stream(&stream, output, equations_number, error_line);
+}
+
+void get_pipeline_stats(pipeline_stats_t *stats) {
+    C_ASSERT(stats != NULL, );
+
+    *stats = last_pipeline_stats;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Runs reader and solver threads, calling thread is writer.
+
+    @details - Writer takes solved blocks in order of input and writes their text.\n
+             - If output could not be written, writer stops reader and drops blocks until the end of stream,
+               so all threads finish.\n
+             - Arguments and return values are the same as in solve_stream().
+
+===============================================================================================================================
+*/
+stream_state_t run_stream(stream_t *stream, FILE *output, size_t *equations_number, size_t *error_line) {
+    *equations_number = 0;
+    *error_line = 0;
+
+    setvbuf(output, NULL, _IOFBF, STREAM_BUFFER_SIZE);
+
+    size_t threads = get_threads_number();
+    stream->solvers_number = threads > 2 ? threads - 2 : 1;
+    stream->blocks_number  = stream->solvers_number * PIPELINE_BLOCKS_PER_SOLVER;
+    stream->stopped.store(false);
+
+    if(!allocate_stream(stream)) {
+        free_stream(stream);
+        return STREAM_MEMORY_ERROR;
+    }
+
+    for(size_t block = 0; block < stream->blocks_number; block++)
+        ring_push(stream->free_ring, &stream->blocks[block]);
+    stream->free_ring->pushes = stream->free_ring->depth_sum = stream->free_ring->max_depth = 0;
+
+    std::thread reader(read_blocks, stream);
+    std::thread *solvers = new std::thread[stream->solvers_number];
+    for(size_t solver = 0; solver < stream->solvers_number; solver++)
+        solvers[solver] = std::thread(solve_blocks, stream, solver);
+
+    stream_state_t state = STREAM_SUCCESS;
+    for(size_t current = 0; ; current = (current + 1) % stream->solvers_number) {
+        stream_block_t *block = ring_pop(&stream->solved_rings[current]);
+        if(block == NULL)
+            break;
+
+        if(state == STREAM_SUCCESS) {
+            if(block->format_error || fwrite(block->text, 1, block->text_size, output) != block->text_size) {
+                state = STREAM_WRITING_ERROR;
+                stream->stopped.store(true, std::memory_order_relaxed);
+            }
+            else {
+                *equations_number += block->size;
+                if(block->state == READING_ERROR) {
+                    *error_line = block->error_line;
+                    state = STREAM_READING_ERROR;
+                }
+            }
+        }
+
+        ring_push(stream->free_ring, block);
+    }
+
+    reader.join();
+    for(size_t solver = 0; solver < stream->solvers_number; solver++)
+        solvers[solver].join();
+    delete[] solvers;
+
+    if(fflush(output) != 0 && state == STREAM_SUCCESS)
+        state = STREAM_WRITING_ERROR;
+
+    pipeline_stats_t stats = {.solvers_number = stream->solvers_number, .blocks_number = stream->blocks_number,
+                              .block_size = STREAM_BLOCK_SIZE};
+    for(size_t solver = 0; solver < stream->solvers_number; solver++) {
+        add_ring_stats(&stats.parsed, &stream->parsed_rings[solver]);
+        add_ring_stats(&stats.solved, &stream->solved_rings[solver]);
+    }
+    add_ring_stats(&stats.free, stream->free_ring);
+    last_pipeline_stats = stats;
+
+    free_stream(stream);
+    return state;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Allocates blocks and rings of stream.
+
+    @return  True if memory was allocated and false if not.
+
+===============================================================================================================================
+*/
+bool allocate_stream(stream_t *stream) {
+    C_ASSERT(stream != NULL, false);
+
+    stream->blocks       = (stream_block_t *)calloc(stream->blocks_number, sizeof(stream_block_t));
+    stream->parsed_rings = new spsc_ring_t[stream->solvers_number]();
+    stream->solved_rings = new spsc_ring_t[stream->solvers_number]();
+    stream->free_ring    = new spsc_ring_t();
+    if(stream->blocks == NULL)
+        return false;
+
+    bool allocated = true;
+    for(size_t block = 0; block < stream->blocks_number; block++)
+        allocated = allocate_block(&stream->blocks[block]) && allocated;
+
+    for(size_t solver = 0; solver < stream->solvers_number; solver++) {
+        allocated = allocate_ring(&stream->parsed_rings[solver], PIPELINE_RING_SIZE) && allocated;
+        allocated = allocate_ring(&stream->solved_rings[solver], PIPELINE_RING_SIZE) && allocated;
+    }
+
+    size_t free_capacity = 1;
+    while(free_capacity < stream->blocks_number)
+        free_capacity *= 2;
+
+    return allocate_ring(stream->free_ring, free_capacity) && allocated;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Frees blocks and rings of stream.
+
+===============================================================================================================================
+*/
+void free_stream(stream_t *stream) {
+    C_ASSERT(stream != NULL, );
+
+    if(stream->blocks != NULL) {
+        for(size_t block = 0; block < stream->blocks_number; block++)
+            free_block(&stream->blocks[block]);
+    }
+    free(stream->blocks);
+
+    for(size_t solver = 0; solver < stream->solvers_number; solver++) {
+        if(stream->parsed_rings != NULL)
+            free(stream->parsed_rings[solver].items);
+        if(stream->solved_rings != NULL)
+            free(stream->solved_rings[solver].items);
+    }
+    if(stream->free_ring != NULL)
+        free(stream->free_ring->items);
+
+    delete[] stream->parsed_rings;
+    delete[] stream->solved_rings;
+    delete stream->free_ring;
+
+    stream->blocks       = NULL;
+    stream->parsed_rings = NULL;
+    stream->solved_rings = NULL;
+    stream->free_ring    = NULL;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Allocates columns and text of block.
+
+    @return  True if memory was allocated and false if not.
+
+===============================================================================================================================
+*/
+bool allocate_block(stream_block_t *block) {
+    C_ASSERT(block != NULL, false);
+
+    block->a      = (double *)calloc(STREAM_BLOCK_SIZE, sizeof(double));
+    block->b      = (double *)calloc(STREAM_BLOCK_SIZE, sizeof(double));
+    block->c      = (double *)calloc(STREAM_BLOCK_SIZE, sizeof(double));
+    block->x1     = (double *)calloc(STREAM_BLOCK_SIZE, sizeof(double));
+    block->x2     = (double *)calloc(STREAM_BLOCK_SIZE, sizeof(double));
+    block->number = (int8_t *)calloc(STREAM_BLOCK_SIZE, sizeof(int8_t));
+    block->text   = (char *)malloc(STREAM_BLOCK_SIZE * MAX_RESULT_LINE_LENGTH);
+
+    return block->a  != NULL && block->b  != NULL && block->c      != NULL &&
+           block->x1 != NULL && block->x2 != NULL && block->number != NULL && block->text != NULL;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Frees columns and text of block.
+
+===============================================================================================================================
+*/
+void free_block(stream_block_t *block) {
+    C_ASSERT(block != NULL, );
+
+    free(block->a);
+    free(block->b);
+    free(block->c);
+    free(block->x1);
+    free(block->x2);
+    free(block->number);
+    free(block->text);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Allocates empty ring.
+
+    @param   [out] ring               Pointer to ring.
+    @param   [in]  capacity           Number of blocks (power of two).
+
+    @return  True if memory was allocated and false if not.
+
+===============================================================================================================================
+*/
+bool allocate_ring(spsc_ring_t *ring, size_t capacity) {
+    C_ASSERT(ring != NULL, false);
+
+    ring->items = (stream_block_t **)calloc(capacity, sizeof(stream_block_t *));
+    ring->mask  = capacity - 1;
+    ring->head.store(0);
+    ring->tail.store(0);
+    return ring->items != NULL;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Puts block to ring, waiting while ring is full (only producer of ring calls it).
+
+    @details - Depth of ring before push of block (not end of stream) is added to statistics,
+               waiting for free place is counted as stall.
+
+===============================================================================================================================
+*/
+void ring_push(spsc_ring_t *ring, stream_block_t *block) {
+    C_ASSERT(ring != NULL, );
+
+    size_t tail = ring->tail.load(std::memory_order_relaxed);
+    size_t head = ring->head.load(std::memory_order_acquire);
+
+    if(tail - head > ring->mask) {
+        ring->full_stalls++;
+
+        size_t spins = 0;
+        while(tail - head > ring->mask) {
+            wait_briefly(&spins);
+            head = ring->head.load(std::memory_order_acquire);
+        }
+    }
+
+    size_t depth = tail - head;
+    if(block != NULL) {
+        ring->pushes++;
+        ring->depth_sum += depth;
+        if(depth > ring->max_depth)
+            ring->max_depth = depth;
+    }
+
+    ring->items[tail & ring->mask] = block;
+    ring->tail.store(tail + 1, std::memory_order_release);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Takes block from ring, waiting while ring is empty (only consumer of ring calls it).
+
+    @details - Waiting for block is counted as stall.
+
+===============================================================================================================================
+*/
+stream_block_t *ring_pop(spsc_ring_t *ring) {
+    C_ASSERT(ring != NULL, NULL);
+
+    size_t head = ring->head.load(std::memory_order_relaxed);
+    size_t tail = ring->tail.load(std::memory_order_acquire);
+
+    if(head == tail) {
+        ring->empty_stalls++;
+
+        size_t spins = 0;
+        while(head == tail) {
+            wait_briefly(&spins);
+            tail = ring->tail.load(std::memory_order_acquire);
+        }
+    }
+
+    stream_block_t *block = ring->items[head & ring->mask];
+    ring->head.store(head + 1, std::memory_order_release);
+    return block;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Gives processor to other threads, after PIPELINE_SPINS_BEFORE_SLEEP calls sleeps,
+               so thread that waits for slow input does not load processor.
+
+===============================================================================================================================
+*/
+void wait_briefly(size_t *spins) {
+    C_ASSERT(spins != NULL, );
+
+    if(*spins < PIPELINE_SPINS_BEFORE_SLEEP) {
+        *spins += 1;
+        std::this_thread::yield();
+    }
+    else
+        std::this_thread::sleep_for(std::chrono::microseconds(PIPELINE_SLEEP_MICROSECONDS));
+}
+
+/**
+===============================================================================================================================
+    @brief   - Adds counters of ring to statistics of queue.
+
+===============================================================================================================================
+*/
+void add_ring_stats(pipeline_queue_stats_t *stats, const spsc_ring_t *ring) {
+    C_ASSERT(stats != NULL, );
+    C_ASSERT(ring  != NULL, );
+
+    stats->pushes       += ring->pushes;
+    stats->full_stalls  += ring->full_stalls;
+    stats->empty_stalls += ring->empty_stalls;
+    stats->depth_sum    += ring->depth_sum;
+    if(ring->max_depth > stats->max_depth)
+        stats->max_depth = ring->max_depth;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Main function of reader thread.
+
+    @details - Takes free blocks, fills them and passes them to solvers in turn.\n
+             - Stops after block with READING_END or READING_ERROR state or when writer stops,
+               then passes end of stream (NULL) to every solver.
+
+===============================================================================================================================
+*/
+void read_blocks(stream_t *stream) {
+    C_ASSERT(stream != NULL, );
+
+    size_t line_number = 0;
+    for(size_t current = 0; !stream->stopped.load(std::memory_order_relaxed);
+        current = (current + 1) % stream->solvers_number) {
+        stream_block_t *block = ring_pop(stream->free_ring);
+
+        reading_state_t state = stream->mapped != NULL ? fill_block_mapped(stream->mapped, block) :
+                                                         fill_block(stream->input, block, &line_number);
+
+        ring_push(&stream->parsed_rings[current], block);
+        if(state != READING_SUCCESS)
+            break;
+    }
+
+    for(size_t solver = 0; solver < stream->solvers_number; solver++)
+        ring_push(&stream->parsed_rings[solver], NULL);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Main function of solver thread.
+
+    @details - Solves blocks with solve_quadratic_batch() (or solve_quadratic_batch_dedup() if deduplication is on),
+               formats their results and passes them to writer until the end of stream.
+
+===============================================================================================================================
+*/
+void solve_blocks(stream_t *stream, size_t solver) {
+    C_ASSERT(stream != NULL, );
+
+    while(true) {
+        stream_block_t *block = ring_pop(&stream->parsed_rings[solver]);
+        if(block == NULL)
+            break;
+
+        if(is_batch_dedup())
+            solve_quadratic_batch_dedup(block->a, block->b, block->c, block->size,
+                                        block->x1, block->x2, block->number, NULL);
+        else
+            solve_quadratic_batch(block->a, block->b, block->c, block->size,
+                                  block->x1, block->x2, block->number, NULL);
+        format_block(block);
+
+        ring_push(&stream->solved_rings[solver], block);
+    }
+
+    ring_push(&stream->solved_rings[solver], NULL);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Reads equations to block until it is full or input ends.
+
+    @param   [in]  input              Opened file with coefficients.
+    @param   [out] block              Block to fill.
+    @param   [out] line_number        Number of last read line.
+
+    @return  READING_SUCCESS if block is full, READING_END if input ended, READING_ERROR if line is invalid.
+
+===============================================================================================================================
+*/
+reading_state_t fill_block(FILE *input, stream_block_t *block, size_t *line_number) {
+    C_ASSERT(input       != NULL, READING_ERROR);
+    C_ASSERT(block       != NULL, READING_ERROR);
+    C_ASSERT(line_number != NULL, READING_ERROR);
+
+    char line[MAX_STREAM_LINE_LENGTH] = {};
+    block->size = 0;
+    block->state = READING_SUCCESS;
+
+    while(block->size < STREAM_BLOCK_SIZE) {
+        if(fgets(line, MAX_STREAM_LINE_LENGTH, input) == NULL) {
+            block->state = ferror(input) ? READING_ERROR : READING_END;
+            block->error_line = *line_number + 1;
+            return block->state;
+        }
+        *line_number += 1;
+
+        size_t length = strlen(line);
+        if(length + 1 == (size_t)MAX_STREAM_LINE_LENGTH && line[length - 1] != '\n' && !feof(input)) {
+            block->state = READING_ERROR;
+            block->error_line = *line_number;
+            return block->state;
+        }
+
+        text_reader_t reader = {};
+        init_text_reader(&reader, line, length);
+
+        size_t index = block->size;
+        reading_state_t line_state = read_coefficients_text(&reader, &block->a[index], &block->b[index], &block->c[index]);
+        if(line_state == READING_END)
+            continue;
+        if(line_state == READING_ERROR) {
+            block->state = READING_ERROR;
+            block->error_line = *line_number;
+            return block->state;
+        }
+        block->size++;
+    }
+    return block->state;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Reads equations from text in memory to block until it is full or text ends.
+
+    @param   [out] reader             Reader of mapped input.
+    @param   [out] block              Block to fill.
+
+    @return  READING_SUCCESS if block is full, READING_END if input ended, READING_ERROR if line is invalid.
+
+===============================================================================================================================
+*/
+reading_state_t fill_block_mapped(text_reader_t *reader, stream_block_t *block) {
+    C_ASSERT(reader != NULL, READING_ERROR);
+    C_ASSERT(block  != NULL, READING_ERROR);
+
+    block->size = 0;
+    block->state = READING_SUCCESS;
+
+    while(block->size < STREAM_BLOCK_SIZE) {
+        size_t index = block->size;
+        reading_state_t state = read_coefficients_text(reader, &block->a[index], &block->b[index], &block->c[index]);
+        if(state != READING_SUCCESS) {
+            block->state = state;
+            block->error_line = reader->error_line;
+            return block->state;
+        }
+        block->size++;
+    }
+    return block->state;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Formats results of block to its text.
+
+    @details - Every line is "a b c x1 x2 roots_number" with 17 significant digits.\n
+             - format_error is set if line could not be formatted.
+
+===============================================================================================================================
+*/
+void format_block(stream_block_t *block) {
+    C_ASSERT(block != NULL, );
+
+    block->text_size = 0;
+    block->format_error = false;
+
+    for(size_t i = 0; i < block->size; i++) {
+        int printed = snprintf(block->text + block->text_size, MAX_RESULT_LINE_LENGTH, "%.17lg %.17lg %.17lg %.17lg %.17lg %d\n",
+                               block->a[i], block->b[i], block->c[i], block->x1[i], block->x2[i], block->number[i]);
+        if(printed < 0 || (size_t)printed >= MAX_RESULT_LINE_LENGTH) {
+            block->format_error = true;
+            return ;
+        }
+        block->text_size += (size_t)printed;
+    }
+}
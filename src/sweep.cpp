@@ -0,0 +1,419 @@
+/**
+===============================================================================================================================
+    @file    sweep.cpp
+    @brief   Solving of grids of coefficients by families of equations along c axis.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+===============================================================================================================================
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <charconv>
+#include "sweep.h"
+#include "quadratic.h"
+#include "quadratic_family.h"
+#include "qbin.h"
+#include "thread_pool.h"
+#include "custom_assert.h"
+
+/**
+===============================================================================================================================
+    @brief   - Maximum length of line "a b c x1 x2 roots_number\n" (shortest representation of double
+               takes at most 24 symbols).
+
+===============================================================================================================================
+*/
+static const size_t MAX_SWEEP_LINE_LENGTH = 160;
+
+/**
+===============================================================================================================================
+    @brief   - Number of tiles per thread, that are solved before they are written.
+
+===============================================================================================================================
+*/
+static const size_t SWEEP_TILES_PER_THREAD = 2;
+
+/**
+===============================================================================================================================
+    @brief   - Relative tolerance of number of steps between first and last, so last is included despite rounding.
+
+===============================================================================================================================
+*/
+static const double SWEEP_STEPS_TOLERANCE = 1e-9;
+
+/**
+===============================================================================================================================
+    @brief   Tile of equations [first, first + size) of grid solved by one task.
+
+===============================================================================================================================
+*/
+struct sweep_tile_t {
+    size_t first;
+    size_t size;
+    double *a, *b, *c;
+    double *x1, *x2;
+    int8_t *number;
+    char *text;
+    size_t text_size;
+    uint64_t numbers[ROOTS_COUNTS_NUMBER];
+};
+
+/**
+===============================================================================================================================
+    @brief   Context of sweeping tasks.
+
+===============================================================================================================================
+*/
+struct sweep_context_t {
+    sweep_tile_t *tiles;
+    const sweep_config_t *config;
+};
+
+static bool parse_sweep_value(const char *string, char stop, double *value, const char **end);
+static bool allocate_tile(sweep_tile_t *tile, const sweep_config_t *config);
+static void free_tile(sweep_tile_t *tile);
+static void sweep_tiles(size_t begin, size_t end, size_t worker, void *context);
+static void sweep_tile(sweep_tile_t *tile, const sweep_config_t *config);
+static void format_sweep_tile(sweep_tile_t *tile);
+static char *append_number(char *position, char *end, double number);
+static double get_axis_value(const sweep_axis_t *axis, size_t index);
+
+void init_sweep_config(sweep_config_t *config) {
+    C_ASSERT(config != NULL, );
+
+    config->a      = {.first = 1, .step = 0, .count = 1};
+    config->b      = {.first = 0, .step = 0, .count = 1};
+    config->c      = {.first = 0, .step = 0, .count = 1};
+    config->format = SWEEP_TEXT;
+}
+
+bool parse_sweep_axis(sweep_config_t *config, const char *setting) {
+    C_ASSERT(config  != NULL, false);
+    C_ASSERT(setting != NULL, false);
+
+    sweep_axis_t *axis = NULL;
+    switch(setting[0]) {
+        case 'a': {
+            axis = &config->a;
+            break;
+        }
+        case 'b': {
+            axis = &config->b;
+            break;
+        }
+        case 'c': {
+            axis = &config->c;
+            break;
+        }
+        default: {
+            return false;
+        }
+    }
+    if(setting[1] != '=')
+        return false;
+
+    const char *position = setting + 2;
+    double first = 0, last = 0, step = 0;
+    if(!parse_sweep_value(position, ':', &first, &position))
+        return false;
+
+    if(*position == '\0') {
+        *axis = {.first = first, .step = 0, .count = 1};
+        return true;
+    }
+    if(!parse_sweep_value(position + 1, ':', &last,  &position) || *position != ':' ||
+       !parse_sweep_value(position + 1, '\0', &step, &position) || *position != '\0')
+        return false;
+
+    //exact comparison, grids of tiny coefficients are allowed
+    if(!(first < last) && !(first > last)) {
+        *axis = {.first = first, .step = step, .count = 1};
+        return true;
+    }
+
+    double steps = (last - first) / step;
+    if(!isfinite(steps) || steps < 0 || steps >= (double)SIZE_MAX)
+        return false;
+
+    *axis = {.first = first, .step = step, .count = (size_t)floor(steps * (1 + SWEEP_STEPS_TOLERANCE)) + 1};
+    return isfinite(get_axis_value(axis, axis->count - 1));
+}
+
+size_t get_sweep_size(const sweep_config_t *config) {
+    C_ASSERT(config != NULL, 0);
+
+    size_t size = config->a.count;
+    if(config->b.count != 0 && size > SIZE_MAX / config->b.count)
+        return 0;
+    size *= config->b.count;
+    if(config->c.count != 0 && size > SIZE_MAX / config->c.count)
+        return 0;
+    return size * config->c.count;
+}
+
+sweep_state_t sweep_equations(FILE *output, const sweep_config_t *config, sweep_stats_t *stats) {
+    C_ASSERT(output != NULL, SWEEP_WRITING_ERROR);
+    C_ASSERT(config != NULL, SWEEP_INVALID_GRID);
+    C_ASSERT(stats  != NULL, SWEEP_INVALID_GRID);
+
+    memset(stats, 0, sizeof(sweep_stats_t));
+
+    size_t count = get_sweep_size(config);
+    if(count == 0)
+        return SWEEP_INVALID_GRID;
+
+    if(config->format == SWEEP_QBIN && write_qbin_header(output, count, true) != QBIN_SUCCESS)
+        return SWEEP_WRITING_ERROR;
+
+    size_t tiles_number = get_threads_number() * SWEEP_TILES_PER_THREAD;
+    sweep_tile_t *tiles = (sweep_tile_t *)calloc(tiles_number, sizeof(sweep_tile_t));
+    if(tiles == NULL)
+        return SWEEP_MEMORY_ERROR;
+
+    sweep_state_t state = SWEEP_SUCCESS;
+    for(size_t tile = 0; tile < tiles_number; tile++) {
+        if(!allocate_tile(&tiles[tile], config)) {
+            state = SWEEP_MEMORY_ERROR;
+            break;
+        }
+    }
+
+    sweep_context_t context = {.tiles = tiles, .config = config};
+    size_t solved = 0;
+    while(state == SWEEP_SUCCESS && solved < count) {
+        size_t window = 0;
+        for(; window < tiles_number && solved < count; window++) {
+            tiles[window].first = solved;
+            tiles[window].size  = count - solved < SWEEP_TILE_SIZE ? count - solved : SWEEP_TILE_SIZE;
+            solved += tiles[window].size;
+        }
+
+        parallel_for(window, 1, sweep_tiles, &context);
+
+        for(size_t index = 0; index < window && state == SWEEP_SUCCESS; index++) {
+            sweep_tile_t *tile = &tiles[index];
+            stats->equations += tile->size;
+            for(size_t number = 0; number < ROOTS_COUNTS_NUMBER; number++)
+                stats->numbers[number] += tile->numbers[number];
+
+            switch(config->format) {
+                case SWEEP_TEXT: {
+                    if(fwrite(tile->text, 1, tile->text_size, output) != tile->text_size)
+                        state = SWEEP_WRITING_ERROR;
+                    break;
+                }
+                case SWEEP_QBIN: {
+                    if(write_qbin_rows(output, count, tile->first, tile->size, tile->a, tile->b, tile->c,
+                                       tile->x1, tile->x2, tile->number) != QBIN_SUCCESS)
+                        state = SWEEP_WRITING_ERROR;
+                    break;
+                }
+                default: {
+                    state = SWEEP_WRITING_ERROR;
+                    break;
+                }
+            }
+        }
+    }
+
+    for(size_t tile = 0; tile < tiles_number; tile++)
+        free_tile(&tiles[tile]);
+    free(tiles);
+    return state;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Reads finite number, that must be followed by stop symbol or by the end of string.
+
+    @param   [in]  string             String with number.
+    @param   [in]  stop               Symbol after number.
+    @param   [out] value              Pointer to number.
+    @param   [out] end                Pointer to position after number.
+
+    @return  False if there is no valid number.
+
+===============================================================================================================================
+*/
+bool parse_sweep_value(const char *string, char stop, double *value, const char **end) {
+    C_ASSERT(string != NULL, false);
+    C_ASSERT(value  != NULL, false);
+    C_ASSERT(end    != NULL, false);
+
+    char *number_end = NULL;
+    *value = strtod(string, &number_end);
+    *end = number_end;
+    return number_end != string && isfinite(*value) && (*number_end == stop || *number_end == '\0');
+}
+
+/**
+===============================================================================================================================
+    @brief   - Allocates columns of tile (text only if output is text).
+
+===============================================================================================================================
+*/
+bool allocate_tile(sweep_tile_t *tile, const sweep_config_t *config) {
+    C_ASSERT(tile   != NULL, false);
+    C_ASSERT(config != NULL, false);
+
+    tile->a      = (double *)calloc(SWEEP_TILE_SIZE, sizeof(double));
+    tile->b      = (double *)calloc(SWEEP_TILE_SIZE, sizeof(double));
+    tile->c      = (double *)calloc(SWEEP_TILE_SIZE, sizeof(double));
+    tile->x1     = (double *)calloc(SWEEP_TILE_SIZE, sizeof(double));
+    tile->x2     = (double *)calloc(SWEEP_TILE_SIZE, sizeof(double));
+    tile->number = (int8_t *)calloc(SWEEP_TILE_SIZE, sizeof(int8_t));
+    if(tile->a == NULL || tile->b == NULL || tile->c == NULL || tile->x1 == NULL || tile->x2 == NULL || tile->number == NULL)
+        return false;
+
+    if(config->format == SWEEP_TEXT) {
+        tile->text = (char *)calloc(SWEEP_TILE_SIZE, MAX_SWEEP_LINE_LENGTH);
+        if(tile->text == NULL)
+            return false;
+    }
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Frees columns of tile.
+
+===============================================================================================================================
+*/
+void free_tile(sweep_tile_t *tile) {
+    C_ASSERT(tile != NULL, );
+
+    free(tile->a);
+    free(tile->b);
+    free(tile->c);
+    free(tile->x1);
+    free(tile->x2);
+    free(tile->number);
+    free(tile->text);
+    memset(tile, 0, sizeof(sweep_tile_t));
+}
+
+/**
+===============================================================================================================================
+    @brief   - Task of pool, that solves tiles [begin, end) of window.
+
+===============================================================================================================================
+*/
+void sweep_tiles(size_t begin, size_t end, size_t worker, void *context) {
+    C_ASSERT(context != NULL, );
+    (void)worker;
+
+    sweep_context_t *sweep = (sweep_context_t *)context;
+    for(size_t index = begin; index < end; index++)
+        sweep_tile(&sweep->tiles[index], sweep->config);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Fills coefficients of tile, solves them by rows of c axis, counts numbers of roots
+               and formats tile if output is text.
+
+    @details - Every row is a family with the same a and b (see quadratic_family.h).\n
+             - Tile may start and end in the middle of row, so the first and the last rows are partial.
+
+===============================================================================================================================
+*/
+void sweep_tile(sweep_tile_t *tile, const sweep_config_t *config) {
+    C_ASSERT(tile   != NULL, );
+    C_ASSERT(config != NULL, );
+
+    size_t row     = tile->first / config->c.count;
+    size_t c_index = tile->first % config->c.count;
+    size_t a_index = row / config->b.count;
+    size_t b_index = row % config->b.count;
+
+    for(size_t done = 0; done < tile->size; ) {
+        size_t size = config->c.count - c_index;
+        if(size > tile->size - done)
+            size = tile->size - done;
+
+        quadratic_family_t family = {};
+        prepare_quadratic_family(get_axis_value(&config->a, a_index), get_axis_value(&config->b, b_index), &family);
+        for(size_t i = 0; i < size; i++) {
+            tile->a[done + i] = family.a;
+            tile->b[done + i] = family.b;
+            tile->c[done + i] = get_axis_value(&config->c, c_index + i);
+        }
+        solve_quadratic_family_batch(&family, tile->c + done, size, tile->x1 + done, tile->x2 + done, tile->number + done, NULL);
+
+        done += size;
+        c_index = 0;
+        if(++b_index == config->b.count) {
+            b_index = 0;
+            a_index++;
+        }
+    }
+
+    memset(tile->numbers, 0, sizeof(tile->numbers));
+    for(size_t i = 0; i < tile->size; i++)
+        tile->numbers[tile->number[i] - INF_ROOTS]++;
+
+    if(config->format == SWEEP_TEXT)
+        format_sweep_tile(tile);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Formats equations of tile with results to its text with the shortest representations of numbers.
+
+===============================================================================================================================
+*/
+void format_sweep_tile(sweep_tile_t *tile) {
+    C_ASSERT(tile != NULL, );
+
+    char *position = tile->text;
+    for(size_t i = 0; i < tile->size; i++) {
+        char *end = position + MAX_SWEEP_LINE_LENGTH;
+        position = append_number(position, end, tile->a[i]);
+        *position++ = ' ';
+        position = append_number(position, end, tile->b[i]);
+        *position++ = ' ';
+        position = append_number(position, end, tile->c[i]);
+        *position++ = ' ';
+        position = append_number(position, end, tile->x1[i]);
+        *position++ = ' ';
+        position = append_number(position, end, tile->x2[i]);
+        *position++ = ' ';
+        position = std::to_chars(position, end, (int)tile->number[i]).ptr;
+        *position++ = '\n';
+    }
+    tile->text_size = (size_t)(position - tile->text);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Writes the shortest representation of number, that is read back exactly.
+
+    @return  Position after number.
+
+===============================================================================================================================
+*/
+char *append_number(char *position, char *end, double number) {
+    C_ASSERT(position != NULL, position);
+    C_ASSERT(end      != NULL, position);
+
+    return std::to_chars(position, end, number).ptr;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Returns value of axis with given index.
+
+    @details - Value is computed from index, not accumulated, so rounding errors of step do not grow along axis.
+
+===============================================================================================================================
+*/
+double get_axis_value(const sweep_axis_t *axis, size_t index) {
+    C_ASSERT(axis != NULL, 0);
+
+    return axis->first + (double)index * axis->step;
+}
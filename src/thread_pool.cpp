@@ -0,0 +1,318 @@
+/**
+===============================================================================================================================
+    @file    thread_pool.cpp
+    @brief   Work-stealing thread pool.
+    @date    17.10.2026
+    @author  Artem Neskorodov
+    @link    https://vk.com/neskorodovartem
+
+    @details - Every worker owns range of chunks [front, back), that is packed in one 64-bit atomic.\n
+             - Owner takes chunks from the front, thieves take half of the range from the back.\n
+             - Both owner and thieves change range with compare-and-swap, so no locks are taken while working.
+
+===============================================================================================================================
+*/
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "thread_pool.h"
+#include "custom_assert.h"
+
+/**
+===============================================================================================================================
+    @brief   Range of chunks owned by worker, on separate cache line to avoid false sharing.
+
+===============================================================================================================================
+*/
+struct alignas(64) worker_range_t {
+    std::atomic<uint64_t> range;
+};
+
+/**
+===============================================================================================================================
+    @brief   Parallel job that is currently run by pool.
+
+===============================================================================================================================
+*/
+struct pool_job_t {
+    pool_task_t task;
+    void *context;
+    size_t count;
+    size_t chunk_size;
+};
+
+/**
+===============================================================================================================================
+    @brief   State of the pool.
+
+===============================================================================================================================
+*/
+struct thread_pool_t {
+    size_t threads_number;
+    bool started;
+    bool stopping;
+    uint64_t generation;
+    size_t busy_workers;
+    pool_job_t job;
+    std::thread *workers;
+    worker_range_t *ranges;
+    std::mutex call_mutex;
+    std::mutex state_mutex;
+    std::condition_variable job_ready;
+    std::condition_variable job_done;
+};
+
+static thread_pool_t pool = {};
+static thread_local bool inside_pool = false;
+
+static void start_pool(void);
+static void stop_pool(void);
+static void worker_loop(size_t worker);
+static void run_worker(size_t worker);
+static bool take_own_chunk(size_t worker, uint32_t *chunk);
+static bool steal_chunks(size_t worker);
+static uint64_t pack_range(uint32_t front, uint32_t back);
+
+bool set_threads_number(size_t threads_number) {
+    std::lock_guard<std::mutex> lock(pool.call_mutex);
+
+    if(pool.started)
+        return false;
+
+    pool.threads_number = threads_number;
+    return true;
+}
+
+size_t get_threads_number(void) {
+    if(pool.threads_number == 0) {
+        size_t hardware = std::thread::hardware_concurrency();
+        return hardware == 0 ? 1 : hardware;
+    }
+    return pool.threads_number;
+}
+
+size_t cache_chunk_size(size_t element_size) {
+    if(element_size == 0 || element_size >= POOL_CHUNK_BYTES)
+        return 1;
+
+    return POOL_CHUNK_BYTES / element_size;
+}
+
+void parallel_for(size_t count, size_t chunk_size, pool_task_t task, void *context) {
+    C_ASSERT(task != NULL, );
+
+    if(count == 0)
+        return ;
+
+    if(chunk_size == 0)
+        chunk_size = 1;
+
+    //chunk indices must fit in half of packed range
+    while((count + chunk_size - 1) / chunk_size > UINT32_MAX)
+        chunk_size *= 2;
+
+    if(inside_pool || get_threads_number() == 1 || count <= chunk_size) {
+        task(0, count, 0, context);
+        return ;
+    }
+
+    std::lock_guard<std::mutex> call_lock(pool.call_mutex);
+    if(!pool.started)
+        start_pool();
+
+    size_t chunks  = (count + chunk_size - 1) / chunk_size;
+    size_t threads = pool.threads_number;
+    for(size_t worker = 0; worker < threads; worker++) {
+        uint32_t front = (uint32_t)(chunks *  worker      / threads);
+        uint32_t back  = (uint32_t)(chunks * (worker + 1) / threads);
+        pool.ranges[worker].range.store(pack_range(front, back), std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(pool.state_mutex);
+        pool.job = {.task = task, .context = context, .count = count, .chunk_size = chunk_size};
+        pool.busy_workers = threads - 1;
+        pool.generation++;
+    }
+    pool.job_ready.notify_all();
+
+    inside_pool = true;
+    run_worker(0);
+    inside_pool = false;
+
+    std::unique_lock<std::mutex> lock(pool.state_mutex);
+    pool.job_done.wait(lock, [] { return pool.busy_workers == 0; });
+}
+
+/**
+===============================================================================================================================
+    @brief   - Creates worker threads.
+
+    @details - Must be called with call_mutex locked.
+
+===============================================================================================================================
+*/
+void start_pool(void) {
+    pool.threads_number = get_threads_number();
+    pool.ranges  = new worker_range_t[pool.threads_number];
+    pool.workers = new std::thread[pool.threads_number];
+
+    for(size_t worker = 1; worker < pool.threads_number; worker++)
+        pool.workers[worker] = std::thread(worker_loop, worker);
+
+    pool.started = true;
+    atexit(stop_pool);
+}
+
+/**
+===============================================================================================================================
+    @brief   - Stops and joins worker threads.
+
+===============================================================================================================================
+*/
+void stop_pool(void) {
+    {
+        std::lock_guard<std::mutex> lock(pool.state_mutex);
+        pool.stopping = true;
+    }
+    pool.job_ready.notify_all();
+
+    for(size_t worker = 1; worker < pool.threads_number; worker++)
+        pool.workers[worker].join();
+
+    delete[] pool.workers;
+    delete[] pool.ranges;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Main function of worker thread, waits for jobs and runs them.
+
+    @param   [in]  worker             Index of worker.
+
+===============================================================================================================================
+*/
+void worker_loop(size_t worker) {
+    inside_pool = true;
+    uint64_t seen_generation = 0;
+
+    while(true) {
+        {
+            std::unique_lock<std::mutex> lock(pool.state_mutex);
+            pool.job_ready.wait(lock, [&] { return pool.stopping || pool.generation != seen_generation; });
+            if(pool.stopping)
+                return ;
+            seen_generation = pool.generation;
+        }
+
+        run_worker(worker);
+
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lock(pool.state_mutex);
+            pool.busy_workers--;
+            last = pool.busy_workers == 0;
+        }
+        if(last)
+            pool.job_done.notify_one();
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Runs chunks of current job until there are no chunks left in all ranges.
+
+    @param   [in]  worker             Index of worker.
+
+===============================================================================================================================
+*/
+void run_worker(size_t worker) {
+    const pool_job_t job = pool.job;
+
+    while(true) {
+        uint32_t chunk = 0;
+        while(take_own_chunk(worker, &chunk)) {
+            size_t begin = (size_t)chunk * job.chunk_size;
+            size_t end   = begin + job.chunk_size < job.count ? begin + job.chunk_size : job.count;
+            job.task(begin, end, worker, job.context);
+        }
+
+        if(!steal_chunks(worker))
+            return ;
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Takes chunk from the front of worker's own range.
+
+    @param   [in]  worker             Index of worker.
+    @param   [out] chunk              Index of taken chunk.
+
+    @return  True if chunk was taken and false if range is empty.
+
+===============================================================================================================================
+*/
+bool take_own_chunk(size_t worker, uint32_t *chunk) {
+    std::atomic<uint64_t> &range = pool.ranges[worker].range;
+    uint64_t current = range.load(std::memory_order_acquire);
+
+    while(true) {
+        uint32_t front = (uint32_t)current;
+        uint32_t back  = (uint32_t)(current >> 32);
+        if(front >= back)
+            return false;
+
+        if(range.compare_exchange_weak(current, pack_range(front + 1, back), std::memory_order_acq_rel)) {
+            *chunk = front;
+            return true;
+        }
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Steals half of the range of another worker and makes it worker's own range.
+
+    @param   [in]  worker             Index of worker that steals.
+
+    @return  True if chunks were stolen and false if all ranges are empty.
+
+===============================================================================================================================
+*/
+bool steal_chunks(size_t worker) {
+    size_t threads = pool.threads_number;
+
+    for(size_t shift = 1; shift < threads; shift++) {
+        std::atomic<uint64_t> &victim = pool.ranges[(worker + shift) % threads].range;
+        uint64_t current = victim.load(std::memory_order_acquire);
+
+        while(true) {
+            uint32_t front = (uint32_t)current;
+            uint32_t back  = (uint32_t)(current >> 32);
+            if(front >= back)
+                break;
+
+            uint32_t stolen = (back - front + 1) / 2;
+            if(victim.compare_exchange_weak(current, pack_range(front, back - stolen), std::memory_order_acq_rel)) {
+                pool.ranges[worker].range.store(pack_range(back - stolen, back), std::memory_order_release);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Packs range [front, back) in one 64-bit number.
+
+===============================================================================================================================
+*/
+uint64_t pack_range(uint32_t front, uint32_t back) {
+    return ((uint64_t)back << 32) | front;
+}
@@ -9,64 +9,193 @@
 ===============================================================================================================================
 */
 
-#include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 #include <stdint.h>
+#include <string.h>
+#include <charconv>
 #include "quadratic.h"
 #include "utils.h"
 #include "custom_assert.h"
 
-static const int FILE_LINE_NUMBERS = 6;
-
-bool is_zero(double num) {
-    if(fabs(num) < EPSILON)
-        return true;
+/**
+===============================================================================================================================
+    @brief   - Maximum length of number that is parsed with strtod() if from_chars() can not parse it.
 
-    return false;
-}
+===============================================================================================================================
+*/
+static const size_t MAX_NUMBER_LENGTH = 128;
 
-compare_state_t compare_with_zero(double a) {
-    if(is_zero(a) == true)
-        return EQUALS;
+static void skip_spaces(text_reader_t *reader);
+static void skip_line_spaces(text_reader_t *reader);
+static bool parse_int(const char **position, const char *end, int *out);
+static bool parse_double_strtod(const char **position, const char *end, double *out);
 
-    if(a > 0.0)
-        return BIGGER;
+void init_text_reader(text_reader_t *reader, const char *data, size_t size) {
+    C_ASSERT(reader != NULL, );
+    C_ASSERT(data   != NULL, );
 
-    return LESS;
+    reader->position   = data;
+    reader->end        = data + size;
+    reader->line       = 1;
+    reader->error_line = 0;
 }
 
-reading_state_t read_expected_line(FILE *file, quadratic_equation_t *equation) {
-    C_ASSERT(file     != NULL, READING_ERROR);
+reading_state_t read_expected_text(text_reader_t *reader, quadratic_equation_t *equation) {
+    C_ASSERT(reader   != NULL, READING_ERROR);
     C_ASSERT(equation != NULL, READING_ERROR);
 
-    if(file == NULL)
-        return READING_ERROR;
+    skip_spaces(reader);
+    if(reader->position == reader->end)
+        return READING_END;
 
-    int read_state = fscanf(file, "%lg %lg %lg %lg %lg %d\n",
-                            &equation->a, &equation->b, &equation->c,
-                            &equation->x1, &equation->x2, (int*)&equation->number);
+    double *fields[] = {&equation->a, &equation->b, &equation->c, &equation->x1, &equation->x2};
+    for(size_t field = 0; field < sizeof(fields) / sizeof(double *); field++) {
+        skip_spaces(reader);
+        if(!parse_double(&reader->position, reader->end, fields[field])) {
+            reader->error_line = reader->line;
+            return READING_ERROR;
+        }
+    }
 
-    if(read_state == EOF)
-        return READING_END;
-    if(read_state != FILE_LINE_NUMBERS)
-        return READING_ERROR;
-    if(equation->number == NOT_SOLVED)
+    skip_spaces(reader);
+    int number = 0;
+    if(!parse_int(&reader->position, reader->end, &number) || number == NOT_SOLVED) {
+        reader->error_line = reader->line;
         return READING_ERROR;
+    }
+    equation->number = (roots_number_t)number;
 
+    skip_spaces(reader);
     return READING_SUCCESS;
 }
 
-bool is_minus_zero(double number) {
-    const uint64_t minus_zero = (uint64_t)1 << (8 * sizeof(uint64_t) - 1);
-    uint64_t bits = *(uint64_t *)&number;
-    if(minus_zero == bits)
-        return true;
-    return false;
+reading_state_t read_coefficients_text(text_reader_t *reader, double *a, double *b, double *c) {
+    C_ASSERT(reader != NULL, READING_ERROR);
+    C_ASSERT(a      != NULL, READING_ERROR);
+    C_ASSERT(b      != NULL, READING_ERROR);
+    C_ASSERT(c      != NULL, READING_ERROR);
+
+    //skipping empty lines
+    while(true) {
+        skip_line_spaces(reader);
+        if(reader->position == reader->end)
+            return READING_END;
+        if(*reader->position != '\n')
+            break;
+        reader->position++;
+        reader->line++;
+    }
+
+    double *coefficients[] = {a, b, c};
+    for(size_t index = 0; index < sizeof(coefficients) / sizeof(double *); index++) {
+        skip_line_spaces(reader);
+        if(!parse_double(&reader->position, reader->end, coefficients[index])) {
+            reader->error_line = reader->line;
+            return READING_ERROR;
+        }
+    }
+
+    skip_line_spaces(reader);
+    if(reader->position != reader->end) {
+        if(*reader->position != '\n') {
+            reader->error_line = reader->line;
+            return READING_ERROR;
+        }
+        reader->position++;
+        reader->line++;
+    }
+    return READING_SUCCESS;
+}
+
+bool parse_double(const char **position, const char *end, double *out) {
+    C_ASSERT(position  != NULL, false);
+    C_ASSERT(*position != NULL, false);
+    C_ASSERT(end       != NULL, false);
+    C_ASSERT(out       != NULL, false);
+
+    const char *start = *position;
+    //from_chars() does not accept '+'
+    if(start != end && *start == '+' && start + 1 != end && start[1] != '-')
+        start++;
+
+    std::from_chars_result result = std::from_chars(start, end, *out);
+    bool is_hexadecimal = result.ptr != end && (*result.ptr == 'x' || *result.ptr == 'X');
+    if(result.ec != std::errc() || is_hexadecimal)
+        return parse_double_strtod(position, end, out);
+
+    *position = result.ptr;
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Moves reader after space characters, counting new lines.
+
+===============================================================================================================================
+*/
+void skip_spaces(text_reader_t *reader) {
+    while(reader->position != reader->end &&
+          (*reader->position == ' '  || *reader->position == '\t' || *reader->position == '\n' ||
+           *reader->position == '\r' || *reader->position == '\v' || *reader->position == '\f')) {
+        if(*reader->position == '\n')
+            reader->line++;
+        reader->position++;
+    }
+}
+
+/**
+===============================================================================================================================
+    @brief   - Moves reader after space characters except new line.
+
+===============================================================================================================================
+*/
+void skip_line_spaces(text_reader_t *reader) {
+    while(reader->position != reader->end &&
+          (*reader->position == ' '  || *reader->position == '\t' || *reader->position == '\r' ||
+           *reader->position == '\v' || *reader->position == '\f'))
+        reader->position++;
 }
 
-bool is_equal(double a, double b) {
-    if(is_zero(a - b))
-        return true;
-    return false;
+/**
+===============================================================================================================================
+    @brief   - Parses integer in the same way as '%d'.
+
+===============================================================================================================================
+*/
+bool parse_int(const char **position, const char *end, int *out) {
+    const char *start = *position;
+    if(start != end && *start == '+' && start + 1 != end && start[1] != '-')
+        start++;
+
+    std::from_chars_result result = std::from_chars(start, end, *out);
+    if(result.ec != std::errc())
+        return false;
+
+    *position = result.ptr;
+    return true;
+}
+
+/**
+===============================================================================================================================
+    @brief   - Parses double with strtod() from copy of number (text in memory may not end with '\0').
+
+===============================================================================================================================
+*/
+bool parse_double_strtod(const char **position, const char *end, double *out) {
+    char number[MAX_NUMBER_LENGTH] = {};
+
+    size_t length = 0;
+    while(length + 1 < MAX_NUMBER_LENGTH && *position + length != end &&
+          strchr(" \t\n\r\v\f", (*position)[length]) == NULL)
+        length++;
+    memcpy(number, *position, length);
+
+    char *number_end = NULL;
+    *out = strtod(number, &number_end);
+    if(number_end == number)
+        return false;
+
+    *position += number_end - number;
+    return true;
 }